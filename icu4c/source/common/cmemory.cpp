@@ -112,6 +112,217 @@ uprv_calloc(size_t num, size_t size) {
     return mem;
 }
 
+/*
+ * Per-thread cache for uprv_sizedMalloc().
+ * Each size class has a "magazine" of recently released blocks.
+ * A full magazine returns half of its blocks to the heap.
+ *
+ * The cache only ever holds blocks from the default heap: It is turned off
+ * for the rest of the process once u_setMemoryFunctions() has been called,
+ * so that no block can move between the default and the user heap through it.
+ * A released block is cached in the largest size class that is not larger
+ * than the released size, so that it is never handed out for more than
+ * it holds, wherever it came from.
+ *
+ * Each thread's cache is flushed when the thread exits, and all of them
+ * are flushed by u_cleanup().
+ */
+#ifndef UPRV_SIZED_MALLOC_CACHE
+#   define UPRV_SIZED_MALLOC_CACHE 1
+#endif
+
+#if UPRV_SIZED_MALLOC_CACHE
+#include "mutex.h"
+#include "umutex.h"
+#endif
+
+namespace {
+
+// Every 16 bytes up to 512, then two larger classes.
+constexpr int32_t kNumFineSizeClasses = 32;
+constexpr int32_t kNumSizeClasses = kNumFineSizeClasses + 2;
+constexpr size_t kMaxFineSize = 512;
+constexpr size_t kMaxCachedSize = 1024;
+constexpr int32_t kMagazineCapacity = 8;
+
+inline int32_t sizeClassSize(int32_t i) {
+    return i < kNumFineSizeClasses ? (i + 1) * 16 : (i == kNumFineSizeClasses ? 768 : 1024);
+}
+
+/** @return the smallest size class for at least size bytes; size must be 1..kMaxCachedSize */
+inline int32_t sizeClassIndexForAlloc(size_t size) {
+    if (size <= kMaxFineSize) {
+        return (int32_t)((size + 15) / 16) - 1;
+    }
+    return size <= 768 ? kNumFineSizeClasses : kNumFineSizeClasses + 1;
+}
+
+/** @return the largest size class for at most size bytes, or -1; size must be 1..kMaxCachedSize */
+inline int32_t sizeClassIndexForFree(size_t size) {
+    if (size < 768) {
+        return size < kMaxFineSize ? (int32_t)(size / 16) - 1 : kNumFineSizeClasses - 1;
+    }
+    return size < kMaxCachedSize ? kNumFineSizeClasses : kNumFineSizeClasses + 1;
+}
+
+#if UPRV_SIZED_MALLOC_CACHE
+
+/** Set by u_setMemoryFunctions(). */
+UBool gSizedCacheDisabled = FALSE;
+
+/**
+ * Trivially destructible, so that it can still be used (as "retired")
+ * by other thread_local destructors after its thread's owner has flushed it.
+ */
+struct SmallBlockCache {
+    void flush() {
+        for (int32_t i = 0; i < kNumSizeClasses; ++i) {
+            while (counts[i] > 0) {
+                uprv_default_free(blocks[i][--counts[i]]);
+            }
+        }
+    }
+
+    void *blocks[kNumSizeClasses][kMagazineCapacity];
+    int32_t counts[kNumSizeClasses];
+    int64_t allocations[kNumSizeClasses];
+    int64_t hits[kNumSizeClasses];
+    /** Next cache in gCaches, while registered. */
+    SmallBlockCache *next;
+    /** In gCaches, with a SmallBlockCacheOwner to flush it at thread exit. */
+    bool isRegistered;
+    /** Set when the thread exits; later releases go to the heap. */
+    bool isRetired;
+};
+
+// Zero-initialized: all magazines empty.
+thread_local SmallBlockCache gSmallBlockCache;
+
+/** All registered caches, for u_cleanup(). */
+SmallBlockCache *gCaches = nullptr;
+icu::UMutex gCachesMutex;
+
+/** Unregisters and flushes the thread's cache when the thread exits. */
+struct SmallBlockCacheOwner {
+    ~SmallBlockCacheOwner() {
+        if (cache == nullptr) { return; }
+        icu::Mutex lock(&gCachesMutex);
+        for (SmallBlockCache **p = &gCaches; *p != nullptr; p = &(*p)->next) {
+            if (*p == cache) {
+                *p = cache->next;
+                break;
+            }
+        }
+        cache->flush();
+        cache->isRegistered = false;
+        cache->isRetired = true;
+    }
+
+    SmallBlockCache *cache;
+};
+
+thread_local SmallBlockCacheOwner gSmallBlockCacheOwner;
+
+/** Called before the first block goes into the thread's cache. */
+void registerCache(SmallBlockCache &cache) {
+    // Constructs the owner, which registers its destructor for this thread.
+    gSmallBlockCacheOwner.cache = &cache;
+    icu::Mutex lock(&gCachesMutex);
+    cache.next = gCaches;
+    gCaches = &cache;
+    cache.isRegistered = true;
+}
+
+#endif  // UPRV_SIZED_MALLOC_CACHE
+
+}  // namespace
+
+U_CAPI void * U_EXPORT2
+uprv_sizedMalloc(size_t size) {
+#if UPRV_SIZED_MALLOC_CACHE
+    if (size > 0 && size <= kMaxCachedSize && !gSizedCacheDisabled) {
+        SmallBlockCache &cache = gSmallBlockCache;
+        int32_t i = sizeClassIndexForAlloc(size);
+        ++cache.allocations[i];
+        if (cache.counts[i] > 0) {
+            ++cache.hits[i];
+            return cache.blocks[i][--cache.counts[i]];
+        }
+        // Allocate the full class size so that the block can be reused for any size in the class.
+        return uprv_default_malloc(sizeClassSize(i));
+    }
+#endif
+    return uprv_malloc(size);
+}
+
+U_CAPI void * U_EXPORT2
+uprv_sizedRealloc(void *mem, size_t oldSize, size_t newSize) {
+    if (mem == NULL || mem == zeroMem) {
+        return uprv_sizedMalloc(newSize);
+    }
+#if UPRV_SIZED_MALLOC_CACHE
+    if (oldSize <= kMaxCachedSize || newSize <= kMaxCachedSize) {
+        // Blocks in the size classes must have the class size,
+        // which uprv_realloc() does not preserve.
+        void *newMem = uprv_sizedMalloc(newSize);
+        if (newMem == NULL) {
+            return NULL;
+        }
+        uprv_memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+        uprv_sizedFree(mem, oldSize);
+        return newMem;
+    }
+#else
+    (void)oldSize;
+#endif
+    return uprv_realloc(mem, newSize);
+}
+
+U_CAPI void U_EXPORT2
+uprv_sizedFree(void *mem, size_t size) {
+#if UPRV_SIZED_MALLOC_CACHE
+    if (mem != NULL && mem != zeroMem && size >= 16 && size <= kMaxCachedSize &&
+            !gSizedCacheDisabled) {
+        SmallBlockCache &cache = gSmallBlockCache;
+        if (!cache.isRetired) {
+            if (!cache.isRegistered) {
+                registerCache(cache);
+            }
+            int32_t i = sizeClassIndexForFree(size);
+            if (cache.counts[i] == kMagazineCapacity) {
+                // Return the older half of the blocks to the heap.
+                for (int32_t j = 0; j < kMagazineCapacity / 2; ++j) {
+                    uprv_default_free(cache.blocks[i][j]);
+                }
+                uprv_memmove(cache.blocks[i], cache.blocks[i] + kMagazineCapacity / 2,
+                             (kMagazineCapacity / 2) * sizeof(void *));
+                cache.counts[i] = kMagazineCapacity / 2;
+            }
+            cache.blocks[i][cache.counts[i]++] = mem;
+            return;
+        }
+    }
+#else
+    (void)size;
+#endif
+    uprv_free(mem);
+}
+
+U_CAPI int32_t U_EXPORT2
+uprv_getSizedMallocStats(int32_t *blockSizes, int64_t *allocations, int64_t *cacheHits,
+                         int32_t capacity) {
+    for (int32_t i = 0; i < capacity && i < kNumSizeClasses; ++i) {
+        blockSizes[i] = sizeClassSize(i);
+#if UPRV_SIZED_MALLOC_CACHE
+        allocations[i] = gSmallBlockCache.allocations[i];
+        cacheHits[i] = gSmallBlockCache.hits[i];
+#else
+        allocations[i] = cacheHits[i] = 0;
+#endif
+    }
+    return kNumSizeClasses;
+}
+
 U_CAPI void U_EXPORT2
 u_setMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r, UMemFreeFn *f,  UErrorCode *status)
 {
@@ -122,6 +333,9 @@ u_setMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r, UMem
         *status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
+#if UPRV_SIZED_MALLOC_CACHE
+    gSizedCacheDisabled = TRUE;
+#endif
     pContext  = context;
     pAlloc    = a;
     pRealloc  = r;
@@ -130,6 +344,16 @@ u_setMemoryFunctions(const void *context, UMemAllocFn *a, UMemReallocFn *r, UMem
 
 
 U_CFUNC UBool cmemory_cleanup(void) {
+#if UPRV_SIZED_MALLOC_CACHE
+    {
+        // u_cleanup() requires that no other thread uses ICU,
+        // so the other threads' caches can be flushed here as well.
+        icu::Mutex lock(&gCachesMutex);
+        for (SmallBlockCache *cache = gCaches; cache != nullptr; cache = cache->next) {
+            cache->flush();
+        }
+    }
+#endif
     pContext   = NULL;
     pAlloc     = NULL;
     pRealloc   = NULL;
@@ -64,6 +64,45 @@ uprv_free(void *mem);
 U_CAPI void * U_EXPORT2
 uprv_calloc(size_t num, size_t size) U_MALLOC_ATTR U_ALLOC_SIZE_ATTR2(1,2);
 
+/**
+ * Like uprv_malloc(), for memory whose size is known again when it is released.
+ * Small blocks are taken from a per-thread cache of blocks that were released
+ * with uprv_sizedFree(), which avoids heap contention for ICU's most common
+ * allocation sizes.
+ * The cache is turned off once u_setMemoryFunctions() has been called.
+ *
+ * Release the memory with uprv_sizedFree() or uprv_free(),
+ * or resize it with uprv_sizedRealloc().
+ */
+U_CAPI void * U_EXPORT2
+uprv_sizedMalloc(size_t size) U_MALLOC_ATTR U_ALLOC_SIZE_ATTR(1);
+
+/**
+ * Like uprv_realloc(), for memory from uprv_sizedMalloc(oldSize)
+ * or uprv_sizedRealloc(..., oldSize).
+ */
+U_CAPI void * U_EXPORT2
+uprv_sizedRealloc(void *mem, size_t oldSize, size_t newSize) U_ALLOC_SIZE_ATTR(3);
+
+/**
+ * Releases memory from uprv_sizedMalloc() or uprv_sizedRealloc().
+ * The size must not be larger than the one that was requested for the memory.
+ * Small blocks are kept in the per-thread cache for reuse, in the size class
+ * that fits the given size, so that they are never reused for more than that.
+ */
+U_CAPI void U_EXPORT2
+uprv_sizedFree(void *mem, size_t size);
+
+/**
+ * Gets statistics for the calling thread's small-block cache,
+ * for each size class: the block size, the number of uprv_sizedMalloc() calls,
+ * and how many of them were served from the cache.
+ * @return the number of size classes; the arrays are filled up to their capacity
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_getSizedMallocStats(int32_t *blockSizes, int64_t *allocations, int64_t *cacheHits,
+                         int32_t capacity);
+
 /**
  * Get the least significant bits of a pointer (a memory address).
  * For example, with a mask of 3, the macro gets the 2 least significant bits,
@@ -99,6 +138,7 @@ uprv_calloc(size_t num, size_t size) U_MALLOC_ATTR U_ALLOC_SIZE_ATTR2(1,2);
 /**
   *  Heap clean up function, called from u_cleanup()
   *    Clears any user heap functions from u_setMemoryFunctions()
+  *    and releases the calling thread's cached small blocks.
   *    Does NOT deallocate any remaining allocated memory.
   */
 U_CFUNC UBool 
@@ -14,11 +14,13 @@
 #include "unicode/stringpiece.h"
 #include "unicode/uloc.h"
 #include "unicode/uobject.h"
+#include "charstr.h"
 #include "cstring.h"
 #include "localeprioritylist.h"
 #include "loclikelysubtags.h"
 #include "locdistance.h"
 #include "lsr.h"
+#include "mutex.h"
 #include "uassert.h"
 #include "uhash.h"
 #include "ustr_imp.h"
@@ -132,7 +134,8 @@ LocaleMatcher::Builder::Builder(LocaleMatcher::Builder &&src) U_NOEXCEPT :
         demotion_(src.demotion_),
         defaultLocale_(src.defaultLocale_),
         favor_(src.favor_),
-        direction_(src.direction_) {
+        direction_(src.direction_),
+        cacheSize_(src.cacheSize_) {
     src.supportedLocales_ = nullptr;
     src.defaultLocale_ = nullptr;
 }
@@ -152,6 +155,7 @@ LocaleMatcher::Builder &LocaleMatcher::Builder::operator=(LocaleMatcher::Builder
     defaultLocale_ = src.defaultLocale_;
     favor_ = src.favor_;
     direction_ = src.direction_;
+    cacheSize_ = src.cacheSize_;
 
     src.supportedLocales_ = nullptr;
     src.defaultLocale_ = nullptr;
@@ -314,6 +318,214 @@ UBool compareLSRs(const UHashTok t1, const UHashTok t2) {
 
 }  // namespace
 
+namespace {
+
+constexpr int32_t MATCHER_CACHE_SHARDS = 8;
+// Longer strings are not cached, which bounds the memory used by a cache entry.
+constexpr int32_t MAX_CACHED_KEY_LENGTH = 256;
+
+// Shard i of every LocaleMatcherCache is guarded by gMatcherCacheMutexes[i].
+UMutex gMatcherCacheMutexes[MATCHER_CACHE_SHARDS];
+
+}  // namespace
+
+/**
+ * Caches the results of getBestMatchForListString() by list string,
+ * and maximized LSRs by desired-locale ID.
+ * Each kind of entry is split into shards by key hash, with one lock per shard.
+ * Each shard is a map from keys to entries plus a most-recently-used list of its entries.
+ */
+class LocaleMatcherCache : public UMemory {
+public:
+    LocaleMatcherCache(int32_t cacheSize, UErrorCode &errorCode);
+    ~LocaleMatcherCache();
+
+    /** Returns TRUE and sets suppIndex if the list string is cached. */
+    UBool getSuppIndex(StringPiece list, int32_t &suppIndex);
+    void putSuppIndex(StringPiece list, int32_t suppIndex);
+
+    LSR getMaximalLsr(const XLikelySubtags &likelySubtags, const Locale &locale,
+                      UErrorCode &errorCode);
+
+private:
+    struct Entry : public UMemory {
+        CharString key;
+        int32_t suppIndex = -1;
+        LSR lsr;
+        Entry *prev = nullptr;
+        Entry *next = nullptr;
+    };
+
+    struct Shard {
+        UHashtable *map = nullptr;  // key -> Entry *, aliases the entries' keys
+        Entry *first = nullptr;  // most recently used
+        Entry *last = nullptr;
+        int32_t length = 0;
+    };
+
+    static int32_t getShardIndex(const char *key, int32_t length) {
+        return (int32_t)((uint32_t)ustr_hashCharsN(key, length) % MATCHER_CACHE_SHARDS);
+    }
+
+    static void closeShard(Shard &shard);
+
+    /** Must be called with the shard lock held. Moves a found entry to the front. */
+    Entry *get(Shard &shard, const char *key);
+    /** Must be called with the shard lock held. Adopts the entry. */
+    void put(Shard &shard, Entry *entry);
+
+    Shard lists[MATCHER_CACHE_SHARDS];
+    Shard lsrs[MATCHER_CACHE_SHARDS];
+    int32_t shardCapacity;
+};
+
+LocaleMatcherCache::LocaleMatcherCache(int32_t cacheSize, UErrorCode &errorCode) :
+        // Round up without overflow for cacheSize near INT32_MAX; at least 1 per shard.
+        shardCapacity(cacheSize > MATCHER_CACHE_SHARDS ?
+                      cacheSize / MATCHER_CACHE_SHARDS + (cacheSize % MATCHER_CACHE_SHARDS != 0) : 1) {
+    for (int32_t i = 0; i < MATCHER_CACHE_SHARDS; ++i) {
+        lists[i].map = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+        lsrs[i].map = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+    }
+}
+
+LocaleMatcherCache::~LocaleMatcherCache() {
+    for (int32_t i = 0; i < MATCHER_CACHE_SHARDS; ++i) {
+        closeShard(lists[i]);
+        closeShard(lsrs[i]);
+    }
+}
+
+void LocaleMatcherCache::closeShard(Shard &shard) {
+    uhash_close(shard.map);
+    Entry *entry = shard.first;
+    while (entry != nullptr) {
+        Entry *next = entry->next;
+        delete entry;
+        entry = next;
+    }
+}
+
+LocaleMatcherCache::Entry *LocaleMatcherCache::get(Shard &shard, const char *key) {
+    Entry *entry = static_cast<Entry *>(uhash_get(shard.map, key));
+    if (entry != nullptr && entry != shard.first) {
+        // Unlink, then insert at the front.
+        entry->prev->next = entry->next;
+        if (entry->next != nullptr) {
+            entry->next->prev = entry->prev;
+        } else {
+            shard.last = entry->prev;
+        }
+        entry->prev = nullptr;
+        entry->next = shard.first;
+        shard.first->prev = entry;
+        shard.first = entry;
+    }
+    return entry;
+}
+
+void LocaleMatcherCache::put(Shard &shard, Entry *entry) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    if (uhash_get(shard.map, entry->key.data()) != nullptr) {
+        // Another thread was faster.
+        delete entry;
+        return;
+    }
+    uhash_put(shard.map, const_cast<char *>(entry->key.data()), entry, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        delete entry;
+        return;
+    }
+    entry->next = shard.first;
+    if (shard.first != nullptr) {
+        shard.first->prev = entry;
+    } else {
+        shard.last = entry;
+    }
+    shard.first = entry;
+    ++shard.length;
+    // Evict the least recently used entries, but never the new one.
+    while (shard.length > shardCapacity && shard.last != entry) {
+        Entry *oldest = shard.last;
+        uhash_remove(shard.map, oldest->key.data());
+        shard.last = oldest->prev;
+        shard.last->next = nullptr;
+        --shard.length;
+        delete oldest;
+    }
+}
+
+UBool LocaleMatcherCache::getSuppIndex(StringPiece list, int32_t &suppIndex) {
+    if (list.length() > MAX_CACHED_KEY_LENGTH) { return FALSE; }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    CharString key(list, errorCode);
+    if (U_FAILURE(errorCode)) { return FALSE; }
+    int32_t i = getShardIndex(key.data(), key.length());
+    Mutex lock(&gMatcherCacheMutexes[i]);
+    Entry *entry = get(lists[i], key.data());
+    if (entry == nullptr) { return FALSE; }
+    suppIndex = entry->suppIndex;
+    return TRUE;
+}
+
+void LocaleMatcherCache::putSuppIndex(StringPiece list, int32_t suppIndex) {
+    if (list.length() > MAX_CACHED_KEY_LENGTH) { return; }
+    UErrorCode errorCode = U_ZERO_ERROR;
+    LocalPointer<Entry> entry(new Entry, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    entry->key.append(list, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    entry->suppIndex = suppIndex;
+    int32_t i = getShardIndex(entry->key.data(), entry->key.length());
+    Mutex lock(&gMatcherCacheMutexes[i]);
+    put(lists[i], entry.orphan());
+}
+
+LSR LocaleMatcherCache::getMaximalLsr(const XLikelySubtags &likelySubtags, const Locale &locale,
+                                      UErrorCode &errorCode) {
+    const char *name = locale.getName();
+    int32_t length = (int32_t)uprv_strlen(name);
+    if (U_FAILURE(errorCode) || locale.isBogus() || length == 0 || length > MAX_CACHED_KEY_LENGTH) {
+        return getMaximalLsrOrUnd(likelySubtags, locale, errorCode);
+    }
+    int32_t i = getShardIndex(name, length);
+    {
+        Mutex lock(&gMatcherCacheMutexes[i]);
+        Entry *cached = get(lsrs[i], name);
+        if (cached != nullptr) {
+            // Copy while locked: The entry may be removed as soon as the lock is released.
+            return LSR(cached->lsr, errorCode);
+        }
+    }
+    LSR lsr = getMaximalLsrOrUnd(likelySubtags, locale, errorCode);
+    if (U_FAILURE(errorCode)) { return lsr; }
+    // The maximized LSR may alias the locale's subtags. The cache needs its own copy.
+    UErrorCode cacheErrorCode = U_ZERO_ERROR;
+    LocalPointer<Entry> entry(new Entry, cacheErrorCode);
+    if (U_SUCCESS(cacheErrorCode)) {
+        entry->key.append(name, length, cacheErrorCode);
+        entry->lsr = LSR(lsr, cacheErrorCode);
+    }
+    if (U_SUCCESS(cacheErrorCode)) {
+        Mutex lock(&gMatcherCacheMutexes[i]);
+        put(lsrs[i], entry.orphan());
+    }
+    return lsr;
+}
+
+namespace {
+
+LSR getMaximalLsr(const XLikelySubtags &likelySubtags, LocaleMatcherCache *cache,
+                  const Locale &locale, UErrorCode &errorCode) {
+    if (cache != nullptr) {
+        return cache->getMaximalLsr(likelySubtags, locale, errorCode);
+    } else {
+        return getMaximalLsrOrUnd(likelySubtags, locale, errorCode);
+    }
+}
+
+}  // namespace
+
 int32_t LocaleMatcher::putIfAbsent(const LSR &lsr, int32_t i, int32_t suppLength,
                                    UErrorCode &errorCode) {
     if (U_FAILURE(errorCode)) { return suppLength; }
@@ -338,7 +550,7 @@ LocaleMatcher::LocaleMatcher(const Builder &builder, UErrorCode &errorCode) :
         supportedLocales(nullptr), lsrs(nullptr), supportedLocalesLength(0),
         supportedLsrToIndex(nullptr),
         supportedLSRs(nullptr), supportedIndexes(nullptr), supportedLSRsLength(0),
-        ownedDefaultLocale(nullptr), defaultLocale(nullptr) {
+        ownedDefaultLocale(nullptr), defaultLocale(nullptr), cache(nullptr) {
     if (U_FAILURE(errorCode)) { return; }
     if (thresholdDistance < 0) {
         thresholdDistance = localeDistance.getDefaultScriptDistance();
@@ -456,6 +668,13 @@ LocaleMatcher::LocaleMatcher(const Builder &builder, UErrorCode &errorCode) :
     if (builder.demotion_ == ULOCMATCH_DEMOTION_REGION) {
         demotionPerDesiredLocale = localeDistance.getDefaultDemotionPerDesiredLocale();
     }
+
+    if (builder.cacheSize_ > 0) {
+        cache = new LocaleMatcherCache(builder.cacheSize_, errorCode);
+        if (cache == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
 }
 
 LocaleMatcher::LocaleMatcher(LocaleMatcher &&src) U_NOEXCEPT :
@@ -470,7 +689,8 @@ LocaleMatcher::LocaleMatcher(LocaleMatcher &&src) U_NOEXCEPT :
         supportedLSRs(src.supportedLSRs),
         supportedIndexes(src.supportedIndexes),
         supportedLSRsLength(src.supportedLSRsLength),
-        ownedDefaultLocale(src.ownedDefaultLocale), defaultLocale(src.defaultLocale) {
+        ownedDefaultLocale(src.ownedDefaultLocale), defaultLocale(src.defaultLocale),
+        cache(src.cache) {
     src.supportedLocales = nullptr;
     src.lsrs = nullptr;
     src.supportedLocalesLength = 0;
@@ -480,6 +700,7 @@ LocaleMatcher::LocaleMatcher(LocaleMatcher &&src) U_NOEXCEPT :
     src.supportedLSRsLength = 0;
     src.ownedDefaultLocale = nullptr;
     src.defaultLocale = nullptr;
+    src.cache = nullptr;
 }
 
 LocaleMatcher::~LocaleMatcher() {
@@ -492,6 +713,7 @@ LocaleMatcher::~LocaleMatcher() {
     uprv_free(supportedLSRs);
     uprv_free(supportedIndexes);
     delete ownedDefaultLocale;
+    delete cache;
 }
 
 LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) U_NOEXCEPT {
@@ -509,6 +731,7 @@ LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) U_NOEXCEPT {
     supportedLSRsLength = src.supportedLSRsLength;
     ownedDefaultLocale = src.ownedDefaultLocale;
     defaultLocale = src.defaultLocale;
+    cache = src.cache;
 
     src.supportedLocales = nullptr;
     src.lsrs = nullptr;
@@ -519,14 +742,15 @@ LocaleMatcher &LocaleMatcher::operator=(LocaleMatcher &&src) U_NOEXCEPT {
     src.supportedLSRsLength = 0;
     src.ownedDefaultLocale = nullptr;
     src.defaultLocale = nullptr;
+    src.cache = nullptr;
     return *this;
 }
 
 class LocaleLsrIterator {
 public:
-    LocaleLsrIterator(const XLikelySubtags &likelySubtags, Locale::Iterator &locales,
-                      ULocMatchLifetime lifetime) :
-            likelySubtags(likelySubtags), locales(locales), lifetime(lifetime) {}
+    LocaleLsrIterator(const XLikelySubtags &likelySubtags, LocaleMatcherCache *cache,
+                      Locale::Iterator &locales, ULocMatchLifetime lifetime) :
+            likelySubtags(likelySubtags), cache(cache), locales(locales), lifetime(lifetime) {}
 
     ~LocaleLsrIterator() {
         if (lifetime == ULOCMATCH_TEMPORARY_LOCALES) {
@@ -540,7 +764,7 @@ class LocaleLsrIterator {
 
     LSR next(UErrorCode &errorCode) {
         current = &locales.next();
-        return getMaximalLsrOrUnd(likelySubtags, *current, errorCode);
+        return getMaximalLsr(likelySubtags, cache, *current, errorCode);
     }
 
     void rememberCurrent(int32_t desiredIndex, UErrorCode &errorCode) {
@@ -570,6 +794,7 @@ class LocaleLsrIterator {
 
 private:
     const XLikelySubtags &likelySubtags;
+    LocaleMatcherCache *cache;
     Locale::Iterator &locales;
     ULocMatchLifetime lifetime;
     const Locale *current = nullptr, *remembered = nullptr;
@@ -579,7 +804,7 @@ class LocaleLsrIterator {
 const Locale *LocaleMatcher::getBestMatch(const Locale &desiredLocale, UErrorCode &errorCode) const {
     if (U_FAILURE(errorCode)) { return nullptr; }
     int32_t suppIndex = getBestSuppIndex(
-        getMaximalLsrOrUnd(likelySubtags, desiredLocale, errorCode),
+        getMaximalLsr(likelySubtags, cache, desiredLocale, errorCode),
         nullptr, errorCode);
     return U_SUCCESS(errorCode) && suppIndex >= 0 ? supportedLocales[suppIndex] : defaultLocale;
 }
@@ -590,16 +815,33 @@ const Locale *LocaleMatcher::getBestMatch(Locale::Iterator &desiredLocales,
     if (!desiredLocales.hasNext()) {
         return defaultLocale;
     }
-    LocaleLsrIterator lsrIter(likelySubtags, desiredLocales, ULOCMATCH_TEMPORARY_LOCALES);
+    LocaleLsrIterator lsrIter(likelySubtags, cache, desiredLocales, ULOCMATCH_TEMPORARY_LOCALES);
     int32_t suppIndex = getBestSuppIndex(lsrIter.next(errorCode), &lsrIter, errorCode);
     return U_SUCCESS(errorCode) && suppIndex >= 0 ? supportedLocales[suppIndex] : defaultLocale;
 }
 
 const Locale *LocaleMatcher::getBestMatchForListString(
         StringPiece desiredLocaleList, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    int32_t suppIndex;
+    if (cache != nullptr && cache->getSuppIndex(desiredLocaleList, suppIndex)) {
+        return suppIndex >= 0 ? supportedLocales[suppIndex] : defaultLocale;
+    }
     LocalePriorityList list(desiredLocaleList, errorCode);
     LocalePriorityList::Iterator iter = list.iterator();
-    return getBestMatch(iter, errorCode);
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    if (!iter.hasNext()) {
+        suppIndex = -1;
+    } else {
+        // The list outlives the iterator, so the matcher need not copy the best desired locale.
+        LocaleLsrIterator lsrIter(likelySubtags, cache, iter, ULOCMATCH_STORED_LOCALES);
+        suppIndex = getBestSuppIndex(lsrIter.next(errorCode), &lsrIter, errorCode);
+        if (U_FAILURE(errorCode)) { return defaultLocale; }
+    }
+    if (cache != nullptr) {
+        cache->putSuppIndex(desiredLocaleList, suppIndex);
+    }
+    return suppIndex >= 0 ? supportedLocales[suppIndex] : defaultLocale;
 }
 
 LocaleMatcher::Result LocaleMatcher::getBestMatchResult(
@@ -608,7 +850,7 @@ LocaleMatcher::Result LocaleMatcher::getBestMatchResult(
         return Result(nullptr, defaultLocale, -1, -1, FALSE);
     }
     int32_t suppIndex = getBestSuppIndex(
-        getMaximalLsrOrUnd(likelySubtags, desiredLocale, errorCode),
+        getMaximalLsr(likelySubtags, cache, desiredLocale, errorCode),
         nullptr, errorCode);
     if (U_FAILURE(errorCode) || suppIndex < 0) {
         return Result(nullptr, defaultLocale, -1, -1, FALSE);
@@ -622,7 +864,7 @@ LocaleMatcher::Result LocaleMatcher::getBestMatchResult(
     if (U_FAILURE(errorCode) || !desiredLocales.hasNext()) {
         return Result(nullptr, defaultLocale, -1, -1, FALSE);
     }
-    LocaleLsrIterator lsrIter(likelySubtags, desiredLocales, ULOCMATCH_TEMPORARY_LOCALES);
+    LocaleLsrIterator lsrIter(likelySubtags, cache, desiredLocales, ULOCMATCH_TEMPORARY_LOCALES);
     int32_t suppIndex = getBestSuppIndex(lsrIter.next(errorCode), &lsrIter, errorCode);
     if (U_FAILURE(errorCode) || suppIndex < 0) {
         return Result(nullptr, defaultLocale, -1, -1, FALSE);
@@ -31,6 +31,25 @@ LSR::LSR(char prefix, const char *lang, const char *scr, const char *r, int32_t
     }
 }
 
+LSR::LSR(const LSR &other, UErrorCode &errorCode) :
+        language(""), script(""), region(""),
+        regionIndex(other.regionIndex), flags(other.flags), hashCode(other.hashCode) {
+    if (U_SUCCESS(errorCode)) {
+        CharString subtags;
+        subtags.append(other.language, errorCode).append('\0', errorCode);
+        int32_t scriptOffset = subtags.length();
+        subtags.append(other.script, errorCode).append('\0', errorCode);
+        int32_t regionOffset = subtags.length();
+        subtags.append(other.region, errorCode);
+        owned = subtags.cloneData(errorCode);
+        if (U_SUCCESS(errorCode)) {
+            language = owned;
+            script = owned + scriptOffset;
+            region = owned + regionOffset;
+        }
+    }
+}
+
 LSR::LSR(LSR &&other) U_NOEXCEPT :
         language(other.language), script(other.script), region(other.region), owned(other.owned),
         regionIndex(other.regionIndex), flags(other.flags),
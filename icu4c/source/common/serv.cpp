@@ -204,7 +204,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(ServiceListener)
 // even if we succeed later with a different id.
 class CacheEntry : public UMemory {
 private:
-    int32_t refcount;
+    mutable u_atomic_int32_t refcount;
 
 public:
     UnicodeString actualDescriptor;
@@ -228,7 +228,7 @@ class CacheEntry : public UMemory {
     * Return true if the resource has not already been released.
     */
     CacheEntry* ref() {
-        ++refcount;
+        umtx_atomic_inc(&refcount);
         return this;
     }
 
@@ -240,7 +240,7 @@ class CacheEntry : public UMemory {
     * false if the resouce has been released.
     */
     CacheEntry* unref() {
-        if ((--refcount) == 0) {
+        if (umtx_atomic_dec(&refcount) == 0) {
             delete this;
             return NULL;
         }
@@ -252,7 +252,7 @@ class CacheEntry : public UMemory {
     * resource has not been released.
     */
     UBool isShared() const {
-        return refcount > 1;
+        return umtx_loadAcquire(refcount) > 1;
     }
 };
 
@@ -289,6 +289,127 @@ class DNCache : public UMemory {
 };
 
 
+/*
+******************************************************************
+*/
+
+// A read-only copy of the service cache.  Once published, a snapshot
+// is never modified, so getKey can search it without the factory lock.
+class ServiceCacheSnapshot : public UMemory {
+public:
+    Hashtable cache;
+    ServiceCacheSnapshot* nextRetired;
+
+    ServiceCacheSnapshot(UErrorCode& status)
+        : cache(status), nextRetired(NULL)
+    {
+        if (U_SUCCESS(status)) {
+            cache.setValueDeleter(cacheDeleter);
+        }
+    }
+};
+
+// The published snapshot of the service cache, plus the snapshots it
+// replaced.  Lookups count themselves in readers before loading the
+// published pointer and until they are done with the snapshot.  Replaced
+// snapshots are deleted by whoever sees no readers: the writer that
+// replaces one, or the last reader to leave.
+// Writers are serialized by snapshotLock rather than the factory lock,
+// since clearServiceCache is called without the latter.
+static UMutex snapshotLock;
+
+class ServiceCacheSnapshots : public UMemory {
+public:
+    std::atomic<ServiceCacheSnapshot*> published;
+    u_atomic_int32_t readers;
+
+    ServiceCacheSnapshots()
+        : published(NULL), readers(0), retiredCount(0), retired(NULL),
+          publishedCount(0), misses(0) {}
+
+    ~ServiceCacheSnapshots() {
+        // the service is being destroyed, so there are no more readers
+        publish(NULL);
+        deleteRetired();
+    }
+
+    void publish(ServiceCacheSnapshot* snapshot) {
+        Mutex mutex(&snapshotLock);
+        ServiceCacheSnapshot* old = published.exchange(snapshot);
+        publishedCount = snapshot != NULL ? snapshot->cache.count() : 0;
+        misses = 0;
+        if (old != NULL) {
+            old->nextRetired = retired;
+            retired = old;
+            umtx_atomic_inc(&retiredCount);
+        }
+        if (retired != NULL && readers.load() == 0) {
+            deleteRetired();
+        }
+    }
+
+    // Called by a reader after it decremented readers to zero.
+    void reclaim() {
+        if (umtx_loadAcquire(retiredCount) > 0) {
+            Mutex mutex(&snapshotLock);
+            if (readers.load() == 0) {
+                deleteRetired();
+            }
+        }
+    }
+
+    // Counts a lookup that the published snapshot could not answer.
+    // Returns TRUE when the misses since the last publish amount to more
+    // than a quarter of the published entries: Publishing a copy of the
+    // cache only then, rather than on every miss, copies each entry a
+    // bounded number of times while the cache warms up.
+    UBool countMiss() {
+        Mutex mutex(&snapshotLock);
+        return ++misses > publishedCount / 4;
+    }
+
+private:
+    u_atomic_int32_t retiredCount;
+    ServiceCacheSnapshot* retired;
+    int32_t publishedCount;
+    int32_t misses;
+
+    void deleteRetired() {
+        while (retired != NULL) {
+            ServiceCacheSnapshot* next = retired->nextRetired;
+            delete retired;
+            retired = next;
+        }
+        umtx_storeRelease(retiredCount, 0);
+    }
+};
+
+// Publish a copy of the service cache, see countMiss().  If the copy cannot
+// be made, the old snapshot stays published; it only lacks the newest entries.
+static void
+publishServiceCacheAfterMiss(ServiceCacheSnapshots* snapshots, const Hashtable& serviceCache)
+{
+    if (!snapshots->countMiss()) {
+        return;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    ServiceCacheSnapshot* snapshot = new ServiceCacheSnapshot(status);
+    if (snapshot == NULL) {
+        return;
+    }
+    int32_t pos = UHASH_FIRST;
+    const UHashElement* element;
+    while (U_SUCCESS(status) && (element = serviceCache.nextElement(pos)) != NULL) {
+        CacheEntry* entry = (CacheEntry*)element->value.pointer;
+        snapshot->cache.put(*(const UnicodeString*)element->key.pointer, entry->ref(), status);
+    }
+    if (U_FAILURE(status)) {
+        delete snapshot;
+        return;
+    }
+    snapshots->publish(snapshot);
+}
+
 /*
 ******************************************************************
 */
@@ -342,6 +463,7 @@ ICUService::ICUService()
 , serviceCache(NULL)
 , idCache(NULL)
 , dnCache(NULL)
+, cacheSnapshots(new ServiceCacheSnapshots())
 {
 }
 
@@ -352,6 +474,7 @@ ICUService::ICUService(const UnicodeString& newName)
 , serviceCache(NULL)
 , idCache(NULL)
 , dnCache(NULL)
+, cacheSnapshots(new ServiceCacheSnapshots())
 {
 }
 
@@ -362,6 +485,8 @@ ICUService::~ICUService()
         clearCaches();
         delete factories;
         factories = NULL;
+        delete cacheSnapshots;
+        cacheSnapshots = NULL;
     }
 }
 
@@ -398,6 +523,29 @@ ICUService::getKey(ICUServiceKey& key, UnicodeString* actualReturn, UErrorCode&
     return getKey(key, actualReturn, NULL, status);
 }
 
+// Set actualReturn, if any, to the descriptor that matched the entry.
+static UBool
+copyActualDescriptor(const CacheEntry& entry, UnicodeString* actualReturn, UErrorCode& status)
+{
+    if (actualReturn != NULL) {
+        // strip null prefix
+        if (entry.actualDescriptor.indexOf((UChar)0x2f) == 0) { // U+002f=slash (/)
+            actualReturn->remove();
+            actualReturn->append(entry.actualDescriptor, 
+                1, 
+                entry.actualDescriptor.length() - 1);
+        } else {
+            *actualReturn = entry.actualDescriptor;
+        }
+
+        if (actualReturn->isBogus()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
 // make it possible to call reentrantly on systems that don't have reentrant mutexes.
 // we can use this simple approach since we know the situation where we're calling
 // reentrantly even without knowing the thread.
@@ -436,6 +584,31 @@ ICUService::getKey(ICUServiceKey& key, UnicodeString* actualReturn, const ICUSer
         return handleDefault(key, actualReturn, status);
     }
 
+    if (factory == NULL && cacheSnapshots != NULL) {
+        // Most lookups are for descriptors that are already cached.
+        // Search the published snapshot of the cache without the factory
+        // lock; on a miss, fall through to the synchronized lookup.
+        UnicodeString currentDescriptor;
+        key.currentDescriptor(currentDescriptor);
+
+        umtx_atomic_inc(&cacheSnapshots->readers);
+        const ServiceCacheSnapshot* snapshot = cacheSnapshots->published.load();
+        const CacheEntry* entry = NULL;
+        UObject* service = NULL;
+        if (snapshot != NULL) {
+            entry = (const CacheEntry*)snapshot->cache.get(currentDescriptor);
+            if (entry != NULL && copyActualDescriptor(*entry, actualReturn, status)) {
+                service = cloneInstance(entry->service);
+            }
+        }
+        if (umtx_atomic_dec(&cacheSnapshots->readers) == 0) {
+            cacheSnapshots->reclaim();
+        }
+        if (entry != NULL) {
+            return service;
+        }
+    }
+
     ICUService* ncthis = (ICUService*)this; // cast away semantic const
 
     CacheEntry* result = NULL;
@@ -491,6 +664,10 @@ ICUService::getKey(ICUServiceKey& key, UnicodeString* actualReturn, const ICUSer
             key.currentDescriptor(currentDescriptor);
             result = (CacheEntry*)serviceCache->get(currentDescriptor);
             if (result != NULL) {
+                if (!putInCache && factory == NULL && cacheSnapshots != NULL) {
+                    // cached, but not yet in the published snapshot
+                    publishServiceCacheAfterMiss(cacheSnapshots, *serviceCache);
+                }
                 break;
             }
 
@@ -563,24 +740,15 @@ ICUService::getKey(ICUServiceKey& key, UnicodeString* actualReturn, const ICUSer
                         cacheDescriptorList._obj->removeElementAt(i);
                     }
                 }
-            }
 
-            if (actualReturn != NULL) {
-                // strip null prefix
-                if (result->actualDescriptor.indexOf((UChar)0x2f) == 0) { // U+002f=slash (/)
-                    actualReturn->remove();
-                    actualReturn->append(result->actualDescriptor, 
-                        1, 
-                        result->actualDescriptor.length() - 1);
-                } else {
-                    *actualReturn = result->actualDescriptor;
+                if (cacheSnapshots != NULL) {
+                    publishServiceCacheAfterMiss(cacheSnapshots, *serviceCache);
                 }
+            }
 
-                if (actualReturn->isBogus()) {
-                    status = U_MEMORY_ALLOCATION_ERROR;
-                    delete result;
-                    return NULL;
-                }
+            if (!copyActualDescriptor(*result, actualReturn, status)) {
+                delete result;
+                return NULL;
             }
 
             UObject* service = cloneInstance(result->service);
@@ -937,6 +1105,9 @@ ICUService::clearCaches()
     delete idCache;
     idCache = NULL;
     delete serviceCache; serviceCache = NULL;
+    if (cacheSnapshots != NULL) {
+        cacheSnapshots->publish(NULL);
+    }
 }
 
 void 
@@ -944,6 +1115,9 @@ ICUService::clearServiceCache()
 {
     // callers synchronize before use
     delete serviceCache; serviceCache = NULL;
+    if (cacheSnapshots != NULL) {
+        cacheSnapshots->publish(NULL);
+    }
 }
 
 UBool 
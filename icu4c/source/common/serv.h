@@ -45,6 +45,7 @@ class ServiceListener;
 class ICUService;
 
 class DNCache;
+class ServiceCacheSnapshots;
 
 /*******************************************************************
  * ICUServiceKey
@@ -557,6 +558,12 @@ class U_COMMON_API ICUService : public ICUNotifier {
      */
     DNCache* dnCache;
 
+    /**
+     * Read-only copies of the service cache that getKey can search
+     * without acquiring the factory lock.
+     */
+    ServiceCacheSnapshots* cacheSnapshots;
+
     /**
      * Constructor.
      */
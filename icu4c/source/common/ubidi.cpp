@@ -26,6 +26,8 @@
 #include "ubidi_props.h"
 #include "ubidiimp.h"
 #include "uassert.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
 
 /*
  * General implementation notes:
@@ -416,6 +418,33 @@ checkParaCount(UBiDi *pBiDi) {
     return TRUE;
 }
 
+/*
+ * Directional properties of the characters before the Hebrew block.
+ * None of them is R, AL or AN, or an explicit embedding or isolate control,
+ * so that text with only such characters is not mixed-directional
+ * unless the paragraph level is odd.
+ * getDirProps() looks them up here, rather than in the trie one at a time,
+ * when there is no custom class callback.
+ */
+#define DIRPROPS_FAST_LIMIT 0x590
+
+static DirProp gFastDirProps[DIRPROPS_FAST_LIMIT];
+static icu::UInitOnce gFastDirPropsInitOnce = U_INITONCE_INITIALIZER;
+
+static UBool U_CALLCONV
+ubidi_cleanup() {
+    gFastDirPropsInitOnce.reset();
+    return TRUE;
+}
+
+static void U_CALLCONV
+initFastDirProps() {
+    for(UChar32 c=0; c<DIRPROPS_FAST_LIMIT; ++c) {
+        gFastDirProps[c]=(DirProp)ubidi_getClass(c);
+    }
+    ucln_common_registerCleanup(UCLN_COMMON_UBIDI, ubidi_cleanup);
+}
+
 /*
  * Get the directional properties for the text, calculate the flags bit-set, and
  * determine the paragraph level if necessary (in pBiDi->paras[i].level).
@@ -486,6 +515,11 @@ getDirProps(UBiDi *pBiDi) {
         pBiDi->paras[0].level=pBiDi->paraLevel;
         state=NOT_SEEKING_STRONG;
     }
+    const DirProp *fastDirProps=NULL;
+    if(pBiDi->fnClassCallback==NULL && !isDefaultLevelInverse) {
+        umtx_initOnce(gFastDirPropsInitOnce, &initFastDirProps);
+        fastDirProps=gFastDirProps;
+    }
     /* count paragraphs and determine the paragraph level (P2..P3) */
     /*
      * see comment in ubidi.h:
@@ -493,6 +527,23 @@ getDirProps(UBiDi *pBiDi) {
      * their bit 0 alone yields the intended default
      */
     for( /* i=0 above */ ; i<originalLength; ) {
+        if(fastDirProps!=NULL) {
+            /*
+             * Fast loop over characters before the Hebrew block, except for
+             * paragraph separators, and except for L while seeking a strong character.
+             * Nothing else needs to be done for them.
+             * lastStrong is not updated: It is only used for inverse BiDi.
+             */
+            while(i<originalLength && (uchar=text[i])<DIRPROPS_FAST_LIMIT &&
+                    (dirProp=fastDirProps[uchar])!=B &&
+                    (dirProp!=L || state==NOT_SEEKING_STRONG || state==LOOKING_FOR_PDI)) {
+                flags|=DIRPROP_FLAG(dirProp);
+                dirProps[i++]=dirProp;
+            }
+            if(i==originalLength) {
+                break;
+            }
+        }
         /* i is incremented by U16_NEXT */
         U16_NEXT(text, i, originalLength, uchar);
         flags|=DIRPROP_FLAG(dirProp=(DirProp)ubidi_getCustomizedClass(pBiDi, uchar));
@@ -387,6 +387,90 @@ ubidi_getVisualRun(UBiDi *pBiDi, int32_t runIndex,
     return (UBiDiDirection)GET_ODD_BIT(start);
 }
 
+U_CAPI int32_t U_EXPORT2
+ubidi_setParas(UBiDi *pBiDi,
+               const UChar *const *texts, const int32_t *lengths, int32_t count,
+               UBiDiLevel paraLevel,
+               UBiDiLevel *levels, int32_t levelsCapacity,
+               UBiDiVisualRun *runs, int32_t runsCapacity, int32_t *runLimits,
+               UErrorCode *pErrorCode) {
+    RETURN_IF_NULL_OR_FAILING_ERRCODE(pErrorCode, 0);
+    if(pBiDi==NULL || count<0 || (count>0 && (texts==NULL || runLimits==NULL)) ||
+       (levels==NULL ? levelsCapacity!=0 : levelsCapacity<0) ||
+       (runs==NULL ? runsCapacity!=0 : runsCapacity<0) ||
+       (pBiDi->reorderingOptions&UBIDI_OPTION_STREAMING)!=0) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t levelsLength=0, runCount=0;
+    UBool overflow=FALSE;
+    for(int32_t i=0; i<count; ++i) {
+        ubidi_setPara(pBiDi, texts[i], lengths!=NULL ? lengths[i] : -1,
+                      paraLevel, NULL, pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+        int32_t length=pBiDi->length;
+        if(length==0) {
+            runLimits[i]=runCount;
+            continue;
+        }
+        /*
+         * A paragraph that is not mixed-directional has all levels at paraLevel
+         * and, without BiDi controls to remove and marks to insert, a single run.
+         * Write them directly, without setting up the levels and runs arrays.
+         */
+        UBool isSingleLevel=pBiDi->direction!=UBIDI_MIXED && pBiDi->trailingWSStart==0;
+        UBool isSingleRun=isSingleLevel &&
+                          pBiDi->controlCount==0 && pBiDi->insertPoints.size==0;
+        if(levels!=NULL) {
+            if(length<=(levelsCapacity-levelsLength)) {
+                if(isSingleLevel) {
+                    uprv_memset(levels+levelsLength, pBiDi->paraLevel, length);
+                } else {
+                    const UBiDiLevel *paraLevels=ubidi_getLevels(pBiDi, pErrorCode);
+                    if(U_FAILURE(*pErrorCode)) {
+                        return 0;
+                    }
+                    uprv_memcpy(levels+levelsLength, paraLevels, length);
+                }
+            } else {
+                overflow=TRUE;
+            }
+            levelsLength+=length;
+        }
+        int32_t paraRunCount;
+        if(isSingleRun) {
+            paraRunCount=1;
+        } else {
+            paraRunCount=ubidi_countRuns(pBiDi, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return 0;
+            }
+        }
+        if(paraRunCount<=(runsCapacity-runCount)) {
+            UBiDiVisualRun *paraRuns=runs+runCount;
+            if(isSingleRun) {
+                paraRuns->logicalStart=0;
+                paraRuns->length=length;
+                paraRuns->direction=(UBiDiDirection)(pBiDi->paraLevel&1);
+            } else {
+                for(int32_t j=0; j<paraRunCount; ++j) {
+                    paraRuns[j].direction=ubidi_getVisualRun(pBiDi, j, &paraRuns[j].logicalStart,
+                                                             &paraRuns[j].length);
+                }
+            }
+        } else {
+            overflow=TRUE;
+        }
+        runLimits[i]=runCount+=paraRunCount;
+    }
+    if(overflow) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return runCount;
+}
+
 /* in trivial cases there is only one trivial run; called by ubidi_getRuns() */
 static void
 getSingleRun(UBiDi *pBiDi, UBiDiLevel level) {
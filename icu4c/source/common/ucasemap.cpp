@@ -197,6 +197,108 @@ utf8_caseContextIterator(void *context, int8_t dir) {
     return U_SENTINEL;
 }
 
+// Eight ASCII bytes are processed at a time as one 64-bit word.
+// Byte-wise additions of values up to 0x80 to bytes <=0x7f do not carry into the next byte,
+// so the results are independent of the platform endianness.
+const uint64_t ASCII_ONES = 0x0101010101010101;
+const uint64_t ASCII_HIGH_BITS = 0x8080808080808080;
+
+inline uint64_t loadWord(const uint8_t *p) {
+    uint64_t word;
+    uprv_memcpy(&word, p, 8);
+    return word;
+}
+
+/**
+ * Returns the high bit (0x80) set in each byte of the all-ASCII word
+ * whose value is in [lo..hi].
+ */
+inline uint64_t asciiRangeBits(uint64_t word, uint8_t lo, uint8_t hi) {
+    uint64_t geLo = word + ASCII_ONES * (0x80 - lo);
+    uint64_t gtHi = word + ASCII_ONES * (0x7f - hi);
+    return geLo & ~gtHi & ASCII_HIGH_BITS;
+}
+
+/**
+ * Case-maps the run of ASCII characters that starts at src[srcIndex],
+ * for mappings where exactly the letters in [lo..hi] change, by toggling bit 0x20
+ * (A-Z in lowercasing and default case folding, a-z in uppercasing),
+ * and there are no special cases among ASCII characters.
+ *
+ * Scans the run eight bytes at a time. If nothing changes, then the run is left
+ * in the pending unchanged text starting at prev.
+ * Otherwise appends the pending unchanged text, writes the mapped rest of the run
+ * into the sink's append buffer in bulk, and sets prev to the run limit.
+ * Records the same Edits as mapping one character at a time.
+ * Must not be used with U_OMIT_UNCHANGED_TEXT.
+ *
+ * @return the run limit
+ */
+int32_t mapASCIIRun(const uint8_t *src, int32_t &prev, int32_t srcIndex, int32_t srcLimit,
+                    uint8_t lo, uint8_t hi,
+                    ByteSink &sink, uint32_t options, Edits *edits, UErrorCode &errorCode) {
+    int32_t limit = srcIndex;
+    int32_t firstChange = -1;
+    while ((limit + 8) <= srcLimit) {
+        uint64_t word = loadWord(src + limit);
+        if ((word & ASCII_HIGH_BITS) != 0) { break; }
+        if (firstChange < 0 && asciiRangeBits(word, lo, hi) != 0) { firstChange = limit; }
+        limit += 8;
+    }
+    uint8_t b;
+    while (limit < srcLimit && (b = src[limit]) <= 0x7f) {
+        if (firstChange < 0 && lo <= b && b <= hi) { firstChange = limit; }
+        ++limit;
+    }
+    if (firstChange < 0) { return limit; }
+    ByteSinkUtil::appendUnchanged(src + prev, firstChange - prev,
+                                  sink, options, edits, errorCode);
+    char scratch[256];
+    for (int32_t start = firstChange; start < limit;) {
+        int32_t capacity;
+        char *dest = sink.GetAppendBuffer(1, limit - start, scratch, UPRV_LENGTHOF(scratch), &capacity);
+        int32_t length = limit - start < capacity ? limit - start : capacity;
+        const uint8_t *s = src + start;
+        int32_t i = 0;
+        for (; (i + 8) <= length; i += 8) {
+            uint64_t word = loadWord(s + i);
+            word ^= asciiRangeBits(word, lo, hi) >> 2;
+            uprv_memcpy(dest + i, &word, 8);
+        }
+        for (; i < length; ++i) {
+            b = s[i];
+            dest[i] = (char)((lo <= b && b <= hi) ? (b ^ 0x20) : b);
+        }
+        sink.Append(dest, length);
+        if (edits != nullptr) {
+            // Unchanged spans in bulk, and one 1:1 replacement per changed letter.
+            int32_t unchanged = 0;
+            for (i = 0; i < length;) {
+                if ((i + 8) <= length && asciiRangeBits(loadWord(s + i), lo, hi) == 0) {
+                    unchanged += 8;
+                    i += 8;
+                } else if (dest[i] == (char)s[i]) {
+                    ++unchanged;
+                    ++i;
+                } else {
+                    if (unchanged > 0) {
+                        edits->addUnchanged(unchanged);
+                        unchanged = 0;
+                    }
+                    edits->addReplace(1, 1);
+                    ++i;
+                }
+            }
+            if (unchanged > 0) {
+                edits->addUnchanged(unchanged);
+            }
+        }
+        start += length;
+    }
+    prev = limit;
+    return limit;
+}
+
 /**
  * caseLocale >= 0: Lowercases [srcStart..srcLimit[ but takes context [0..srcLength[ into account.
  * caseLocale < 0: Case-folds [srcStart..srcLimit[.
@@ -213,6 +315,9 @@ void toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
+    // The normal mappings change only A-Z in ASCII.
+    UBool asciiRuns = latinToLower == LatinCase::TO_LOWER_NORMAL &&
+        (options & U_OMIT_UNCHANGED_TEXT) == 0;
     const UTrie2 *trie = ucase_getTrie();
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
@@ -227,6 +332,11 @@ void toLower(int32_t caseLocale, uint32_t options,
             }
             uint8_t lead = src[srcIndex++];
             if (lead <= 0x7f) {
+                if (asciiRuns) {
+                    srcIndex = mapASCIIRun(src, prev, srcIndex - 1, srcLimit, 'A', 'Z',
+                                           sink, options, edits, errorCode);
+                    continue;
+                }
                 int8_t d = latinToLower[lead];
                 if (d == LatinCase::EXC) {
                     cpStart = srcIndex - 1;
@@ -321,6 +431,9 @@ void toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
+    // The normal mappings change only a-z in ASCII.
+    UBool asciiRuns = latinToUpper == LatinCase::TO_UPPER_NORMAL &&
+        (options & U_OMIT_UNCHANGED_TEXT) == 0;
     const UTrie2 *trie = ucase_getTrie();
     int32_t prev = 0;
     int32_t srcIndex = 0;
@@ -335,6 +448,11 @@ void toUpper(int32_t caseLocale, uint32_t options,
             }
             uint8_t lead = src[srcIndex++];
             if (lead <= 0x7f) {
+                if (asciiRuns) {
+                    srcIndex = mapASCIIRun(src, prev, srcIndex - 1, srcLength, 'a', 'z',
+                                           sink, options, edits, errorCode);
+                    continue;
+                }
                 int8_t d = latinToUpper[lead];
                 if (d == LatinCase::EXC) {
                     cpStart = srcIndex - 1;
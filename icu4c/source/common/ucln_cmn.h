@@ -49,6 +49,7 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_USET,
     UCLN_COMMON_UNAMES,
     UCLN_COMMON_UPROPS,
+    UCLN_COMMON_UBIDI,
     UCLN_COMMON_UCNV,
     UCLN_COMMON_UCNV_IO,
     UCLN_COMMON_UDATA,
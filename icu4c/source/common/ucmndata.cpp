@@ -166,6 +166,27 @@ offsetTOCPrefixBinarySearch(const char *s, const char *names,
     return -1;
 }
 
+/*
+ * Look up the name via the hash index, see ucmndata.h.
+ * The index was checked in offsetTOCFindIndex().
+ */
+static int32_t
+offsetTOCIndexLookup(const char *s, const char *names,
+                     const UDataOffsetTOCEntry *toc, const int32_t *indexes) {
+    int32_t bucketCount=indexes[UDATA_TOC_INDEX_IX_BUCKET_COUNT];
+    int32_t slotCount=indexes[UDATA_TOC_INDEX_IX_SLOT_COUNT];
+    const uint16_t *seeds=(const uint16_t *)(indexes+indexes[UDATA_TOC_INDEX_IX_INDEXES_LENGTH]);
+    const uint16_t *slots=seeds+bucketCount;
+    uint32_t hash=udata_hashTOCName(s, (uint32_t)indexes[UDATA_TOC_INDEX_IX_HASH_SEED]);
+    uint16_t seed=seeds[udata_getTOCIndexSlot(hash, 0, bucketCount)];
+    int32_t number=slots[udata_getTOCIndexSlot(hash, seed, slotCount)];
+    if(number<indexes[UDATA_TOC_INDEX_IX_ITEM_COUNT] && uprv_strcmp(s, names+toc[number].nameOffset)==0) {
+        return number;
+    } else {
+        return -1;
+    }
+}
+
 static int32_t
 pointerTOCPrefixBinarySearch(const char *s, const PointerTOCEntry *toc, int32_t count) {
     int32_t start=0;
@@ -240,14 +261,22 @@ offsetTOCLookupFn(const UDataMemory *pData,
             fprintf(stderr, "\tx%d: %s\n", number, &base[toc->entry[number].nameOffset]);
         }
 #endif
-        number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        if(pData->tocIndex!=NULL) {
+            number=offsetTOCIndexLookup(tocEntryName, base, toc->entry, (const int32_t *)pData->tocIndex);
+        } else {
+            number=offsetTOCPrefixBinarySearch(tocEntryName, base, toc->entry, count);
+        }
         if(number>=0) {
             /* found it */
             const UDataOffsetTOCEntry *entry=toc->entry+number;
 #ifdef UDATA_DEBUG
             fprintf(stderr, "%s: Found.\n", tocEntryName);
 #endif
-            if((number+1) < count) {
+            /*
+             * The distance to the next item's data is an upper bound for this item's length.
+             * The items need not be stored in ToC order (see icupkg --hot_items).
+             */
+            if((number+1) < count && entry[1].dataOffset > entry->dataOffset) {
                 *pLength = (int32_t)(entry[1].dataOffset - entry->dataOffset);
             } else {
                 *pLength = -1;
@@ -323,6 +352,61 @@ static const commonDataFuncs ToCPFuncs = {pointerTOCLookupFn, pointerTOCEntryCou
  *                    and set the appropriate error code.               *
  *                                                                      *
  *----------------------------------------------------------------------*/
+/*
+ * Find and check the optional hash index item of a "CmnD" package, see ucmndata.h.
+ * Its name has the same package prefix as the first ToC entry.
+ * Returns NULL if there is no usable index.
+ */
+static const int32_t *
+offsetTOCFindIndex(const UDataOffsetTOC *toc) {
+    const char *base=(const char *)toc;
+    int32_t count=(int32_t)toc->count;
+    if(count<=0) {
+        return NULL;
+    }
+    const char *firstName=base+toc->entry[0].nameOffset;
+    const char *sep=uprv_strchr(firstName, U_TREE_ENTRY_SEP_CHAR);
+    char name[64];
+    int32_t prefixLength;
+    if(sep==NULL ||
+            (prefixLength=(int32_t)(sep+1-firstName))+(int32_t)sizeof(UDATA_TOC_INDEX_NAME)>(int32_t)sizeof(name)) {
+        return NULL;
+    }
+    uprv_memcpy(name, firstName, prefixLength);
+    uprv_strcpy(name+prefixLength, UDATA_TOC_INDEX_NAME);
+    int32_t number=offsetTOCPrefixBinarySearch(name, base, toc->entry, count);
+    if(number<0) {
+        return NULL;
+    }
+
+    const DataHeader *pHeader=(const DataHeader *)(base+toc->entry[number].dataOffset);
+    const UDataInfo *pInfo=&pHeader->info;
+    if(!(pHeader->dataHeader.magic1==0xda &&
+        pHeader->dataHeader.magic2==0x27 &&
+        pInfo->isBigEndian==U_IS_BIG_ENDIAN &&
+        pInfo->charsetFamily==U_CHARSET_FAMILY &&
+        pInfo->dataFormat[0]==0x54 &&   /* dataFormat="ToCI" */
+        pInfo->dataFormat[1]==0x6f &&
+        pInfo->dataFormat[2]==0x43 &&
+        pInfo->dataFormat[3]==0x49 &&
+        pInfo->formatVersion[0]==1)
+    ) {
+        return NULL;
+    }
+    const int32_t *indexes=(const int32_t *)((const char *)pHeader+udata_getHeaderSize(pHeader));
+    int32_t indexesLength=indexes[UDATA_TOC_INDEX_IX_INDEXES_LENGTH];
+    if(indexesLength<UDATA_TOC_INDEX_IX_COUNT ||
+        indexes[UDATA_TOC_INDEX_IX_ITEM_COUNT]!=count ||
+        indexes[UDATA_TOC_INDEX_IX_BUCKET_COUNT]<=0 ||
+        indexes[UDATA_TOC_INDEX_IX_SLOT_COUNT]<count ||
+        (uint32_t)indexes[UDATA_TOC_INDEX_IX_CHECKSUM]!=udata_checksumTOC(toc->entry, count)
+    ) {
+        /* The package was modified without updating the index. */
+        return NULL;
+    }
+    return indexes;
+}
+
 U_CFUNC void udata_checkCommonData(UDataMemory *udm, UErrorCode *err) {
     if (U_FAILURE(*err)) {
         return;
@@ -347,6 +431,7 @@ U_CFUNC void udata_checkCommonData(UDataMemory *udm, UErrorCode *err) {
         /* dataFormat="CmnD" */
         udm->vFuncs = &CmnDFuncs;
         udm->toc=(const char *)udm->pHeader+udata_getHeaderSize(udm->pHeader);
+        udm->tocIndex=offsetTOCFindIndex((const UDataOffsetTOC *)udm->toc);
     }
     else if(udm->pHeader->info.dataFormat[0]==0x54 &&
         udm->pHeader->info.dataFormat[1]==0x6f &&
@@ -357,6 +442,7 @@ U_CFUNC void udata_checkCommonData(UDataMemory *udm, UErrorCode *err) {
         /* dataFormat="ToCP" */
         udm->vFuncs = &ToCPFuncs;
         udm->toc=(const char *)udm->pHeader+udata_getHeaderSize(udm->pHeader);
+        udm->tocIndex=NULL;
     }
     else {
         /* dataFormat not recognized */
@@ -59,6 +59,69 @@ typedef struct {
     UDataOffsetTOCEntry entry[1];
 } UDataOffsetTOC;
 
+/*
+ * Optional hash index for the ToC of a "CmnD" package, generated by icupkg --toc_index.
+ * It is stored as the package item <package name>/tocindex.idx
+ * with dataFormat="ToCI" and formatVersion 1:
+ *
+ *   int32_t indexes[indexesLength];  -- UDATA_TOC_INDEX_IX_...
+ *   uint16_t seeds[bucketCount];
+ *   uint16_t slots[slotCount];  -- ToC entry index for each hash slot, or 0xffff
+ *
+ * An item name hashes to bucket udata_getTOCIndexSlot(hash, 0, bucketCount)
+ * and then to slot udata_getTOCIndexSlot(hash, seeds[bucket], slotCount).
+ * The names in the ToC hash to distinct slots; other names hash to an unused slot
+ * or to the slot of a different name.
+ * The index is used only if its itemCount and checksum match the ToC.
+ */
+#define UDATA_TOC_INDEX_NAME "tocindex.idx"
+
+enum {
+    UDATA_TOC_INDEX_IX_INDEXES_LENGTH,
+    UDATA_TOC_INDEX_IX_ITEM_COUNT,
+    UDATA_TOC_INDEX_IX_BUCKET_COUNT,
+    UDATA_TOC_INDEX_IX_SLOT_COUNT,
+    UDATA_TOC_INDEX_IX_HASH_SEED,
+    /** udata_checksumTOC() of the package ToC */
+    UDATA_TOC_INDEX_IX_CHECKSUM,
+    UDATA_TOC_INDEX_IX_RESERVED_6,
+    UDATA_TOC_INDEX_IX_RESERVED_7,
+    UDATA_TOC_INDEX_IX_COUNT
+};
+
+/** FNV-1a hash of a ToC entry name including the package prefix. */
+static inline uint32_t
+udata_hashTOCName(const char *s, uint32_t hashSeed) {
+    uint32_t hash=0x811c9dc5^hashSeed;
+    uint8_t c;
+    while((c=(uint8_t)*s++)!=0) {
+        hash=(hash^c)*0x01000193;
+    }
+    return hash;
+}
+
+static inline int32_t
+udata_getTOCIndexSlot(uint32_t hash, uint32_t seed, int32_t count) {
+    hash^=seed*0x9e3779b9;
+    hash^=hash>>16;
+    hash*=0x85ebca6b;
+    hash^=hash>>13;
+    hash*=0xc2b2ae35;
+    hash^=hash>>16;
+    return (int32_t)(hash%(uint32_t)count);
+}
+
+static inline uint32_t
+udata_checksumTOC(const UDataOffsetTOCEntry *entries, int32_t count) {
+    uint32_t hash=0x811c9dc5;
+    int32_t i;
+    for(i=0; i<count; ++i) {
+        hash=(hash^entries[i].nameOffset)*0x01000193;
+        hash=(hash^entries[i].dataOffset)*0x01000193;
+    }
+    return hash;
+}
+
 /**
  * Get the header size from a const DataHeader *udh.
  * Handles opposite-endian data.
@@ -245,7 +245,8 @@ ucnv_safeClone(const UConverter* cnv, void *stackBuffer, int32_t *pBufferSize, U
     if (stackBufferSize < bufferSizeNeeded || stackBuffer == NULL)
     {
         /* allocate one here...*/
-        localConverter = allocatedConverter = (UConverter *) uprv_malloc (bufferSizeNeeded);
+        /* at least sizeof(UConverter), for uprv_sizedFree() in ucnv_close() */
+        localConverter = allocatedConverter = (UConverter *) uprv_sizedMalloc (bufferSizeNeeded);
 
         if(localConverter == NULL) {
             *status = U_MEMORY_ALLOCATION_ERROR;
@@ -387,7 +388,7 @@ ucnv_close (UConverter * converter)
     }
 
     if(!converter->isCopyLocal){
-        uprv_free(converter);
+        uprv_sizedFree(converter, sizeof(UConverter));
     }
 
     UTRACE_EXIT();
@@ -982,7 +982,7 @@ ucnv_createConverterFromSharedData(UConverter *myUConverter,
     }
     if(myUConverter == NULL)
     {
-        myUConverter = (UConverter *) uprv_malloc (sizeof (UConverter));
+        myUConverter = (UConverter *) uprv_sizedMalloc (sizeof (UConverter));
         if(myUConverter == NULL)
         {
             *err = U_MEMORY_ALLOCATION_ERROR;
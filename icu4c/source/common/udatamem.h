@@ -31,6 +31,8 @@ struct UDataMemory {
                                    /*   UDataMemory object.                           */
     const void       *toc;         /* For common memory, table of contents for        */
                                    /*   the pieces within.                            */
+    const void       *tocIndex;    /* For common memory, NULL or the hash index for   */
+                                   /*   the table of contents (see ucmndata.h).       */
     UBool             heapAllocated;  /* True if this UDataMemory Object is on the    */
                                    /*  heap and thus needs to be deleted when closed. */
 
@@ -990,11 +990,46 @@ _initializeULanguageTag(ULanguageTag* langtag) {
     langtag->privateuse = EMPTY;
 }
 
+/*
+ * Replaces a deprecated language code in the NUL-terminated buf
+ * by its preferred value. Returns the new length.
+ */
+static int32_t
+_resolveDeprecatedLanguage(char* buf, int32_t len) {
+    for (int32_t i = 0; i < UPRV_LENGTHOF(DEPRECATEDLANGS); i += 2) {
+        // 2-letter deprecated subtags are listede before 3-letter
+        // ones in DEPRECATEDLANGS[]. Get out of loop on coming
+        // across the 1st 3-letter subtag, if the input is a 2-letter code.
+        // to avoid continuing to try when there's no match.
+        if (uprv_strlen(buf) < uprv_strlen(DEPRECATEDLANGS[i])) break;
+        if (uprv_compareInvCharsAsAscii(buf, DEPRECATEDLANGS[i]) == 0) {
+            uprv_strcpy(buf, DEPRECATEDLANGS[i + 1]);
+            return (int32_t)uprv_strlen(buf);
+        }
+    }
+    return len;
+}
+
+/*
+ * Replaces a deprecated region code in the NUL-terminated buf
+ * by its preferred value. Returns the new length.
+ */
+static int32_t
+_resolveDeprecatedRegion(char* buf, int32_t len) {
+    for (int32_t i = 0; i < UPRV_LENGTHOF(DEPRECATEDREGIONS); i += 2) {
+        if (uprv_compareInvCharsAsAscii(buf, DEPRECATEDREGIONS[i]) == 0) {
+            uprv_strcpy(buf, DEPRECATEDREGIONS[i + 1]);
+            return (int32_t)uprv_strlen(buf);
+        }
+    }
+    return len;
+}
+
 static void
 _appendLanguageToLanguageTag(const char* localeID, icu::ByteSink& sink, UBool strict, UErrorCode* status) {
     char buf[ULOC_LANG_CAPACITY];
     UErrorCode tmpStatus = U_ZERO_ERROR;
-    int32_t len, i;
+    int32_t len;
 
     if (U_FAILURE(*status)) {
         return;
@@ -1021,19 +1056,7 @@ _appendLanguageToLanguageTag(const char* localeID, icu::ByteSink& sink, UBool st
         }
         sink.Append(LANG_UND, LANG_UND_LEN);
     } else {
-        /* resolve deprecated */
-        for (i = 0; i < UPRV_LENGTHOF(DEPRECATEDLANGS); i += 2) {
-            // 2-letter deprecated subtags are listede before 3-letter
-            // ones in DEPRECATEDLANGS[]. Get out of loop on coming
-            // across the 1st 3-letter subtag, if the input is a 2-letter code.
-            // to avoid continuing to try when there's no match.
-            if (uprv_strlen(buf) < uprv_strlen(DEPRECATEDLANGS[i])) break;
-            if (uprv_compareInvCharsAsAscii(buf, DEPRECATEDLANGS[i]) == 0) {
-                uprv_strcpy(buf, DEPRECATEDLANGS[i + 1]);
-                len = (int32_t)uprv_strlen(buf);
-                break;
-            }
-        }
+        len = _resolveDeprecatedLanguage(buf, len);
         sink.Append(buf, len);
     }
 }
@@ -1097,14 +1120,7 @@ _appendRegionToLanguageTag(const char* localeID, icu::ByteSink& sink, UBool stri
             return;
         } else {
             sink.Append("-", 1);
-            /* resolve deprecated */
-            for (int i = 0; i < UPRV_LENGTHOF(DEPRECATEDREGIONS); i += 2) {
-                if (uprv_compareInvCharsAsAscii(buf, DEPRECATEDREGIONS[i]) == 0) {
-                    uprv_strcpy(buf, DEPRECATEDREGIONS[i + 1]);
-                    len = (int32_t)uprv_strlen(buf);
-                    break;
-                }
-            }
+            len = _resolveDeprecatedRegion(buf, len);
             sink.Append(buf, len);
         }
     }
@@ -2614,6 +2630,173 @@ ultag_getGrandfathered(const ULanguageTag* langtag) {
 #endif
 
 
+/*
+* -------------------------------------------------
+*
+* Fast paths for the most common tag shapes
+*
+* -------------------------------------------------
+*/
+
+/*
+ * Returns the length of the language[-script][-region] prefix of a tag
+ * or locale ID, with sep being the only separator that is accepted.
+ * The caller compares it with the whole length.
+ * Returns -1 if there is no valid language subtag.
+ * The language must have minLangLen..maxLangLen letters, the script 4 letters,
+ * and the region 2 letters or 3 digits.
+ * The script and region lengths are returned via the out-parameters (0 if absent).
+ */
+static int32_t
+_getSimpleTagShape(const char* s, int32_t length, char sep, int32_t minLangLen, int32_t maxLangLen,
+                   int32_t* langLen, int32_t* scriptLen, int32_t* regionLen) {
+    int32_t i = 0;
+    while (i < length && ISALPHA(s[i])) {
+        ++i;
+    }
+    if (i < minLangLen || i > maxLangLen) {
+        return -1;
+    }
+    *langLen = i;
+    *scriptLen = *regionLen = 0;
+    if (i < length && s[i] == sep) {
+        int32_t limit = i + 1;
+        while (limit < length && ISALPHA(s[limit])) {
+            ++limit;
+        }
+        if ((limit - i) == 5) {
+            *scriptLen = 4;
+            i = limit;
+        }
+    }
+    if (i < length && s[i] == sep) {
+        int32_t limit = i + 1;
+        while (limit < length && ISALPHA(s[limit])) {
+            ++limit;
+        }
+        if (limit == (i + 1)) {
+            while (limit < length && ISNUMERIC(s[limit])) {
+                ++limit;
+            }
+            if ((limit - i) == 4) {
+                *regionLen = 3;
+                i = limit;
+            }
+        } else if ((limit - i) == 3) {
+            *regionLen = 2;
+            i = limit;
+        }
+    }
+    return i;
+}
+
+/*
+ * Converts a tag of the form language[-script][-region] directly into a
+ * locale ID in a stack buffer, without building a ULanguageTag.
+ * Returns FALSE without writing anything if the tag has any other shape,
+ * or if it might be a grandfathered or redundant tag.
+ */
+static UBool
+_forSimpleLanguageTag(const char* langtag,
+                      int32_t tagLen,
+                      icu::ByteSink& sink,
+                      int32_t* parsedLength) {
+    int32_t langLen, scriptLen, regionLen;
+    if (_getSimpleTagShape(langtag, tagLen, SEP, 2, 8,
+                           &langLen, &scriptLen, &regionLen) != tagLen) {
+        return FALSE;
+    }
+    // All of the redundant tags with a language-region shape start with "sgn".
+    if (langLen == 3 && uprv_strnicmp(langtag, "sgn", 3) == 0) {
+        return FALSE;
+    }
+
+    char buf[8 + 1 + 4 + 1 + 3];
+    int32_t length = 0;
+    const char* p = langtag;
+    if (langLen != LANG_UND_LEN || uprv_strnicmp(p, LANG_UND, LANG_UND_LEN) != 0) {
+        for (int32_t i = 0; i < langLen; ++i) {
+            buf[length++] = uprv_asciitolower(p[i]);
+        }
+    }
+    p += langLen + 1;
+    if (scriptLen > 0) {
+        buf[length++] = LOCALE_SEP;
+        buf[length++] = uprv_toupper(p[0]);
+        for (int32_t i = 1; i < scriptLen; ++i) {
+            buf[length++] = uprv_asciitolower(p[i]);
+        }
+        p += scriptLen + 1;
+    }
+    if (regionLen > 0) {
+        buf[length++] = LOCALE_SEP;
+        for (int32_t i = 0; i < regionLen; ++i) {
+            buf[length++] = uprv_toupper(p[i]);
+        }
+    }
+    sink.Append(buf, length);
+    if (parsedLength != NULL) {
+        *parsedLength = tagLen;
+    }
+    return TRUE;
+}
+
+/*
+ * Converts a locale ID of the form language[_script][_region] directly into
+ * a language tag in a stack buffer, without canonicalizing a copy of the ID.
+ * uloc_canonicalize() would only change the case of such IDs and
+ * map 3-letter language codes, like ulocimp_getLanguage() does.
+ * Returns FALSE without writing anything if the ID has any other shape.
+ */
+static UBool
+_toSimpleLanguageTag(const char* localeID, icu::ByteSink& sink) {
+    int32_t length = static_cast<int32_t>(uprv_strlen(localeID));
+    int32_t langLen, scriptLen, regionLen;
+    if (_getSimpleTagShape(localeID, length, LOCALE_SEP, 2, 3,
+                           &langLen, &scriptLen, &regionLen) != length) {
+        return FALSE;
+    }
+
+    char buf[ULOC_LANG_CAPACITY + 1 + 4 + 1 + 3];
+    int32_t len;
+    if (langLen == 2) {
+        buf[0] = uprv_asciitolower(localeID[0]);
+        buf[1] = uprv_asciitolower(localeID[1]);
+        buf[2] = 0;
+        len = 2;
+    } else {
+        // Handles "und" and 3-letter codes with 2-letter equivalents.
+        len = ulocimp_getLanguage(localeID, buf, ULOC_LANG_CAPACITY, NULL);
+        buf[len] = 0;
+    }
+    if (len == 0) {
+        uprv_strcpy(buf, LANG_UND);
+        len = LANG_UND_LEN;
+    } else {
+        len = _resolveDeprecatedLanguage(buf, len);
+    }
+    const char* p = localeID + langLen + 1;
+    if (scriptLen > 0) {
+        buf[len++] = SEP;
+        buf[len++] = uprv_toupper(p[0]);
+        for (int32_t i = 1; i < scriptLen; ++i) {
+            buf[len++] = uprv_asciitolower(p[i]);
+        }
+        p += scriptLen + 1;
+    }
+    if (regionLen > 0) {
+        buf[len++] = SEP;
+        char* region = buf + len;
+        for (int32_t i = 0; i < regionLen; ++i) {
+            region[i] = uprv_toupper(p[i]);
+        }
+        region[regionLen] = 0;
+        len += _resolveDeprecatedRegion(region, regionLen);
+    }
+    sink.Append(buf, len);
+    return TRUE;
+}
+
 /*
 * -------------------------------------------------
 *
@@ -2655,6 +2838,24 @@ ulocimp_toLanguageTag(const char* localeID,
                       icu::ByteSink& sink,
                       UBool strict,
                       UErrorCode* status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (localeID == NULL) {
+        localeID = uloc_getDefault();
+    }
+    if (_toSimpleLanguageTag(localeID, sink)) {
+        return;
+    }
+    ulocimp_toLanguageTagFull(localeID, sink, strict, status);
+}
+
+
+U_CAPI void U_EXPORT2
+ulocimp_toLanguageTagFull(const char* localeID,
+                          icu::ByteSink& sink,
+                          UBool strict,
+                          UErrorCode* status) {
     icu::CharString canonical;
     int32_t reslen;
     UErrorCode tmpStatus = U_ZERO_ERROR;
@@ -2790,6 +2991,28 @@ ulocimp_forLanguageTag(const char* langtag,
                        icu::ByteSink& sink,
                        int32_t* parsedLength,
                        UErrorCode* status) {
+    if (U_FAILURE(*status)) {
+        if (parsedLength != NULL) {
+            *parsedLength = 0;
+        }
+        return;
+    }
+    if (tagLen < 0) {
+        tagLen = (int32_t)uprv_strlen(langtag);
+    }
+    if (_forSimpleLanguageTag(langtag, tagLen, sink, parsedLength)) {
+        return;
+    }
+    ulocimp_forLanguageTagFull(langtag, tagLen, sink, parsedLength, status);
+}
+
+
+U_CAPI void U_EXPORT2
+ulocimp_forLanguageTagFull(const char* langtag,
+                           int32_t tagLen,
+                           icu::ByteSink& sink,
+                           int32_t* parsedLength,
+                           UErrorCode* status) {
     UBool isEmpty = TRUE;
     const char *subtag, *p;
     int32_t len;
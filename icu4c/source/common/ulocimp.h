@@ -87,6 +87,20 @@ ulocimp_toLanguageTag(const char* localeID,
                       UBool strict,
                       UErrorCode* err);
 
+/**
+ * Same as ulocimp_toLanguageTag() but always canonicalizes the whole
+ * locale ID, even for the simple language_Script_REGION shapes that
+ * ulocimp_toLanguageTag() converts directly.
+ * Used for testing that both paths yield the same results.
+ *
+ * @internal ICU 67
+ */
+U_CAPI void U_EXPORT2
+ulocimp_toLanguageTagFull(const char* localeID,
+                          icu::ByteSink& sink,
+                          UBool strict,
+                          UErrorCode* err);
+
 /**
  * Returns a locale ID for the specified BCP47 language tag string.
  * If the specified language tag contains any ill-formed subtags,
@@ -116,6 +130,21 @@ ulocimp_forLanguageTag(const char* langtag,
                        int32_t* parsedLength,
                        UErrorCode* err);
 
+/**
+ * Same as ulocimp_forLanguageTag() but always runs the full BCP47 parser,
+ * even for the simple language-script-region shapes that
+ * ulocimp_forLanguageTag() converts directly.
+ * Used for testing that both paths yield the same results.
+ *
+ * @internal ICU 67
+ */
+U_CAPI void U_EXPORT2
+ulocimp_forLanguageTagFull(const char* langtag,
+                           int32_t tagLen,
+                           icu::ByteSink& sink,
+                           int32_t* parsedLength,
+                           UErrorCode* err);
+
 /**
  * Get the region to use for supplemental data lookup. Uses
  * (1) any region specified by locale tag "rg"; if none then
@@ -137,6 +137,7 @@ struct LSR;
 
 class LocaleDistance;
 class LocaleLsrIterator;
+class LocaleMatcherCache;
 class UVector;
 class XLikelySubtags;
 
@@ -463,6 +464,31 @@ class U_COMMON_API LocaleMatcher : public UMemory {
             return *this;
         }
 
+        /**
+         * Sets how many desired-locale list strings and how many desired locales
+         * the matcher caches, for inputs that repeat often,
+         * such as HTTP Accept-Language header values.
+         * For a list string, the matcher caches the best-matching supported locale,
+         * see getBestMatchForListString().
+         * For a desired locale, it caches the internal maximized form,
+         * which is used by all of the getBestMatch() functions.
+         * The least recently used entries are removed when the cache is full.
+         * The cache is thread-safe, like the rest of the matcher.
+         *
+         * By default, the size is 0 and the matcher does not cache anything.
+         *
+         * @param cacheSize the maximum number of cached list strings,
+         *                  and separately of cached locales
+         * @return this Builder object
+         * @draft ICU 67
+         */
+        Builder &setCacheSize(int32_t cacheSize) {
+            if (U_SUCCESS(errorCode_)) {
+                cacheSize_ = cacheSize > 0 ? cacheSize : 0;
+            }
+            return *this;
+        }
+
         /**
          * Sets the UErrorCode if an error occurred while setting parameters.
          * Preserves older error codes in the outErrorCode.
@@ -503,6 +529,7 @@ class U_COMMON_API LocaleMatcher : public UMemory {
         Locale *defaultLocale_ = nullptr;
         ULocMatchFavorSubtag favor_ = ULOCMATCH_FAVOR_LANGUAGE;
         ULocMatchDirection direction_ = ULOCMATCH_DIRECTION_WITH_ONE_WAY;
+        int32_t cacheSize_ = 0;
     };
 
     // FYI No public LocaleMatcher constructors in C++; use the Builder.
@@ -650,6 +677,7 @@ class U_COMMON_API LocaleMatcher : public UMemory {
     int32_t supportedLSRsLength;
     Locale *ownedDefaultLocale;
     const Locale *defaultLocale;
+    LocaleMatcherCache *cache;
 };
 
 U_NAMESPACE_END
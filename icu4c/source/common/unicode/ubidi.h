@@ -1603,6 +1603,78 @@ U_STABLE UBiDiDirection U_EXPORT2
 ubidi_getVisualRun(UBiDi *pBiDi, int32_t runIndex,
                    int32_t *pLogicalStart, int32_t *pLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * One run's logical start, length, and directionality,
+ * as returned by <code>ubidi_getVisualRun()</code>.
+ *
+ * @see ubidi_setParas
+ * @draft ICU 67
+ */
+typedef struct UBiDiVisualRun {
+    /** The first logical character index in the text. @draft ICU 67 */
+    int32_t logicalStart;
+    /** The number of characters (at least one) in the run. @draft ICU 67 */
+    int32_t length;
+    /** <code>UBIDI_LTR</code> or <code>UBIDI_RTL</code>. @draft ICU 67 */
+    UBiDiDirection direction;
+} UBiDiVisualRun;
+
+/**
+ * Performs the Unicode Bidi algorithm on each of a list of texts,
+ * and writes their levels and visual runs into caller-provided arrays.
+ * Same results as calling <code>ubidi_setPara()</code> with
+ * <code>embeddingLevels==NULL</code> for each text, followed by
+ * <code>ubidi_getLevels()</code>, <code>ubidi_countRuns()</code> and
+ * <code>ubidi_getVisualRun()</code>,
+ * but with less overhead for large numbers of short texts.<p>
+ *
+ * The levels of all of the texts are written one after the other:
+ * The levels of text i start at the sum of the lengths of the texts before it.
+ * The visual runs of all of the texts are also written one after the other,
+ * and <code>runLimits[i]</code> is set to the index after the last run of text i.
+ * An empty text has no levels and no runs.
+ * If the levels or runs do not all fit, then the function sets
+ * <code>U_BUFFER_OVERFLOW_ERROR</code> and returns the total number of runs,
+ * and it still sets the <code>runLimits</code>.<p>
+ *
+ * The <code>UBiDi</code> object is reused for all of the texts,
+ * with its reordering mode, reordering options and class callback.
+ * Afterwards, it holds the results for the last text.
+ *
+ * @param pBiDi A <code>UBiDi</code> object allocated with <code>ubidi_open()</code>
+ *        which is to be reused for the texts.
+ *        Its reordering options must not include <code>UBIDI_OPTION_STREAMING</code>.
+ * @param texts The texts, each one a paragraph or a series of paragraphs,
+ *        as for <code>ubidi_setPara()</code>.
+ * @param lengths The lengths of the texts (-1 if NUL-terminated),
+ *        or NULL if all of the texts are NUL-terminated.
+ * @param count The number of texts.
+ * @param paraLevel The paragraph embedding level for all of the texts,
+ *        as for <code>ubidi_setPara()</code>.
+ * @param levels Receives the levels of all of the texts.
+ *        Can be NULL if levelsCapacity is 0, then no levels are written.
+ * @param levelsCapacity The number of elements in the levels array.
+ * @param runs Receives the visual runs of all of the texts.
+ *        Can be NULL if runsCapacity is 0.
+ * @param runsCapacity The number of elements in the runs array.
+ * @param runLimits Must have count elements;
+ *        receives the index in runs after the last run of each text.
+ * @param pErrorCode must be a valid pointer to an error code value.
+ * @return the total number of runs
+ * @see ubidi_setPara
+ * @see ubidi_getVisualRun
+ * @draft ICU 67
+ */
+U_DRAFT int32_t U_EXPORT2
+ubidi_setParas(UBiDi *pBiDi,
+               const UChar *const *texts, const int32_t *lengths, int32_t count,
+               UBiDiLevel paraLevel,
+               UBiDiLevel *levels, int32_t levelsCapacity,
+               UBiDiVisualRun *runs, int32_t runsCapacity, int32_t *runLimits,
+               UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Get the visual position from a logical text position.
  * If such a mapping is used many times on the same
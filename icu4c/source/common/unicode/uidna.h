@@ -413,6 +413,45 @@ uidna_nameToUnicodeUTF8(const UIDNA *idna,
                         char *dest, int32_t capacity,
                         UIDNAInfo *pInfo, UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Converts a list of whole domain names into their ASCII forms for DNS lookup.
+ * Same behavior as calling uidna_nameToASCII_UTF8() for each name,
+ * but faster for long lists, for example when compiling a blocklist.
+ *
+ * The results are written one after the other into dest,
+ * each one NUL-terminated.
+ * If they do not all fit, then the function sets U_BUFFER_OVERFLOW_ERROR
+ * and returns the total length that is needed (preflighting),
+ * and it still sets the destIndexes and errors.
+ * The names must not overlap with dest.
+ *
+ * @param idna UIDNA instance
+ * @param names Input domain names
+ * @param lengths Domain name lengths (-1 if NUL-terminated),
+ *                or NULL if all names are NUL-terminated
+ * @param count Number of domain names
+ * @param dest Destination buffer
+ * @param capacity Destination buffer capacity
+ * @param destIndexes If not NULL, must have count elements;
+ *                    receives the start index in dest of each result
+ * @param errors If not NULL, must have count elements;
+ *               receives the bit set of UIDNA_ERROR_... values for each name
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return total length of the results, including their NUL terminators
+ * @draft ICU 67
+ */
+U_DRAFT int32_t U_EXPORT2
+uidna_namesToASCII_UTF8(const UIDNA *idna,
+                        const char *const *names, const int32_t *lengths, int32_t count,
+                        char *dest, int32_t capacity,
+                        int32_t *destIndexes, uint32_t *errors,
+                        UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /*
  * IDNA error bit set values.
  * When a domain name or label fails a processing step or does not meet the
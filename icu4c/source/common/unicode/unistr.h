@@ -79,6 +79,7 @@ U_NAMESPACE_BEGIN
 
 class Locale;               // unicode/locid.h
 class StringCharacterIterator;
+class UnicodeStringArena;
 class UnicodeStringAppendable;  // unicode/appendable.h
 
 /* The <iostream> include has been moved to unicode/ustream.h */
@@ -3153,6 +3154,30 @@ class U_COMMON_API UnicodeString : public Replaceable
    */
   inline UnicodeString(std::nullptr_t buffer, int32_t buffLength, int32_t buffCapacity);
 
+#ifndef U_HIDE_DRAFT_API
+  /**
+   * Arena-allocating constructor.
+   * Constructs an empty string whose buffer of the given capacity
+   * comes from the arena rather than from the heap.
+   * The arena owns the buffer the way the caller owns the buffer of a writable alias:
+   * For as long as the capacity is sufficient, write operations
+   * go to the arena buffer. When more capacity is necessary, or when another
+   * string is assigned to this one, the contents move to a heap buffer
+   * as with regularly constructed strings.
+   * Copies of this string always get their own buffers.
+   *
+   * This string object, and any string moved from it, must not be used
+   * after the arena is destroyed while it still uses the arena buffer.
+   * Copy it into another UnicodeString to keep its contents.
+   *
+   * @param arena provides the buffer
+   * @param capacity the number of char16_ts that the string is to hold
+   * @draft ICU 67
+   * @see UnicodeStringArena
+   */
+  UnicodeString(UnicodeStringArena &arena, int32_t capacity);
+#endif  // U_HIDE_DRAFT_API
+
 #if U_CHARSET_IS_UTF8 || !UCONFIG_NO_CONVERSION
 
   /**
@@ -3801,6 +3826,93 @@ class U_COMMON_API UnicodeString : public Replaceable
 U_COMMON_API UnicodeString U_EXPORT2
 operator+ (const UnicodeString &s1, const UnicodeString &s2);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A monotonic allocator for the buffers of UnicodeString objects
+ * that are constructed with it.
+ *
+ * Only strings constructed with UnicodeString(UnicodeStringArena &, int32_t)
+ * take their buffers from the arena; all other strings, including those that
+ * ICU creates internally, are unaffected.
+ * Arena buffers are not reference-counted and not individually released;
+ * all of the memory is released when the arena is destroyed.
+ * This makes creating and destroying many temporary strings cheaper
+ * in request-scoped processing.
+ *
+ * \code
+ * {
+ *     char buffer[4096];
+ *     UnicodeStringArena arena(buffer, sizeof(buffer));
+ *     for (...) {
+ *         UnicodeString s(arena, 200);  // buffer for 200 char16_ts from the arena
+ *         s.append(...);
+ *         result.append(s);             // copies the contents
+ *     }
+ * }  // all arena memory released here
+ * \endcode
+ *
+ * An arena is not thread-safe; it should be used on one thread at a time.
+ *
+ * @draft ICU 67
+ */
+class U_COMMON_API UnicodeStringArena : public UMemory {
+public:
+    /**
+     * Constructs an arena that allocates memory in heap blocks
+     * of at least the given size.
+     *
+     * @param blockSize minimum number of bytes per block allocated from the heap;
+     *                  values below 1024 are increased to 1024
+     * @draft ICU 67
+     */
+    explicit UnicodeStringArena(int32_t blockSize = 16384);
+
+    /**
+     * Constructs an arena that allocates memory from the caller's buffer first,
+     * and then in heap blocks of at least the given size.
+     *
+     * @param buffer caller-owned memory; must remain valid for the lifetime of the arena
+     * @param capacity number of bytes in the buffer
+     * @param blockSize minimum number of bytes per block allocated from the heap;
+     *                  values below 1024 are increased to 1024
+     * @draft ICU 67
+     */
+    UnicodeStringArena(void *buffer, int32_t capacity, int32_t blockSize = 16384);
+
+    /**
+     * Releases all of the arena memory.
+     * @draft ICU 67
+     */
+    ~UnicodeStringArena();
+
+    /**
+     * @return the number of bytes handed out to strings so far
+     * @draft ICU 67
+     */
+    int64_t getAllocatedBytes() const { return allocatedBytes; }
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Allocates memory aligned for char16_t.
+     * @return the memory, or nullptr if memory allocation failed
+     * @internal
+     */
+    void *allocate(size_t numBytes);
+#endif  // U_HIDE_INTERNAL_API
+
+private:
+    UnicodeStringArena(const UnicodeStringArena &other) = delete;
+    UnicodeStringArena &operator=(const UnicodeStringArena &other) = delete;
+
+    /** Linked list of heap blocks; the first pointer in each block is the next one. */
+    void *blocks;
+    char *start;
+    char *limit;
+    int32_t blockSize;
+    int64_t allocatedBytes;
+};
+#endif  // U_HIDE_DRAFT_API
+
 //========================================
 // Inline members
 //========================================
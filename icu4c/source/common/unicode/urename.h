@@ -473,6 +473,7 @@
 #define ubidi_setInverse U_ICU_ENTRY_POINT_RENAME(ubidi_setInverse)
 #define ubidi_setLine U_ICU_ENTRY_POINT_RENAME(ubidi_setLine)
 #define ubidi_setPara U_ICU_ENTRY_POINT_RENAME(ubidi_setPara)
+#define ubidi_setParas U_ICU_ENTRY_POINT_RENAME(ubidi_setParas)
 #define ubidi_setReorderingMode U_ICU_ENTRY_POINT_RENAME(ubidi_setReorderingMode)
 #define ubidi_setReorderingOptions U_ICU_ENTRY_POINT_RENAME(ubidi_setReorderingOptions)
 #define ubidi_writeReordered U_ICU_ENTRY_POINT_RENAME(ubidi_writeReordered)
@@ -718,6 +719,7 @@
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
+#define ucol_closeComparand U_ICU_ENTRY_POINT_RENAME(ucol_closeComparand)
 #define ucol_closeElements U_ICU_ENTRY_POINT_RENAME(ucol_closeElements)
 #define ucol_countAvailable U_ICU_ENTRY_POINT_RENAME(ucol_countAvailable)
 #define ucol_equal U_ICU_ENTRY_POINT_RENAME(ucol_equal)
@@ -760,6 +762,7 @@
 #define ucol_open U_ICU_ENTRY_POINT_RENAME(ucol_open)
 #define ucol_openAvailableLocales U_ICU_ENTRY_POINT_RENAME(ucol_openAvailableLocales)
 #define ucol_openBinary U_ICU_ENTRY_POINT_RENAME(ucol_openBinary)
+#define ucol_openComparand U_ICU_ENTRY_POINT_RENAME(ucol_openComparand)
 #define ucol_openElements U_ICU_ENTRY_POINT_RENAME(ucol_openElements)
 #define ucol_openFromShortString U_ICU_ENTRY_POINT_RENAME(ucol_openFromShortString)
 #define ucol_openRules U_ICU_ENTRY_POINT_RENAME(ucol_openRules)
@@ -777,7 +780,10 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
+#define ucol_strcollComparand U_ICU_ENTRY_POINT_RENAME(ucol_strcollComparand)
+#define ucol_strcollComparandPrefix U_ICU_ENTRY_POINT_RENAME(ucol_strcollComparandPrefix)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
 #define ucol_swap U_ICU_ENTRY_POINT_RENAME(ucol_swap)
@@ -797,6 +803,7 @@
 #define ucptrie_openFromBinary U_ICU_ENTRY_POINT_RENAME(ucptrie_openFromBinary)
 #define ucptrie_swap U_ICU_ENTRY_POINT_RENAME(ucptrie_swap)
 #define ucptrie_toBinary U_ICU_ENTRY_POINT_RENAME(ucptrie_toBinary)
+#define ucsdet_appendText U_ICU_ENTRY_POINT_RENAME(ucsdet_appendText)
 #define ucsdet_close U_ICU_ENTRY_POINT_RENAME(ucsdet_close)
 #define ucsdet_detect U_ICU_ENTRY_POINT_RENAME(ucsdet_detect)
 #define ucsdet_detectAll U_ICU_ENTRY_POINT_RENAME(ucsdet_detectAll)
@@ -1007,6 +1014,7 @@
 #define uidna_nameToASCII_UTF8 U_ICU_ENTRY_POINT_RENAME(uidna_nameToASCII_UTF8)
 #define uidna_nameToUnicode U_ICU_ENTRY_POINT_RENAME(uidna_nameToUnicode)
 #define uidna_nameToUnicodeUTF8 U_ICU_ENTRY_POINT_RENAME(uidna_nameToUnicodeUTF8)
+#define uidna_namesToASCII_UTF8 U_ICU_ENTRY_POINT_RENAME(uidna_namesToASCII_UTF8)
 #define uidna_openUTS46 U_ICU_ENTRY_POINT_RENAME(uidna_openUTS46)
 #define uidna_toASCII U_ICU_ENTRY_POINT_RENAME(uidna_toASCII)
 #define uidna_toUnicode U_ICU_ENTRY_POINT_RENAME(uidna_toUnicode)
@@ -1115,6 +1123,7 @@
 #define ulocdata_setNoSubstitute U_ICU_ENTRY_POINT_RENAME(ulocdata_setNoSubstitute)
 #define ulocimp_addLikelySubtags U_ICU_ENTRY_POINT_RENAME(ulocimp_addLikelySubtags)
 #define ulocimp_forLanguageTag U_ICU_ENTRY_POINT_RENAME(ulocimp_forLanguageTag)
+#define ulocimp_forLanguageTagFull U_ICU_ENTRY_POINT_RENAME(ulocimp_forLanguageTagFull)
 #define ulocimp_getCountry U_ICU_ENTRY_POINT_RENAME(ulocimp_getCountry)
 #define ulocimp_getLanguage U_ICU_ENTRY_POINT_RENAME(ulocimp_getLanguage)
 #define ulocimp_getRegionForSupplementalData U_ICU_ENTRY_POINT_RENAME(ulocimp_getRegionForSupplementalData)
@@ -1123,6 +1132,7 @@
 #define ulocimp_toBcpKey U_ICU_ENTRY_POINT_RENAME(ulocimp_toBcpKey)
 #define ulocimp_toBcpType U_ICU_ENTRY_POINT_RENAME(ulocimp_toBcpType)
 #define ulocimp_toLanguageTag U_ICU_ENTRY_POINT_RENAME(ulocimp_toLanguageTag)
+#define ulocimp_toLanguageTagFull U_ICU_ENTRY_POINT_RENAME(ulocimp_toLanguageTagFull)
 #define ulocimp_toLegacyKey U_ICU_ENTRY_POINT_RENAME(ulocimp_toLegacyKey)
 #define ulocimp_toLegacyType U_ICU_ENTRY_POINT_RENAME(ulocimp_toLegacyType)
 #define ultag_isExtensionSubtags U_ICU_ENTRY_POINT_RENAME(ultag_isExtensionSubtags)
@@ -1395,6 +1405,7 @@
 #define uprv_getMaxValues U_ICU_ENTRY_POINT_RENAME(uprv_getMaxValues)
 #define uprv_getNaN U_ICU_ENTRY_POINT_RENAME(uprv_getNaN)
 #define uprv_getRawUTCtime U_ICU_ENTRY_POINT_RENAME(uprv_getRawUTCtime)
+#define uprv_getSizedMallocStats U_ICU_ENTRY_POINT_RENAME(uprv_getSizedMallocStats)
 #define uprv_getStaticCurrencyName U_ICU_ENTRY_POINT_RENAME(uprv_getStaticCurrencyName)
 #define uprv_getUTCtime U_ICU_ENTRY_POINT_RENAME(uprv_getUTCtime)
 #define uprv_int32Comparator U_ICU_ENTRY_POINT_RENAME(uprv_int32Comparator)
@@ -1422,6 +1433,9 @@
 #define uprv_pow10 U_ICU_ENTRY_POINT_RENAME(uprv_pow10)
 #define uprv_realloc U_ICU_ENTRY_POINT_RENAME(uprv_realloc)
 #define uprv_round U_ICU_ENTRY_POINT_RENAME(uprv_round)
+#define uprv_sizedFree U_ICU_ENTRY_POINT_RENAME(uprv_sizedFree)
+#define uprv_sizedMalloc U_ICU_ENTRY_POINT_RENAME(uprv_sizedMalloc)
+#define uprv_sizedRealloc U_ICU_ENTRY_POINT_RENAME(uprv_sizedRealloc)
 #define uprv_sortArray U_ICU_ENTRY_POINT_RENAME(uprv_sortArray)
 #define uprv_stableBinarySearch U_ICU_ENTRY_POINT_RENAME(uprv_stableBinarySearch)
 #define uprv_strCompare U_ICU_ENTRY_POINT_RENAME(uprv_strCompare)
@@ -1764,6 +1778,7 @@
 #define utext_openReplaceable U_ICU_ENTRY_POINT_RENAME(utext_openReplaceable)
 #define utext_openUChars U_ICU_ENTRY_POINT_RENAME(utext_openUChars)
 #define utext_openUTF8 U_ICU_ENTRY_POINT_RENAME(utext_openUTF8)
+#define utext_openUTF8Segments U_ICU_ENTRY_POINT_RENAME(utext_openUTF8Segments)
 #define utext_openUnicodeString U_ICU_ENTRY_POINT_RENAME(utext_openUnicodeString)
 #define utext_previous32 U_ICU_ENTRY_POINT_RENAME(utext_previous32)
 #define utext_previous32From U_ICU_ENTRY_POINT_RENAME(utext_previous32From)
@@ -1809,6 +1824,7 @@
 #define utrans_transIncremental U_ICU_ENTRY_POINT_RENAME(utrans_transIncremental)
 #define utrans_transIncrementalUChars U_ICU_ENTRY_POINT_RENAME(utrans_transIncrementalUChars)
 #define utrans_transUChars U_ICU_ENTRY_POINT_RENAME(utrans_transUChars)
+#define utrans_transUCharsToBuffer U_ICU_ENTRY_POINT_RENAME(utrans_transUCharsToBuffer)
 #define utrans_transliterator_cleanup U_ICU_ENTRY_POINT_RENAME(utrans_transliterator_cleanup)
 #define utrans_unregister U_ICU_ENTRY_POINT_RENAME(utrans_unregister)
 #define utrans_unregisterID U_ICU_ENTRY_POINT_RENAME(utrans_unregisterID)
@@ -226,6 +226,37 @@ U_NAMESPACE_END
 U_STABLE UText * U_EXPORT2
 utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Open a read-only UText for UTF-8 text that is stored in several segments,
+ * for example in the pieces of a rope or of a chunked buffer.
+ * The text is the concatenation of the segments, without copying them.
+ * A character may span the boundary between two segments.
+ * Native indexes are byte offsets from the start of the first segment.
+ *
+ * Invalid UTF-8 is handled the same way as by utext_openUTF8().
+ *
+ * The arrays of segment pointers and lengths, and the segments themselves,
+ * must remain valid and unmodified while the UText is in use.
+ * A deep clone copies the text.
+ *
+ * @param ut       Pointer to a UText struct.  If NULL, a new UText will be created.
+ *                 If non-NULL, must refer to an initialized UText struct, which will then
+ *                 be reset to reference the specified text.
+ * @param segments An array of count pointers to the UTF-8 segments.
+ *                 A segment pointer may be NULL if its length is 0.
+ * @param lengths  An array of count segment lengths in bytes, each at least 0.
+ * @param count    The number of segments, at least 0.
+ * @param status   Errors are returned here.
+ * @return         A pointer to the UText.  If a pre-allocated UText was provided, it
+ *                 will always be used and returned.
+ * @draft ICU 67
+ */
+U_DRAFT UText * U_EXPORT2
+utext_openUTF8Segments(UText *ut, const char *const *segments, const int32_t *lengths,
+                       int32_t count, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /**
  * Open a read-only UText for UChar * string.
@@ -136,7 +136,8 @@ UnicodeString::refCount() const {
 void
 UnicodeString::releaseArray() {
   if((fUnion.fFields.fLengthAndFlags & kRefCounted) && removeRef() == 0) {
-    uprv_free((int32_t *)fUnion.fFields.fArray - 1);
+    uprv_sizedFree((int32_t *)fUnion.fFields.fArray - 1,
+                   sizeof(int32_t) + (size_t)fUnion.fFields.fCapacity * U_SIZEOF_UCHAR);
   }
 }
 
@@ -378,7 +379,7 @@ UnicodeString::allocate(int32_t capacity) {
     size_t numBytes = sizeof(int32_t) + (size_t)capacity * U_SIZEOF_UCHAR;
     // Round up to a multiple of 16.
     numBytes = (numBytes + 15) & ~15;
-    int32_t *array = (int32_t *) uprv_malloc(numBytes);
+    int32_t *array = (int32_t *) uprv_sizedMalloc(numBytes);
     if(array != NULL) {
       // set initial refCount and point behind the refCount
       *array++ = 1;
@@ -397,6 +398,87 @@ UnicodeString::allocate(int32_t capacity) {
   return FALSE;
 }
 
+//========================================
+// UnicodeStringArena
+//========================================
+
+namespace {
+
+constexpr int32_t kMinArenaBlockSize = 1024;
+
+}  // namespace
+
+UnicodeStringArena::UnicodeStringArena(int32_t blockSize)
+        : blocks(nullptr), start(nullptr), limit(nullptr),
+          blockSize(blockSize > kMinArenaBlockSize ? blockSize : kMinArenaBlockSize),
+          allocatedBytes(0) {
+}
+
+UnicodeStringArena::UnicodeStringArena(void *buffer, int32_t capacity, int32_t blockSize)
+        : blocks(nullptr), start((char *)buffer), limit((char *)buffer),
+          blockSize(blockSize > kMinArenaBlockSize ? blockSize : kMinArenaBlockSize),
+          allocatedBytes(0) {
+  if(buffer != nullptr && capacity > 0) {
+    limit += capacity;
+    // Align the start like the allocations from heap blocks.
+    size_t misalignment = U_POINTER_MASK_LSB(start, sizeof(void *) - 1);
+    if(misalignment != 0) {
+      start += sizeof(void *) - misalignment;
+      if(start > limit) { start = limit; }
+    }
+  }
+}
+
+UnicodeStringArena::~UnicodeStringArena() {
+  while(blocks != nullptr) {
+    void *next = *(void **)blocks;
+    uprv_free(blocks);
+    blocks = next;
+  }
+}
+
+void *UnicodeStringArena::allocate(size_t numBytes) {
+  // Keep the next start aligned for pointers, which is more than enough for char16_t.
+  numBytes = (numBytes + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+  if(numBytes > (size_t)(limit - start)) {
+    // The header is the link to the previous block,
+    // which also keeps the rest of the block aligned.
+    size_t newSize = sizeof(void *) + numBytes;
+    if(newSize < (size_t)blockSize) {
+      newSize = blockSize;
+    }
+    char *block = (char *)uprv_malloc(newSize);
+    if(block == nullptr) {
+      return nullptr;
+    }
+    *(void **)block = blocks;
+    blocks = block;
+    start = block + sizeof(void *);
+    limit = block + newSize;
+  }
+  void *p = start;
+  start += numBytes;
+  allocatedBytes += numBytes;
+  return p;
+}
+
+UnicodeString::UnicodeString(UnicodeStringArena &arena, int32_t capacity) {
+  fUnion.fFields.fLengthAndFlags = kShortString;
+  if(capacity > US_STACKBUF_SIZE && capacity <= kMaxCapacity) {
+    // Arena memory is owned by the arena, like a writable alias is owned by the caller.
+    ++capacity;  // for the NUL
+    UChar *array = (UChar *)arena.allocate((size_t)capacity * U_SIZEOF_UCHAR);
+    if(array != nullptr) {
+      fUnion.fFields.fLengthAndFlags = kWritableAlias;
+      setArray(array, 0, capacity);
+    } else if(!allocate(capacity - 1)) {
+      setToBogus();
+    }
+  } else if(capacity > US_STACKBUF_SIZE) {
+    setToBogus();
+  }
+}
+
 //========================================
 // Destructor
 //========================================
@@ -1829,6 +1911,7 @@ UnicodeString::cloneArrayIfNeeded(int32_t newCapacity,
     UChar *oldArray;
     int32_t oldLength = length();
     int16_t flags = fUnion.fFields.fLengthAndFlags;
+    int32_t oldCapacity = getCapacity();
 
     if(flags&kUsingStackBuffer) {
       U_ASSERT(!(flags&kRefCounted)); /* kRefCounted and kUsingStackBuffer are mutally exclusive */
@@ -1874,7 +1957,8 @@ UnicodeString::cloneArrayIfNeeded(int32_t newCapacity,
               // Note: cast to (void *) is needed with MSVC, where u_atomic_int32_t
               // is defined as volatile. (Volatile has useful non-standard behavior
               //   with this compiler.)
-            uprv_free((void *)pRefCount);
+            uprv_sizedFree((void *)pRefCount,
+                           sizeof(int32_t) + (size_t)oldCapacity * U_SIZEOF_UCHAR);
           } else {
             // the caller requested to delete it himself
             *pBufferToDelete = (int32_t *)pRefCount;
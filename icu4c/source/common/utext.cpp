@@ -1625,6 +1625,10 @@ static const struct UTextFuncs utf8Funcs =
 };
 
 
+static UText *
+openUTF8Segments(UText *ut, const char *const *segments, const int32_t *lengths, int32_t count,
+                 UBool isSingleString, UErrorCode *status);
+
 static const char gEmptyString[] = {0};
 
 U_CAPI UText * U_EXPORT2
@@ -1641,6 +1645,14 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
         return NULL;
     }
 
+    if(length>=0) {
+        // Known length: Use the provider for segmented text, with one segment.
+        //   Its chunks grow with the text, and ASCII text has native indexes
+        //   equal to the UTF-16 indexes.
+        int32_t length32=(int32_t)length;
+        return openUTF8Segments(ut, &s, &length32, 1, TRUE, status);
+    }
+
     ut = utext_setup(ut, sizeof(UTF8Buf) * 2, status);
     if (U_FAILURE(*status)) {
         return ut;
@@ -1667,6 +1679,526 @@ utext_openUTF8(UText *ut, const char *s, int64_t length, UErrorCode *status) {
 
 
 
+//------------------------------------------------------------------------------
+//
+//     UText implementation for segmented UTF-8 text,
+//       and for UTF-8 strings with known length.
+//
+//         The text is a sequence of caller-owned segments, for example the pieces
+//         of a rope.  A code point may span segment boundaries.
+//         Native indexes are byte offsets from the start of the first segment.
+//
+//         One chunk of UTF-16 is kept, with its capacity adapted to the text length
+//         so that shorter texts fit completely.  A chunk that starts with ASCII has
+//         a nativeIndexingLimit up to the first non-ASCII character, so that the
+//         inline UText macros work on it without calling into the provider.
+//         Beyond that, native indexes are mapped with a binary search.
+//
+//         Use of UText data members:
+//              context    the text: the UTF-8 string, or the array of segment pointers
+//              p          pointer to the UTF8SegmentsExtra (in pExtra)
+//              q          pointer to the segment start indexes (in pExtra)
+//              r          pointer to the chunk's native offsets (in pExtra)
+//              a          text length
+//              b          number of segments
+//              c          segment index where the last search ended
+//
+//------------------------------------------------------------------------------
+
+enum {
+    UTF8_SEGMENTS_MIN_CHUNK=32,
+    UTF8_SEGMENTS_MAX_CHUNK=1024,
+    // Characters before/after the requested index that are included when
+    //   a chunk is filled, so that small steps in the opposite direction
+    //   do not refill the chunk.
+    UTF8_SEGMENTS_OVERLAP=16
+};
+
+struct UTF8SegmentsExtra {
+    // The segments, or NULL for a single string.
+    const char *const *segments;
+    const int32_t *lengths;
+    // Storage for the segment pointer and length of a single string
+    //   opened with utext_openUTF8().
+    const char *singleSegment;
+    int32_t     singleLength;
+    // UChars in the chunk buffer, not counting room for one surrogate pair
+    //   and the limit entry of the native offsets.
+    int32_t     chunkCapacity;
+    // Followed by
+    //   int64_t segmentStarts[segmentCount+1]
+    //   int32_t chunkNativeOffsets[chunkCapacity+3]
+    //   UChar   chunk[chunkCapacity+2]
+};
+
+static inline const char *const *
+utf8SegmentsPointers(const UText *ut) {
+    const UTF8SegmentsExtra *extra = (const UTF8SegmentsExtra *)ut->p;
+    return extra->segments != NULL ? extra->segments : &extra->singleSegment;
+}
+
+static inline const int32_t *
+utf8SegmentsLengths(const UText *ut) {
+    const UTF8SegmentsExtra *extra = (const UTF8SegmentsExtra *)ut->p;
+    return extra->lengths != NULL ? extra->lengths : &extra->singleLength;
+}
+
+U_CDECL_BEGIN
+
+// Returns the index of the segment that contains native index ix, 0<=ix<length.
+static int32_t
+utf8SegmentsFind(UText *ut, int64_t ix) {
+    const int64_t *starts = (const int64_t *)ut->q;
+    int32_t k = ut->c;
+    if (!(starts[k] <= ix && ix < starts[k + 1])) {
+        // Binary search for the last segment that starts at or before ix.
+        //   Empty segments start where the next one does and are skipped.
+        int32_t start = 0, limit = ut->b;
+        while (start + 1 < limit) {
+            int32_t mid = (start + limit) / 2;
+            if (starts[mid] <= ix) {
+                start = mid;
+            } else {
+                limit = mid;
+            }
+        }
+        k = start;
+        while (starts[k + 1] <= ix) { ++k; }
+        ut->c = k;
+    }
+    return k;
+}
+
+// Copies up to capacity bytes starting at native index ix, crossing segment boundaries.
+static int32_t
+utf8SegmentsGetBytes(UText *ut, int64_t ix, uint8_t *dest, int32_t capacity) {
+    if (capacity > ut->a - ix) {
+        capacity = (int32_t)(ut->a - ix);
+    }
+    if (capacity <= 0) {
+        return 0;
+    }
+    const char *const *segments = utf8SegmentsPointers(ut);
+    const int32_t *lengths = utf8SegmentsLengths(ut);
+    int32_t k = utf8SegmentsFind(ut, ix);
+    int32_t offset = (int32_t)(ix - ((const int64_t *)ut->q)[k]);
+    int32_t length = 0;
+    while (length < capacity) {
+        if (offset == lengths[k]) {
+            ++k;
+            offset = 0;
+            continue;
+        }
+        dest[length++] = (uint8_t)segments[k][offset++];
+    }
+    return length;
+}
+
+// Moves the native index back to the start of the code point that contains it,
+//   consistent with U8_SET_CP_START().
+static int64_t
+utf8SegmentsCPStart(UText *ut, int64_t ix) {
+    if (ix <= 0 || ix >= ut->a) {
+        return ix;
+    }
+    uint8_t bytes[4];
+    int64_t start = ix >= 3 ? ix - 3 : 0;
+    int32_t i = (int32_t)(ix - start);
+    utf8SegmentsGetBytes(ut, start, bytes, i + 1);
+    if (U8_IS_TRAIL(bytes[i])) {
+        U8_SET_CP_START(bytes, 0, i);
+    }
+    return start + i;
+}
+
+static UChar *
+utf8SegmentsChunk(const UText *ut) {
+    return (UChar *)((const int32_t *)ut->r +
+                     ((const UTF8SegmentsExtra *)ut->p)->chunkCapacity + 3);
+}
+
+// Converts the text from native index start, which must be on a code point boundary,
+//   into the chunk buffer, up to the chunk capacity.
+static void
+utf8SegmentsFill(UText *ut, int64_t start) {
+    const char *const *segments = utf8SegmentsPointers(ut);
+    const int32_t *lengths = utf8SegmentsLengths(ut);
+    int32_t capacity = ((const UTF8SegmentsExtra *)ut->p)->chunkCapacity;
+    int32_t *toNative = (int32_t *)ut->r;
+    UChar *chunk = utf8SegmentsChunk(ut);
+    int64_t length = ut->a;
+    int32_t destIx = 0;
+    int32_t nativeIndexingLimit = -1;
+    int32_t nativeOffset = 0;  // from start
+    if (start < length) {
+        int32_t k = utf8SegmentsFind(ut, start);
+        const uint8_t *segment = (const uint8_t *)segments[k];
+        int32_t segmentLength = lengths[k];
+        int32_t offset = (int32_t)(start - ((const int64_t *)ut->q)[k]);
+        int64_t remaining = length - start;
+        while (destIx < capacity && nativeOffset < remaining) {
+            while (offset == segmentLength) {
+                segment = (const uint8_t *)segments[++k];
+                segmentLength = lengths[k];
+                offset = 0;
+            }
+            uint8_t b = segment[offset];
+            if (U8_IS_SINGLE(b)) {
+                // Copy a run of ASCII from this segment.
+                int32_t runLimit = offset + (capacity - destIx);
+                if (runLimit > segmentLength) {
+                    runLimit = segmentLength;
+                }
+                do {
+                    chunk[destIx] = b;
+                    toNative[destIx++] = nativeOffset++;
+                } while (++offset < runLimit && U8_IS_SINGLE(b = segment[offset]));
+            } else {
+                if (nativeIndexingLimit < 0) {
+                    nativeIndexingLimit = destIx;
+                }
+                UChar32 c;
+                int32_t i = 0;
+                if (segmentLength - offset >= 4) {
+                    U8_NEXT_OR_FFFD(segment + offset, i, 4, c);
+                } else {
+                    // The sequence may continue in the following segments.
+                    uint8_t bytes[4];
+                    int32_t n = utf8SegmentsGetBytes(ut, start + nativeOffset, bytes, 4);
+                    U8_NEXT_OR_FFFD(bytes, i, n, c);
+                }
+                if (c <= 0xffff) {
+                    chunk[destIx] = (UChar)c;
+                    toNative[destIx++] = nativeOffset;
+                } else {
+                    // The buffer has room for a surrogate pair at the end.
+                    chunk[destIx] = U16_LEAD(c);
+                    toNative[destIx++] = nativeOffset;
+                    chunk[destIx] = U16_TRAIL(c);
+                    toNative[destIx++] = nativeOffset;
+                }
+                nativeOffset += i;
+                // Skip the bytes, which may span segments.
+                offset += i;
+                while (offset > segmentLength) {
+                    offset -= segmentLength;
+                    segmentLength = lengths[++k];
+                    segment = (const uint8_t *)segments[k];
+                }
+            }
+        }
+    }
+    toNative[destIx] = nativeOffset;
+    ut->chunkContents = chunk;
+    ut->chunkLength = destIx;
+    ut->chunkOffset = 0;
+    ut->chunkNativeStart = start;
+    ut->chunkNativeLimit = start + nativeOffset;
+    ut->nativeIndexingLimit = nativeIndexingLimit >= 0 ? nativeIndexingLimit : destIx;
+}
+
+static int32_t U_CALLCONV
+utf8SegmentsMapIndexToUTF16(const UText *ut, int64_t index) {
+    int32_t nativeOffset = (int32_t)(index - ut->chunkNativeStart);
+    U_ASSERT(nativeOffset >= 0 && index <= ut->chunkNativeLimit);
+    if (nativeOffset <= ut->nativeIndexingLimit) {
+        return nativeOffset;
+    }
+    // Find the last chunk offset with a native offset at or before the index.
+    const int32_t *toNative = (const int32_t *)ut->r;
+    int32_t start = ut->nativeIndexingLimit, limit = ut->chunkLength + 1;
+    while (start + 1 < limit) {
+        int32_t mid = (start + limit) / 2;
+        if (toNative[mid] <= nativeOffset) {
+            start = mid;
+        } else {
+            limit = mid;
+        }
+    }
+    // Not on a trail surrogate.
+    if (start > 0 && toNative[start - 1] == toNative[start]) {
+        --start;
+    }
+    return start;
+}
+
+static int64_t U_CALLCONV
+utf8SegmentsMapOffsetToNative(const UText *ut) {
+    U_ASSERT(ut->chunkOffset >= 0 && ut->chunkOffset <= ut->chunkLength);
+    return ut->chunkNativeStart + ((const int32_t *)ut->r)[ut->chunkOffset];
+}
+
+static int64_t U_CALLCONV
+utf8SegmentsLength(UText *ut) {
+    return ut->a;
+}
+
+// Sets up a zero-length chunk at the index, for an access at the start or end
+//   of the text that continues out of bounds.
+static void
+utf8SegmentsStub(UText *ut, int64_t ix) {
+    ((int32_t *)ut->r)[0] = 0;
+    ut->chunkContents = utf8SegmentsChunk(ut);
+    ut->chunkLength = 0;
+    ut->chunkOffset = 0;
+    ut->chunkNativeStart = ix;
+    ut->chunkNativeLimit = ix;
+    ut->nativeIndexingLimit = 0;
+}
+
+static UBool U_CALLCONV
+utf8SegmentsAccess(UText *ut, int64_t index, UBool forward) {
+    int64_t length = ut->a;
+    int64_t ix = index < 0 ? 0 : index > length ? length : index;
+    int32_t capacity = ((const UTF8SegmentsExtra *)ut->p)->chunkCapacity;
+    if (forward) {
+        if (ix == length) {
+            if (ut->chunkNativeLimit != length) {
+                utf8SegmentsStub(ut, ix);
+            }
+            ut->chunkOffset = ut->chunkLength;
+            return FALSE;
+        }
+        if (!(ut->chunkNativeStart <= ix && ix < ut->chunkNativeLimit)) {
+            utf8SegmentsFill(
+                ut, utf8SegmentsCPStart(ut, ix > UTF8_SEGMENTS_OVERLAP ? ix - UTF8_SEGMENTS_OVERLAP : 0));
+        }
+        ut->chunkOffset = utf8SegmentsMapIndexToUTF16(ut, ix);
+        return TRUE;
+    } else {
+        ix = utf8SegmentsCPStart(ut, ix);
+        if (ix == 0) {
+            if (ut->chunkNativeStart != 0) {
+                utf8SegmentsStub(ut, 0);
+            }
+            ut->chunkOffset = 0;
+            return FALSE;
+        }
+        if (!(ut->chunkNativeStart < ix && ix <= ut->chunkNativeLimit)) {
+            // Fill a chunk that ends after ix: Each byte yields at most one UChar,
+            //   and the code point start moves back by at most three bytes.
+            int64_t back = capacity - UTF8_SEGMENTS_OVERLAP - 8;
+            utf8SegmentsFill(ut, utf8SegmentsCPStart(ut, ix > back ? ix - back : 0));
+            U_ASSERT(ut->chunkNativeStart < ix && ix <= ut->chunkNativeLimit);
+        }
+        ut->chunkOffset = utf8SegmentsMapIndexToUTF16(ut, ix);
+        return TRUE;
+    }
+}
+
+static int32_t U_CALLCONV
+utf8SegmentsExtract(UText *ut,
+                    int64_t start, int64_t limit,
+                    UChar *dest, int32_t destCapacity,
+                    UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(destCapacity<0 || (dest==NULL && destCapacity>0)) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int64_t length = ut->a;
+    start = start < 0 ? 0 : start > length ? length : start;
+    limit = limit < 0 ? 0 : limit > length ? length : limit;
+    if(start>limit) {
+        *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    start = utf8SegmentsCPStart(ut, start);
+    limit = utf8SegmentsCPStart(ut, limit);
+
+    const char *const *segments = utf8SegmentsPointers(ut);
+    const int32_t *lengths = utf8SegmentsLengths(ut);
+    int32_t destLength = 0;
+    int64_t ix = start;
+    while (ix < limit) {
+        int32_t k = utf8SegmentsFind(ut, ix);
+        const uint8_t *segment = (const uint8_t *)segments[k];
+        int32_t offset = (int32_t)(ix - ((const int64_t *)ut->q)[k]);
+        int32_t segmentLimit = lengths[k];
+        if (segmentLimit - offset > limit - ix) {
+            segmentLimit = offset + (int32_t)(limit - ix);
+        }
+        // Convert the part of this segment with complete code points.
+        while (offset < segmentLimit) {
+            uint8_t b = segment[offset];
+            UChar32 c;
+            if (U8_IS_SINGLE(b)) {
+                c = b;
+                ++offset;
+                ++ix;
+            } else {
+                int32_t i = 0;
+                if (segmentLimit - offset >= 4) {
+                    U8_NEXT_OR_FFFD(segment + offset, i, 4, c);
+                } else {
+                    uint8_t bytes[4];
+                    int32_t n = utf8SegmentsGetBytes(ut, ix, bytes, 4);
+                    if (n > limit - ix) {
+                        n = (int32_t)(limit - ix);
+                    }
+                    U8_NEXT_OR_FFFD(bytes, i, n, c);
+                }
+                offset += i;
+                ix += i;
+            }
+            if (c <= 0xffff) {
+                if (destLength < destCapacity) {
+                    dest[destLength] = (UChar)c;
+                }
+                ++destLength;
+            } else {
+                if (destLength + 1 < destCapacity) {
+                    dest[destLength] = U16_LEAD(c);
+                    dest[destLength + 1] = U16_TRAIL(c);
+                }
+                destLength += 2;
+            }
+            if (destLength < 0) {
+                *pErrorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+                return 0;
+            }
+        }
+    }
+    u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
+    utf8SegmentsAccess(ut, limit, TRUE);
+    return destLength;
+}
+
+static UText * U_CALLCONV
+utf8SegmentsClone(UText *dest, const UText *src, UBool deep, UErrorCode *status) {
+    dest = shallowTextClone(dest, src, status);
+
+    // For deep clones, copy the segments into one block of memory
+    //   which is owned by the clone, keeping the segment boundaries.
+    if (deep && U_SUCCESS(*status)) {
+        int32_t count = src->b;
+        const char *const *segments = utf8SegmentsPointers(src);
+        const int32_t *lengths = utf8SegmentsLengths(src);
+        size_t arraysSize = (size_t)count * (sizeof(const char *) + sizeof(int32_t));
+        char *block = (char *)uprv_malloc(arraysSize + (size_t)src->a + 1);
+        if (block == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return dest;
+        }
+        const char **newSegments = (const char **)block;
+        int32_t *newLengths = (int32_t *)(newSegments + count);
+        char *text = block + arraysSize;
+        for (int32_t k = 0; k < count; ++k) {
+            uprv_memcpy(text, segments[k], lengths[k]);
+            newSegments[k] = text;
+            newLengths[k] = lengths[k];
+            text += lengths[k];
+        }
+        UTF8SegmentsExtra *extra = (UTF8SegmentsExtra *)dest->p;
+        extra->segments = newSegments;
+        extra->lengths = newLengths;
+        dest->context = block;
+        dest->providerProperties |= I32_FLAG(UTEXT_PROVIDER_OWNS_TEXT);
+    }
+    return dest;
+}
+
+static void U_CALLCONV
+utf8SegmentsClose(UText *ut) {
+    // The text is owned only by deep clones, in one block of memory.
+    if (ut->providerProperties & I32_FLAG(UTEXT_PROVIDER_OWNS_TEXT)) {
+        uprv_free((void *)ut->context);
+        ut->context = NULL;
+    }
+}
+
+U_CDECL_END
+
+
+static const struct UTextFuncs utf8SegmentsFuncs =
+{
+    sizeof(UTextFuncs),
+    0, 0, 0,             // Reserved alignment padding
+    utf8SegmentsClone,
+    utf8SegmentsLength,
+    utf8SegmentsAccess,
+    utf8SegmentsExtract,
+    NULL,                /* replace*/
+    NULL,                /* copy   */
+    utf8SegmentsMapOffsetToNative,
+    utf8SegmentsMapIndexToUTF16,
+    utf8SegmentsClose,
+    NULL,                // spare 1
+    NULL,                // spare 2
+    NULL                 // spare 3
+};
+
+static UText *
+openUTF8Segments(UText *ut, const char *const *segments, const int32_t *lengths, int32_t count,
+                 UBool isSingleString, UErrorCode *status) {
+    int64_t length = 0;
+    for (int32_t k = 0; k < count; ++k) {
+        if (lengths[k] < 0 || (segments[k] == NULL && lengths[k] > 0)) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return NULL;
+        }
+        length += lengths[k];
+    }
+    // Each byte yields at most one UChar: Shorter texts fit into one chunk.
+    int32_t capacity = length < UTF8_SEGMENTS_MIN_CHUNK ? (int32_t)UTF8_SEGMENTS_MIN_CHUNK :
+        length < UTF8_SEGMENTS_MAX_CHUNK ? (int32_t)length : (int32_t)UTF8_SEGMENTS_MAX_CHUNK;
+    int32_t startsSize = (count + 1) * (int32_t)sizeof(int64_t);
+    int32_t extraSize = (int32_t)sizeof(UTF8SegmentsExtra) + startsSize +
+        (capacity + 3) * (int32_t)sizeof(int32_t) + (capacity + 2) * U_SIZEOF_UCHAR;
+
+    ut = utext_setup(ut, extraSize, status);
+    if (U_FAILURE(*status)) {
+        return ut;
+    }
+    UTF8SegmentsExtra *extra = (UTF8SegmentsExtra *)ut->pExtra;
+    extra->chunkCapacity = capacity;
+    int64_t *starts = (int64_t *)(extra + 1);
+    int64_t start = 0;
+    for (int32_t k = 0; k < count; ++k) {
+        starts[k] = start;
+        start += lengths[k];
+    }
+    starts[count] = start;
+
+    ut->pFuncs = &utf8SegmentsFuncs;
+    if (isSingleString) {
+        extra->segments = NULL;
+        extra->lengths = NULL;
+        extra->singleSegment = segments[0];
+        extra->singleLength = lengths[0];
+        ut->context = segments[0];
+    } else {
+        extra->segments = segments;
+        extra->lengths = lengths;
+        ut->context = segments;
+    }
+    ut->p = extra;
+    ut->q = starts;
+    ut->r = starts + count + 1;
+    ut->a = length;
+    ut->b = count;
+    ut->c = 0;
+    utf8SegmentsStub(ut, 0);
+    return ut;
+}
+
+U_CAPI UText * U_EXPORT2
+utext_openUTF8Segments(UText *ut, const char *const *segments, const int32_t *lengths,
+                       int32_t count, UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return NULL;
+    }
+    if (count < 0 || (count > 0 && (segments == NULL || lengths == NULL)) ||
+            count > (INT32_MAX / 2) / (int32_t)sizeof(int64_t)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    return openUTF8Segments(ut, segments, lengths, count, FALSE, status);
+}
+
+
 //------------------------------------------------------------------------------
 //
 //     UText implementation wrapper for Replaceable (read/write)
@@ -298,6 +298,35 @@ static const int8_t asciiData[128]={
      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1, -1, -1, -1
 };
 
+// The UTF-8 ASCII fastpath processes runs of letters and digits eight bytes at a time.
+static const uint64_t ASCII_ONES=0x0101010101010101;
+static const uint64_t ASCII_HIGH_BITS=0x8080808080808080;
+
+// Returns the high bit (0x80) set in each byte of the all-ASCII word
+// whose value is in [lo..hi].
+static inline uint64_t
+asciiRangeBits(uint64_t word, uint8_t lo, uint8_t hi) {
+    uint64_t geLo=word+ASCII_ONES*(0x80-lo);
+    uint64_t gtHi=word+ASCII_ONES*(0x7f-hi);
+    return geLo&~gtHi&ASCII_HIGH_BITS;
+}
+
+// Returns the number of bytes in memory order before the first one
+// whose high bit is set in the non-zero mask.
+static inline int32_t
+bytesBeforeHighBit(uint64_t mask) {
+#if U_IS_BIG_ENDIAN
+    // Set the high bits of all of the bytes after the first one, and count them.
+    mask|=mask>>8;
+    mask|=mask>>16;
+    mask|=mask>>32;
+    return 8-(int32_t)((((mask>>7)&ASCII_ONES)*ASCII_ONES)>>56);
+#else
+    // Set the low bits of all of the bytes before the lowest one, and count them.
+    return (int32_t)((((((mask&(0-mask))-1)>>7)&ASCII_ONES)*ASCII_ONES)>>56);
+#endif
+}
+
 UnicodeString &
 UTS46::process(const UnicodeString &src,
                UBool isLabel, UBool toASCII,
@@ -434,6 +463,23 @@ UTS46::processUTF8(StringPiece src,
         UBool disallowNonLDHDot=(options&UIDNA_USE_STD3_RULES)!=0;
         int32_t i;
         for(i=0;; ++i) {
+            if((i+8)<=srcLength) {
+                uint64_t word;
+                uprv_memcpy(&word, srcArray+i, 8);
+                if((word&ASCII_HIGH_BITS)==0) {
+                    word|=asciiRangeBits(word, 0x41, 0x5a)>>2;  // Lowercase A-Z.
+                    uprv_memcpy(destArray+i, &word, 8);
+                    uint64_t other=
+                        ~(asciiRangeBits(word, 0x61, 0x7a)|asciiRangeBits(word, 0x30, 0x39))&
+                        ASCII_HIGH_BITS;
+                    if(other==0) {
+                        i+=7;  // Eight letters and digits.
+                        continue;
+                    }
+                    // Skip the letters and digits before a hyphen, dot or other character.
+                    i+=bytesBeforeHighBit(other);
+                }
+            }
             if(i==srcLength) {
                 if(toASCII) {
                     if((i-labelStart)>63) {
@@ -1481,4 +1527,51 @@ uidna_nameToUnicodeUTF8(const UIDNA *idna,
     return u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
 }
 
+U_CAPI int32_t U_EXPORT2
+uidna_namesToASCII_UTF8(const UIDNA *idna,
+                        const char *const *names, const int32_t *lengths, int32_t count,
+                        char *dest, int32_t capacity,
+                        int32_t *destIndexes, uint32_t *errors,
+                        UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if( count<0 || (count>0 && names==NULL) ||
+        (dest==NULL ? capacity!=0 : capacity<0)
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Append all of the results to the same sink, reusing the same IDNAInfo.
+    const IDNA *impl=reinterpret_cast<const IDNA *>(idna);
+    CheckedArrayByteSink sink(dest, capacity);
+    IDNAInfo info;
+    for(int32_t i=0; i<count; ++i) {
+        const char *name=names[i];
+        int32_t length=lengths!=NULL ? lengths[i] : -1;
+        if(name==NULL ? length!=0 : length<-1) {
+            *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        if(length<0) {
+            length=static_cast<int32_t>(uprv_strlen(name));
+        }
+        if(destIndexes!=NULL) {
+            destIndexes[i]=sink.NumberOfBytesAppended();
+        }
+        impl->nameToASCII_UTF8(StringPiece(name, length), sink, info, *pErrorCode);
+        if(U_FAILURE(*pErrorCode)) {
+            return 0;
+        }
+        if(errors!=NULL) {
+            errors[i]=info.getErrors();
+        }
+        sink.Append("", 1);  // NUL terminator
+    }
+    if(sink.Overflowed()) {
+        *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+    }
+    return sink.NumberOfBytesAppended();
+}
+
 #endif  // UCONFIG_NO_IDNA
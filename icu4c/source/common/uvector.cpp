@@ -77,7 +77,7 @@ void UVector::_init(int32_t initialCapacity, UErrorCode &status) {
     if ((initialCapacity < 1) || (initialCapacity > (int32_t)(INT32_MAX / sizeof(UElement)))) {
         initialCapacity = DEFAULT_CAPACITY;
     }
-    elements = (UElement *)uprv_malloc(sizeof(UElement)*initialCapacity);
+    elements = (UElement *)uprv_sizedMalloc(sizeof(UElement)*initialCapacity);
     if (elements == 0) {
         status = U_MEMORY_ALLOCATION_ERROR;
     } else {
@@ -87,7 +87,7 @@ void UVector::_init(int32_t initialCapacity, UErrorCode &status) {
 
 UVector::~UVector() {
     removeAllElements();
-    uprv_free(elements);
+    uprv_sizedFree(elements, sizeof(UElement)*capacity);
     elements = 0;
 }
 
@@ -347,7 +347,8 @@ UBool UVector::ensureCapacity(int32_t minimumCapacity, UErrorCode &status) {
         	status = U_ILLEGAL_ARGUMENT_ERROR;
         	return FALSE;
         }
-        UElement* newElems = (UElement *)uprv_realloc(elements, sizeof(UElement)*newCap);
+        UElement* newElems = (UElement *)uprv_sizedRealloc(elements, sizeof(UElement)*capacity,
+                                                           sizeof(UElement)*newCap);
         if (newElems == NULL) {
             // We keep the original contents on the memory failure on realloc or bad minimumCapacity.
             status = U_MEMORY_ALLOCATION_ERROR;
@@ -49,6 +49,7 @@
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "collationdata.h"
+#include "collationsort.h"
 #include "collationroot.h"
 #include "collationtailoring.h"
 #include "ucol_imp.h"
@@ -658,6 +659,49 @@ int32_t U_EXPORT2 Collator::getBound(const uint8_t       *source,
     return ucol_getBound(source, sourceLength, boundType, noOfLevels, result, resultLength, &status);
 }
 
+void
+Collator::sort(UnicodeString *strings, int32_t count,
+               UCollationExecutor *executor, void *executorContext,
+               UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (count > 0 && strings == NULL)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    MaybeStackArray<const UChar *, 64> chars(count);
+    MaybeStackArray<int32_t, 64> lengths(count);
+    MaybeStackArray<int32_t, 64> indexes(count);
+    if(chars.getCapacity() < count || lengths.getCapacity() < count ||
+            indexes.getCapacity() < count) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        chars[i] = strings[i].getBuffer();
+        lengths[i] = strings[i].length();
+        if(chars[i] == NULL) {  // bogus string
+            chars[i] = u"";
+            lengths[i] = 0;
+        }
+    }
+    CollationSort::sortIndexes(*this, chars.getAlias(), lengths.getAlias(), count,
+                               executor, executorContext, indexes.getAlias(), errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    // Permute the strings: Follow each cycle of the permutation,
+    // swapping the strings into place, and mark the visited indexes.
+    for(int32_t i = 0; i < count; ++i) {
+        if(indexes[i] < 0) { continue; }
+        int32_t j = i;
+        int32_t k;
+        while((k = indexes[j]) != i) {
+            strings[j].swap(strings[k]);
+            indexes[j] = -1;
+            j = k;
+        }
+        indexes[j] = -1;
+    }
+}
+
 void
 Collator::setLocales(const Locale& /* requestedLocale */, const Locale& /* validLocale */, const Locale& /*actualLocale*/) {
 }
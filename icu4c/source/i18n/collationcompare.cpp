@@ -28,6 +28,7 @@ U_NAMESPACE_BEGIN
 UCollationResult
 CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
                                         const CollationSettings &settings,
+                                        UBool prefixOnly,
                                         UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
 
@@ -94,6 +95,12 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
             }
         } while(rightPrimary == 0);
 
+        if(rightPrimary == Collation::NO_CE_PRIMARY && prefixOnly) {
+            // Ignore the rest of the left string, starting with its current CE.
+            // The lower levels then compare only the parts of the strings up to here.
+            left.setCurrentCE(Collation::NO_CE);
+            break;
+        }
         if(leftPrimary != rightPrimary) {
             // Return the primary difference, with script reordering.
             if(settings.hasReordering()) {
@@ -351,6 +358,10 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
     return UCOL_EQUAL;
 }
 
+CollationComparand::~CollationComparand() {
+    delete iter;
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -19,19 +19,62 @@
 #if !UCONFIG_NO_COLLATION
 
 #include "unicode/ucol.h"
+#include "unicode/unistr.h"
+#include "unicode/uobject.h"
 
 U_NAMESPACE_BEGIN
 
 class CollationIterator;
+class RuleBasedCollator;
 struct CollationSettings;
 
 class U_I18N_API CollationCompare /* not : public UObject because all methods are static */ {
 public:
+    static inline UCollationResult compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
+                                                         const CollationSettings &settings,
+                                                         UErrorCode &errorCode) {
+        return compareUpToQuaternary(left, right, settings, FALSE, errorCode);
+    }
+
+    /**
+     * Compares the CEs of the two iterators up to the quaternary level.
+     * If prefixOnly is TRUE, then the left CEs are truncated where the right ones end
+     * (before the next left CE with a non-zero primary weight),
+     * so that the result is UCOL_EQUAL when the left string starts with
+     * a prefix that is equal to the right string.
+     */
     static UCollationResult compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
                                                   const CollationSettings &settings,
+                                                  UBool prefixOnly,
                                                   UErrorCode &errorCode);
 };
 
+/**
+ * A string prepared for repeated comparisons with other strings.
+ * Implements UCollationComparand.
+ *
+ * The collation elements of the string are buffered in its iterator
+ * the first time they are needed, and each further comparison rewinds
+ * and reuses them, so that only the other string's CEs are fetched from its text.
+ * The CEs are fetched anew if the collator's settings change.
+ *
+ * Not thread-safe: Comparisons modify the buffered CEs and the iterator state.
+ */
+class U_I18N_API CollationComparand : public UMemory {
+public:
+    CollationComparand(const RuleBasedCollator &coll, const UChar *s, int32_t length)
+            : collator(coll), source(s, length),
+              iter(NULL), options(0), variableTop(0) {}
+    ~CollationComparand();
+
+    const RuleBasedCollator &collator;
+    UnicodeString source;
+    CollationIterator *iter;
+    /** The settings for which the buffered CEs were fetched. */
+    int32_t options;
+    uint32_t variableTop;
+};
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -188,6 +188,11 @@ CollationIterator::operator==(const CollationIterator &other) const {
     return TRUE;
 }
 
+UBool
+CollationIterator::canResumeAtOffset() const {
+    return FALSE;
+}
+
 void
 CollationIterator::reset() {
     cesIndex = ceBuffer.length = 0;
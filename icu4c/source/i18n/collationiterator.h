@@ -123,6 +123,15 @@ class U_I18N_API CollationIterator : public UObject {
 
     virtual int32_t getOffset() const = 0;
 
+    /**
+     * Returns TRUE if iteration from getOffset() in a new iterator
+     * would return the same collation elements as continuing with this one,
+     * provided that all buffered CEs have been returned.
+     * Used for resuming sort key parts.
+     * The base class implementation always returns FALSE.
+     */
+    virtual UBool canResumeAtOffset() const;
+
     /**
      * Returns the next collation element.
      */
@@ -205,6 +214,15 @@ class U_I18N_API CollationIterator : public UObject {
         cesIndex = ceBuffer.length = 0;
     }
 
+    /**
+     * Moves back to the first buffered CE, so that nextCE() returns
+     * the buffered CEs again before it continues with the text.
+     * Used for comparing one string with several others.
+     */
+    void rewindCEs() {
+        cesIndex = 0;
+    }
+
     void clearCEsIfNoneRemaining() {
         if(cesIndex == ceBuffer.length) { clearCEs(); }
     }
@@ -236,6 +254,25 @@ class U_I18N_API CollationIterator : public UObject {
      */
     virtual uint32_t handleNextCE32(UChar32 &c, UErrorCode &errorCode);
 
+    /**
+     * For a handleNextCE32() lookahead fastpath:
+     * Returns TRUE if CEs for the following characters may be appended
+     * after the one for the current character, which is only the case in
+     * unlimited forward iteration from nextCE().
+     * Ensures capacity for maxCount more CEs.
+     */
+    inline UBool canAppendLookaheadCEs(int32_t maxCount, UErrorCode &errorCode) {
+        return numCpFwd < 0 && cesIndex == (ceBuffer.length - 1) &&
+            ceBuffer.ensureAppendCapacity(maxCount, errorCode);
+    }
+
+    /**
+     * Appends a lookahead CE after canAppendLookaheadCEs() returned TRUE.
+     */
+    inline void appendLookaheadCE(int64_t ce) {
+        ceBuffer.appendUnsafe(ce);
+    }
+
     /**
      * Called when handleNextCE32() returns a LEAD_SURROGATE_TAG for a lead surrogate code unit.
      * Returns the trail surrogate in that case and advances past it,
@@ -228,6 +228,7 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
                                           const CollationSettings &settings,
                                           SortKeyByteSink &sink,
                                           Collation::Level minLevel, LevelCallback &callback,
+                                          ResumePoint *resumePoint,
                                           UBool preflight, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return; }
 
@@ -265,9 +266,82 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
     uint32_t prevSecondary = 0;
     int32_t secSegmentStart = 0;
 
+    // Beyond-primary level that is written alone, continuing from the resumePoint.
+    SortKeyLevel *resumedLevel = NULL;
+    int32_t *resumedCommonWeights = NULL;
+    int32_t resumedCommonMaxCount = 0;
+    UBool resumedLevelHadBytes = FALSE;
+    UBool resumedLevelIsComplete = TRUE;
+    if(resumePoint != NULL) {
+        prevReorderedPrimary = resumePoint->prevReorderedPrimary;
+        if(minLevel == Collation::SECONDARY_LEVEL) {
+            U_ASSERT((options & CollationSettings::BACKWARD_SECONDARY) == 0);
+            resumedLevel = &secondaries;
+            resumedCommonWeights = &commonSecondaries;
+            resumedCommonMaxCount = SEC_COMMON_MAX_COUNT;
+        } else if(minLevel == Collation::TERTIARY_LEVEL) {
+            resumedLevel = &tertiaries;
+            resumedCommonWeights = &commonTertiaries;
+            if((tertiaryMask & 0x8000) == 0) {
+                resumedCommonMaxCount = TER_ONLY_COMMON_MAX_COUNT;
+            } else if((options & CollationSettings::UPPER_FIRST) == 0) {
+                resumedCommonMaxCount = TER_LOWER_FIRST_COMMON_MAX_COUNT;
+            } else {
+                resumedCommonMaxCount = TER_UPPER_FIRST_COMMON_MAX_COUNT;
+            }
+        } else if(minLevel == Collation::QUATERNARY_LEVEL) {
+            resumedLevel = &quaternaries;
+            resumedCommonWeights = &commonQuaternaries;
+            resumedCommonMaxCount = QUAT_COMMON_MAX_COUNT;
+        } else {
+            U_ASSERT(minLevel == Collation::PRIMARY_LEVEL);
+        }
+        if(resumedLevel != NULL) {
+            levels &= (uint32_t)1 << minLevel;
+            *resumedCommonWeights = resumePoint->commonWeights;
+            resumedLevelHadBytes = resumePoint->levelHasBytes;
+        }
+    }
+
     for(;;) {
         // No need to keep all CEs in the buffer when we write a sort key.
         iter.clearCEsIfNoneRemaining();
+        if(resumePoint != NULL) {
+            if(resumedLevel == NULL) {
+                if(iter.getCEsLength() == 0 && iter.canResumeAtOffset()) {
+                    resumePoint->offset = iter.getOffset();
+                    // The previous primary is only compared with the next one
+                    // when they differ in their lead bytes, or else in the second bytes
+                    // (with a reordering group boundary inside a lead byte).
+                    resumePoint->prevReorderedPrimary = prevReorderedPrimary & 0xffff0000;
+                    resumePoint->remainingCapacity = sink.GetRemainingCapacity();
+                }
+            } else {
+                int32_t remaining = sink.GetRemainingCapacity() - resumedLevel->length();
+                if(remaining < 0) {
+                    // The level bytes so far overflow the sink.
+                    resumedLevelIsComplete = FALSE;
+                    break;
+                }
+                if(iter.getCEsLength() == 0 && iter.canResumeAtOffset()) {
+                    // Account for the middle bytes that the pending common weights
+                    // will certainly produce, to keep the count small.
+                    int32_t common = *resumedCommonWeights;
+                    if(common > resumedCommonMaxCount) {
+                        int32_t middleBytes = (common - 1) / resumedCommonMaxCount;
+                        common -= middleBytes * resumedCommonMaxCount;
+                        remaining -= middleBytes;
+                    }
+                    if(remaining >= 0) {
+                        resumePoint->offset = iter.getOffset();
+                        resumePoint->commonWeights = common;
+                        resumePoint->levelHasBytes = resumedLevelHadBytes ||
+                            !resumedLevel->isEmpty() || common != *resumedCommonWeights;
+                        resumePoint->remainingCapacity = remaining;
+                    }
+                }
+            }
+        }
         int64_t ce = iter.nextCE(errorCode);
         uint32_t p = (uint32_t)(ce >> 32);
         if(p < variableTop && p > Collation::MERGE_SEPARATOR_PRIMARY) {
@@ -579,7 +653,7 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
                 ++commonQuaternaries;
             } else if(q == Collation::NO_CE_WEIGHT16 &&
                     (options & CollationSettings::ALTERNATE_MASK) == 0 &&
-                    quaternaries.isEmpty()) {
+                    quaternaries.isEmpty() && !resumedLevelHadBytes) {
                 // If alternate=non-ignorable and there are only common quaternary weights,
                 // then we need not write anything.
                 // The only weights greater than the merge separator and less than the common weight
@@ -618,6 +692,20 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
 
     if(U_FAILURE(errorCode)) { return; }
 
+    if(resumedLevel != NULL) {
+        // Append only the rest of the resumed level.
+        int32_t length = resumedLevel->length();
+        if(resumedLevelIsComplete) {
+            U_ASSERT(length > 0 && (*resumedLevel)[length - 1] == 1);
+            --length;  // Omit the terminator.
+        }
+        sink.Append(reinterpret_cast<const char *>(resumedLevel->data()), length);
+        if(!resumedLevel->isOk() || !sink.IsOk()) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+        return;
+    }
+
     // Append the beyond-primary levels.
     UBool ok = TRUE;
     if((levels & Collation::SECONDARY_LEVEL_FLAG) != 0) {
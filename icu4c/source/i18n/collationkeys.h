@@ -100,18 +100,50 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
         virtual UBool needToWrite(Collation::Level level);
     };
 
+    /**
+     * A text position from where one level can be written
+     * without iterating over the preceding text again.
+     * There are no CEs pending at such a position.
+     * The primary level continues with prevReorderedPrimary,
+     * the secondary, tertiary and quaternary levels with their
+     * number of pending common weights.
+     */
+    struct ResumePoint {
+        int32_t offset;
+        /** Only bits 31..16 are set; the lower bits do not affect the primary level. */
+        uint32_t prevReorderedPrimary;
+        /** Pending common weights, at most the level's ..._COMMON_MAX_COUNT. */
+        int32_t commonWeights;
+        /** TRUE if the level had any bytes before the offset. */
+        UBool levelHasBytes;
+        /**
+         * The number of bytes of the level after the offset
+         * that fit into the sink's remaining capacity.
+         */
+        int32_t remainingCapacity;
+    };
+
     /**
      * Writes the sort key bytes for minLevel up to the iterator data's strength.
      * Optionally writes the case level.
      * Stops writing levels when callback.needToWrite(level) returns FALSE.
      * Separates levels with the LEVEL_SEPARATOR_BYTE
      * but does not write a TERMINATOR_BYTE.
+     *
+     * If resumePoint is not NULL, then it is updated to the last position
+     * before the sink overflowed from where minLevel could be resumed.
+     * For the primary level, the iteration continues with its prevReorderedPrimary.
+     * For a secondary, tertiary or quaternary minLevel, only that level is written,
+     * continuing with its other fields, without the level separator,
+     * and writing stops soon after the sink overflowed.
+     * (The case level and backward secondary weights cannot be resumed.)
      */
     static void writeSortKeyUpToQuaternary(CollationIterator &iter,
                                            const UBool *compressibleBytes,
                                            const CollationSettings &settings,
                                            SortKeyByteSink &sink,
                                            Collation::Level minLevel, LevelCallback &callback,
+                                           ResumePoint *resumePoint,
                                            UBool preflight, UErrorCode &errorCode);
 private:
     friend struct CollationDataReader;
@@ -0,0 +1,287 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationsort.cpp
+// created: 2020feb10
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/coll.h"
+#include "unicode/localpointer.h"
+#include "unicode/ucol.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "collationsort.h"
+#include "cstring.h"
+#include "putilimp.h"
+#include "uarrsort.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+struct SortEntry {
+    const uint8_t *key;
+    int32_t index;
+};
+
+/** Sort keys of one chunk of strings, appended to one buffer. */
+struct SortChunk : public UMemory {
+    CharString keys;
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+struct SortContext {
+    SortContext(const Collator &c, const UChar *const *s, const int32_t *lengths, int32_t n)
+            : coll(c), strings(s), lengths(lengths), count(n) {}
+
+    const Collator &coll;
+    const UChar *const *strings;
+    const int32_t *lengths;
+    int32_t count;
+    int32_t chunkLength = 0;
+    SortChunk *chunks = nullptr;
+    SortEntry *entries = nullptr;
+    SortEntry *temp = nullptr;
+    // Pairwise merging of sorted runs from src into dest.
+    const SortEntry *src = nullptr;
+    SortEntry *dest = nullptr;
+    int32_t runLength = 0;
+    // Comparison sort of short arrays.
+    UErrorCode *errorCode = nullptr;
+};
+
+/** Initial append capacity for each sort key. Typical keys are shorter. */
+const int32_t MIN_KEY_CAPACITY = 64;
+/** Bucket length below which radixSort() switches to insertionSort(). */
+const int32_t MIN_RADIX_LENGTH = 32;
+
+/** Compares two NUL-terminated sort keys, starting at the given byte depth. */
+inline int32_t compareKeys(const uint8_t *left, const uint8_t *right, int32_t depth) {
+    return uprv_strcmp(reinterpret_cast<const char *>(left) + depth,
+                       reinterpret_cast<const char *>(right) + depth);
+}
+
+/** Stable insertion sort of entries whose keys are equal before depth. */
+void insertionSort(SortEntry *entries, int32_t length, int32_t depth) {
+    for(int32_t i = 1; i < length; ++i) {
+        SortEntry e = entries[i];
+        int32_t j = i;
+        while(j > 0 && compareKeys(entries[j - 1].key, e.key, depth) > 0) {
+            entries[j] = entries[j - 1];
+            --j;
+        }
+        entries[j] = e;
+    }
+}
+
+/**
+ * Stable MSD radix sort of entries whose keys are equal before depth.
+ * Distributes the entries by key byte into temp, which must have the same length.
+ * Recurses into all buckets but the largest one, and iterates on that,
+ * so that the recursion depth is at most logarithmic in the length.
+ */
+void radixSort(SortEntry *entries, SortEntry *temp, int32_t length, int32_t depth) {
+    while(length >= MIN_RADIX_LENGTH) {
+        int32_t counts[256];
+        uprv_memset(counts, 0, sizeof(counts));
+        for(int32_t i = 0; i < length; ++i) {
+            ++counts[entries[i].key[depth]];
+        }
+        int32_t largest = 0;
+        for(int32_t b = 1; b < 256; ++b) {
+            if(counts[b] > counts[largest]) { largest = b; }
+        }
+        if(counts[largest] == length) {
+            // All keys have the same byte here.
+            if(largest == 0) { return; }  // All keys are equal.
+            ++depth;
+            continue;
+        }
+        int32_t limits[256];
+        int32_t start = 0;
+        for(int32_t b = 0; b < 256; ++b) {
+            limits[b] = start;  // Bucket start, incremented to its limit while distributing.
+            start += counts[b];
+        }
+        for(int32_t i = 0; i < length; ++i) {
+            temp[limits[entries[i].key[depth]]++] = entries[i];
+        }
+        uprv_memcpy(entries, temp, (size_t)length * sizeof(SortEntry));
+        // Bucket 0 holds the keys that end here: They are equal and in stable order.
+        for(int32_t b = 1; b < 256; ++b) {
+            int32_t count = counts[b];
+            if(count > 1 && b != largest) {
+                int32_t bucketStart = limits[b] - count;
+                radixSort(entries + bucketStart, temp + bucketStart, count, depth + 1);
+            }
+        }
+        if(largest == 0) { return; }
+        int32_t largestStart = limits[largest] - counts[largest];
+        entries += largestStart;
+        temp += largestStart;
+        length = counts[largest];
+        ++depth;
+    }
+    insertionSort(entries, length, depth);
+}
+
+/** Task: Writes the sort keys for one chunk of strings and sorts them. */
+void U_CALLCONV sortChunk(void *context, int32_t chunkIndex) {
+    SortContext &sc = *static_cast<SortContext *>(context);
+    SortChunk &chunk = sc.chunks[chunkIndex];
+    UErrorCode &errorCode = chunk.errorCode;
+    int32_t start = chunkIndex * sc.chunkLength;
+    int32_t limit = uprv_min(start + sc.chunkLength, sc.count);
+    CharString &keys = chunk.keys;
+    for(int32_t i = start; i < limit; ++i) {
+        const UChar *s = sc.strings[i];
+        int32_t length = sc.lengths != nullptr ? sc.lengths[i] : -1;
+        int32_t capacity;
+        char *dest = keys.getAppendBuffer(MIN_KEY_CAPACITY, keys.length() + 1024,
+                                          capacity, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        int32_t keyLength = sc.coll.getSortKey(s, length, reinterpret_cast<uint8_t *>(dest), capacity);
+        if(keyLength > capacity) {
+            dest = keys.getAppendBuffer(keyLength, keys.length() + keyLength + 1024,
+                                        capacity, errorCode);
+            if(U_FAILURE(errorCode)) { return; }
+            keyLength = sc.coll.getSortKey(s, length, reinterpret_cast<uint8_t *>(dest), capacity);
+        }
+        if(keyLength <= 0 || keyLength > capacity) {
+            // getSortKey() returns 0 if it failed, normally for lack of memory.
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        // Remember the key offset; the buffer may still move.
+        sc.entries[i].index = keys.length();
+        keys.append(dest, keyLength, errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    // The key buffer does not move any more: Turn the offsets into pointers.
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(keys.data());
+    for(int32_t i = start; i < limit; ++i) {
+        sc.entries[i].key = base + sc.entries[i].index;
+        sc.entries[i].index = i;
+    }
+    radixSort(sc.entries + start, sc.temp + start, limit - start, 0);
+}
+
+/** Task: Merges two adjacent sorted runs (or copies a single trailing run). */
+void U_CALLCONV mergeRuns(void *context, int32_t pairIndex) {
+    SortContext &sc = *static_cast<SortContext *>(context);
+    int32_t start = pairIndex * 2 * sc.runLength;
+    int32_t middle = uprv_min(start + sc.runLength, sc.count);
+    int32_t limit = uprv_min(middle + sc.runLength, sc.count);
+    const SortEntry *src = sc.src;
+    SortEntry *dest = sc.dest;
+    int32_t i = start;
+    int32_t j = middle;
+    int32_t k = start;
+    while(i < middle && j < limit) {
+        // Take from the left run when equal, for stability.
+        if(compareKeys(src[j].key, src[i].key, 0) < 0) {
+            dest[k++] = src[j++];
+        } else {
+            dest[k++] = src[i++];
+        }
+    }
+    if(i < middle) {
+        uprv_memcpy(dest + k, src + i, (size_t)(middle - i) * sizeof(SortEntry));
+    } else if(j < limit) {
+        uprv_memcpy(dest + k, src + j, (size_t)(limit - j) * sizeof(SortEntry));
+    }
+}
+
+void runTasks(UCollationExecutor *executor, void *executorContext,
+              UCollationTask *task, void *taskContext, int32_t taskCount) {
+    if(executor == nullptr || taskCount == 1) {
+        for(int32_t i = 0; i < taskCount; ++i) {
+            task(taskContext, i);
+        }
+    } else {
+        executor(executorContext, task, taskContext, taskCount);
+    }
+}
+
+int32_t U_CALLCONV
+compareStringsAt(const void *context, const void *left, const void *right) {
+    const SortContext &sc = *static_cast<const SortContext *>(context);
+    int32_t l = *static_cast<const int32_t *>(left);
+    int32_t r = *static_cast<const int32_t *>(right);
+    return sc.coll.compare(sc.strings[l], sc.lengths != nullptr ? sc.lengths[l] : -1,
+                           sc.strings[r], sc.lengths != nullptr ? sc.lengths[r] : -1,
+                           *sc.errorCode);
+}
+
+}  // namespace
+
+void
+CollationSort::sortIndexes(const Collator &coll,
+                           const UChar *const *strings, const int32_t *lengths, int32_t count,
+                           UCollationExecutor *executor, void *executorContext,
+                           int32_t *indexes, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (count > 0 && (strings == nullptr || indexes == nullptr))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    SortContext sc(coll, strings, lengths, count);
+    if(count < MIN_SORT_KEY_COUNT) {
+        for(int32_t i = 0; i < count; ++i) {
+            indexes[i] = i;
+        }
+        sc.errorCode = &errorCode;
+        uprv_sortArray(indexes, count, (int32_t)sizeof(int32_t),
+                       compareStringsAt, &sc, TRUE, &errorCode);
+        return;
+    }
+
+    // With an executor, split the strings into chunks for parallel sort key generation
+    // and sorting. Without one, a single radix sort is faster than sorting and merging chunks.
+    int32_t chunkCount = 1;
+    if(executor != nullptr) {
+        chunkCount = uprv_max(1, uprv_min(count / MIN_CHUNK_LENGTH, MAX_CHUNKS));
+    }
+    sc.chunkLength = (count + chunkCount - 1) / chunkCount;
+    chunkCount = (count + sc.chunkLength - 1) / sc.chunkLength;
+    LocalArray<SortChunk> chunks(new SortChunk[chunkCount], errorCode);
+    LocalMemory<SortEntry> entries;
+    LocalMemory<SortEntry> temp;
+    if(U_FAILURE(errorCode)) { return; }
+    if(entries.allocateInsteadAndReset(count) == nullptr ||
+            temp.allocateInsteadAndReset(count) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    sc.chunks = chunks.getAlias();
+    sc.entries = entries.getAlias();
+    sc.temp = temp.getAlias();
+    runTasks(executor, executorContext, sortChunk, &sc, chunkCount);
+    for(int32_t c = 0; c < chunkCount; ++c) {
+        if(U_FAILURE(chunks[c].errorCode)) {
+            errorCode = chunks[c].errorCode;
+            return;
+        }
+    }
+
+    // Merge the sorted chunks pairwise, alternating between the two arrays.
+    sc.src = sc.entries;
+    sc.dest = sc.temp;
+    for(sc.runLength = sc.chunkLength; sc.runLength < count; sc.runLength *= 2) {
+        int32_t runCount = (count + sc.runLength - 1) / sc.runLength;
+        runTasks(executor, executorContext, mergeRuns, &sc, (runCount + 1) / 2);
+        SortEntry *merged = sc.dest;
+        sc.dest = const_cast<SortEntry *>(sc.src);
+        sc.src = merged;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        indexes[i] = sc.src[i].index;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
@@ -0,0 +1,67 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationsort.h
+// created: 2020feb10
+
+#ifndef __COLLATIONSORT_H__
+#define __COLLATIONSORT_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/ucol.h"
+
+U_NAMESPACE_BEGIN
+
+class Collator;
+
+/**
+ * Sorts arrays of strings according to a collator.
+ * Implements Collator::sort() and ucol_sortStrings().
+ *
+ * Short arrays are sorted with a stable comparison sort.
+ * Otherwise the array is split into chunks, and for each chunk
+ * the sort keys are written into one buffer and radix-sorted (MSD, on the key bytes).
+ * The sorted chunks are then merged pairwise.
+ * Each of these steps runs one task per chunk (or pair of chunks) via the executor, if any.
+ */
+class U_I18N_API CollationSort /* not : public UObject because all methods are static */ {
+public:
+    /**
+     * Computes the stable collation order of the strings.
+     * Sets indexes[i] to the index of the string that sorts at position i.
+     *
+     * @param coll the collator
+     * @param strings the strings
+     * @param lengths the string lengths (-1 if NUL-terminated), or NULL if all are NUL-terminated
+     * @param count the number of strings
+     * @param executor runs tasks, or NULL to run them on the calling thread
+     * @param executorContext passed through to the executor
+     * @param indexes receives the permutation; must have count elements
+     * @param errorCode in/out ICU error code
+     */
+    static void sortIndexes(const Collator &coll,
+                            const UChar *const *strings, const int32_t *lengths, int32_t count,
+                            UCollationExecutor *executor, void *executorContext,
+                            int32_t *indexes, UErrorCode &errorCode);
+
+    /**
+     * Arrays shorter than this are sorted by comparing the strings
+     * rather than via sort keys.
+     */
+    static const int32_t MIN_SORT_KEY_COUNT = 64;
+    /** Minimum number of strings per chunk, unless there is only one chunk. */
+    static const int32_t MIN_CHUNK_LENGTH = 2048;
+    /** Maximum number of chunks, and of tasks per executor call. */
+    static const int32_t MAX_CHUNKS = 64;
+
+private:
+    CollationSort() = delete;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_COLLATION
+#endif  // __COLLATIONSORT_H__
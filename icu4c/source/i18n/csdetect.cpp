@@ -200,6 +200,13 @@ void CharsetDetector::setText(const char *in, int32_t len)
     fFreshTextSet = TRUE;
 }
 
+UBool CharsetDetector::appendText(const char *in, int32_t len, UErrorCode &status)
+{
+    UBool wantsMore = textIn->appendText(in, len, fStripTags, status);
+    fFreshTextSet = TRUE;
+    return wantsMore;
+}
+
 UBool CharsetDetector::setStripTagsFlag(UBool flag)
 {
     UBool temp = fStripTags;
@@ -231,6 +238,15 @@ const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
     int32_t maxMatchesFound = 0;
 
+    if (textIn->isSet() && fFreshTextSet) {
+        // Only the best match is wanted, so stop at the first fully confident one.
+        const CharsetMatch *certain = runRecognizers(TRUE, status);
+
+        if (certain != NULL) {
+            return certain;
+        }
+    }
+
     detectAll(maxMatchesFound, status);
 
     if(maxMatchesFound > 0) {
@@ -247,25 +263,7 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
 
         return NULL;
     } else if (fFreshTextSet) {
-        CharsetRecognizer *csr;
-        int32_t            i;
-
-        textIn->MungeInput(fStripTags);
-
-        // Iterate over all possible charsets, remember all that
-        // give a match quality > 0.
-        resultCount = 0;
-        for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
-                resultCount++;
-            }
-        }
-
-        if (resultCount > 1) {
-            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
-        }
-        fFreshTextSet = FALSE;
+        runRecognizers(FALSE, status);
     }
 
     maxMatchesFound = resultCount;
@@ -273,6 +271,37 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
     return resultArray;
 }
 
+const CharsetMatch *CharsetDetector::runRecognizers(UBool stopWhenCertain, UErrorCode &status)
+{
+    CharsetRecognizer *csr;
+    int32_t            i;
+
+    textIn->MungeInput(fStripTags);
+
+    // Iterate over all possible charsets, remember all that
+    // give a match quality > 0.
+    resultCount = 0;
+    for (i = 0; i < fCSRecognizers_size; i += 1) {
+        csr = fCSRecognizers[i]->recognizer;
+        if (csr->match(textIn, resultArray[resultCount])) {
+            // The results are sorted stably, so no later recognizer can rank
+            // above one that is fully confident. The results are incomplete
+            // though, and fFreshTextSet stays set for a following detectAll().
+            if (stopWhenCertain && resultArray[resultCount]->getConfidence() >= 100) {
+                return resultArray[resultCount];
+            }
+            resultCount++;
+        }
+    }
+
+    if (resultCount > 1) {
+        uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
+    }
+    fFreshTextSet = FALSE;
+
+    return NULL;
+}
+
 void CharsetDetector::setDetectableCharset(const char *encoding, UBool enabled, UErrorCode &status)
 {
     if (U_FAILURE(status)) {
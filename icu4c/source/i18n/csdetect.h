@@ -31,6 +31,7 @@ class CharsetDetector : public UMemory
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
     static void setRecognizers(UErrorCode &status);
+    const CharsetMatch *runRecognizers(UBool stopWhenCertain, UErrorCode &status);
 
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
                                 // been changed from the default. The array index is
@@ -43,6 +44,8 @@ class CharsetDetector : public UMemory
 
     void setText(const char *in, int32_t len);
 
+    UBool appendText(const char *in, int32_t len, UErrorCode &status);
+
     const CharsetMatch * const *detectAll(int32_t &maxMatchesFound, UErrorCode &status);
 
     const CharsetMatch *detect(UErrorCode& status);
@@ -125,7 +125,7 @@ DecimalFormat::DecimalFormat(const DecimalFormatSymbols* symbolsToAdopt, UErrorC
 #if UCONFIG_HAVE_PARSEALLINPUT
 
 void DecimalFormat::setParseAllInput(UNumberFormatAttributeValue value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (value == fields->properties.parseAllInput) { return; }
     fields->properties.parseAllInput = value;
 }
@@ -141,6 +141,10 @@ DecimalFormat::setAttribute(UNumberFormatAttribute attr, int32_t newValue, UErro
         status = U_MEMORY_ALLOCATION_ERROR;
         return *this;
     }
+    if (fields->frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return *this;
+    }
 
     switch (attr) {
         case UNUM_LENIENT_PARSE:
@@ -369,7 +373,7 @@ int32_t DecimalFormat::getAttribute(UNumberFormatAttribute attr, UErrorCode& sta
 }
 
 void DecimalFormat::setGroupingUsed(UBool enabled) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (UBOOL_TO_BOOL(enabled) == fields->properties.groupingUsed) { return; }
@@ -379,7 +383,7 @@ void DecimalFormat::setGroupingUsed(UBool enabled) {
 }
 
 void DecimalFormat::setParseIntegerOnly(UBool value) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (UBOOL_TO_BOOL(value) == fields->properties.parseIntegerOnly) { return; }
@@ -389,7 +393,7 @@ void DecimalFormat::setParseIntegerOnly(UBool value) {
 }
 
 void DecimalFormat::setLenient(UBool enable) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     ParseMode mode = enable ? PARSE_MODE_LENIENT : PARSE_MODE_STRICT;
@@ -456,8 +460,8 @@ DecimalFormat& DecimalFormat::operator=(const DecimalFormat& rhs) {
     if (this == &rhs) {
         return *this;
     }
-    // Make sure both objects are valid.
-    if (fields == nullptr || rhs.fields == nullptr) {
+    // Make sure both objects are valid, and that this one may be modified.
+    if (fields == nullptr || rhs.fields == nullptr || fields->frozen) {
         return *this; // unfortunately, no way to report an error.
     }
     fields->properties = rhs.fields->properties;
@@ -785,7 +789,7 @@ void DecimalFormat::adoptDecimalFormatSymbols(DecimalFormatSymbols* symbolsToAdo
     }
     // we must take ownership of symbolsToAdopt, even in a failure case.
     LocalPointer<DecimalFormatSymbols> dfs(symbolsToAdopt);
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     fields->symbols.adoptInstead(dfs.orphan());
@@ -793,7 +797,7 @@ void DecimalFormat::adoptDecimalFormatSymbols(DecimalFormatSymbols* symbolsToAdo
 }
 
 void DecimalFormat::setDecimalFormatSymbols(const DecimalFormatSymbols& symbols) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     UErrorCode status = U_ZERO_ERROR;
@@ -820,7 +824,7 @@ void DecimalFormat::adoptCurrencyPluralInfo(CurrencyPluralInfo* toAdopt) {
     // TODO: should we guard against nullptr input, like in adoptDecimalFormatSymbols?
     // we must take ownership of toAdopt, even in a failure case.
     LocalPointer<CurrencyPluralInfo> cpi(toAdopt);
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     fields->properties.currencyPluralInfo.fPtr.adoptInstead(cpi.orphan());
@@ -828,7 +832,7 @@ void DecimalFormat::adoptCurrencyPluralInfo(CurrencyPluralInfo* toAdopt) {
 }
 
 void DecimalFormat::setCurrencyPluralInfo(const CurrencyPluralInfo& info) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (fields->properties.currencyPluralInfo.fPtr.isNull()) {
@@ -852,7 +856,7 @@ UnicodeString& DecimalFormat::getPositivePrefix(UnicodeString& result) const {
 }
 
 void DecimalFormat::setPositivePrefix(const UnicodeString& newValue) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (newValue == fields->properties.positivePrefix) { return; }
@@ -872,7 +876,7 @@ UnicodeString& DecimalFormat::getNegativePrefix(UnicodeString& result) const {
 }
 
 void DecimalFormat::setNegativePrefix(const UnicodeString& newValue) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (newValue == fields->properties.negativePrefix) { return; }
@@ -892,7 +896,7 @@ UnicodeString& DecimalFormat::getPositiveSuffix(UnicodeString& result) const {
 }
 
 void DecimalFormat::setPositiveSuffix(const UnicodeString& newValue) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (newValue == fields->properties.positiveSuffix) { return; }
@@ -912,7 +916,7 @@ UnicodeString& DecimalFormat::getNegativeSuffix(UnicodeString& result) const {
 }
 
 void DecimalFormat::setNegativeSuffix(const UnicodeString& newValue) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
         return;
     }
     if (newValue == fields->properties.negativeSuffix) { return; }
@@ -929,7 +933,7 @@ UBool DecimalFormat::isSignAlwaysShown() const {
 }
 
 void DecimalFormat::setSignAlwaysShown(UBool value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(value) == fields->properties.signAlwaysShown) { return; }
     fields->properties.signAlwaysShown = value;
     touchNoError();
@@ -954,7 +958,7 @@ int32_t DecimalFormat::getMultiplier(void) const {
 }
 
 void DecimalFormat::setMultiplier(int32_t multiplier) {
-    if (fields == nullptr) {
+    if (fields == nullptr || fields->frozen) {
          return;
     }
     if (multiplier == 0) {
@@ -993,7 +997,7 @@ int32_t DecimalFormat::getMultiplierScale() const {
 }
 
 void DecimalFormat::setMultiplierScale(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.multiplierScale) { return; }
     fields->properties.multiplierScale = newValue;
     touchNoError();
@@ -1009,7 +1013,7 @@ double DecimalFormat::getRoundingIncrement(void) const {
 }
 
 void DecimalFormat::setRoundingIncrement(double newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.roundingIncrement) { return; }
     fields->properties.roundingIncrement = newValue;
     touchNoError();
@@ -1026,7 +1030,7 @@ ERoundingMode DecimalFormat::getRoundingMode(void) const {
 }
 
 void DecimalFormat::setRoundingMode(ERoundingMode roundingMode) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     auto uRoundingMode = static_cast<UNumberFormatRoundingMode>(roundingMode);
     if (!fields->properties.roundingMode.isNull() && uRoundingMode == fields->properties.roundingMode.getNoError()) {
         return;
@@ -1046,7 +1050,7 @@ int32_t DecimalFormat::getFormatWidth(void) const {
 }
 
 void DecimalFormat::setFormatWidth(int32_t width) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (width == fields->properties.formatWidth) { return; }
     fields->properties.formatWidth = width;
     touchNoError();
@@ -1062,7 +1066,7 @@ UnicodeString DecimalFormat::getPadCharacterString() const {
 }
 
 void DecimalFormat::setPadCharacter(const UnicodeString& padChar) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (padChar == fields->properties.padString) { return; }
     if (padChar.length() > 0) {
         fields->properties.padString = UnicodeString(padChar.char32At(0));
@@ -1082,7 +1086,7 @@ EPadPosition DecimalFormat::getPadPosition(void) const {
 }
 
 void DecimalFormat::setPadPosition(EPadPosition padPos) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     auto uPadPos = static_cast<UNumberFormatPadPosition>(padPos);
     if (!fields->properties.padPosition.isNull() && uPadPos == fields->properties.padPosition.getNoError()) {
         return;
@@ -1101,7 +1105,7 @@ UBool DecimalFormat::isScientificNotation(void) const {
 }
 
 void DecimalFormat::setScientificNotation(UBool useScientific) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     int32_t minExp = useScientific ? 1 : -1;
     if (fields->properties.minimumExponentDigits == minExp) { return; }
     if (useScientific) {
@@ -1122,7 +1126,7 @@ int8_t DecimalFormat::getMinimumExponentDigits(void) const {
 }
 
 void DecimalFormat::setMinimumExponentDigits(int8_t minExpDig) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (minExpDig == fields->properties.minimumExponentDigits) { return; }
     fields->properties.minimumExponentDigits = minExpDig;
     touchNoError();
@@ -1138,7 +1142,7 @@ UBool DecimalFormat::isExponentSignAlwaysShown(void) const {
 }
 
 void DecimalFormat::setExponentSignAlwaysShown(UBool expSignAlways) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(expSignAlways) == fields->properties.exponentSignAlwaysShown) { return; }
     fields->properties.exponentSignAlwaysShown = expSignAlways;
     touchNoError();
@@ -1160,7 +1164,7 @@ int32_t DecimalFormat::getGroupingSize(void) const {
 }
 
 void DecimalFormat::setGroupingSize(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.groupingSize) { return; }
     fields->properties.groupingSize = newValue;
     touchNoError();
@@ -1182,7 +1186,7 @@ int32_t DecimalFormat::getSecondaryGroupingSize(void) const {
 }
 
 void DecimalFormat::setSecondaryGroupingSize(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.secondaryGroupingSize) { return; }
     fields->properties.secondaryGroupingSize = newValue;
     touchNoError();
@@ -1198,7 +1202,7 @@ int32_t DecimalFormat::getMinimumGroupingDigits() const {
 }
 
 void DecimalFormat::setMinimumGroupingDigits(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.minimumGroupingDigits) { return; }
     fields->properties.minimumGroupingDigits = newValue;
     touchNoError();
@@ -1214,7 +1218,7 @@ UBool DecimalFormat::isDecimalSeparatorAlwaysShown(void) const {
 }
 
 void DecimalFormat::setDecimalSeparatorAlwaysShown(UBool newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(newValue) == fields->properties.decimalSeparatorAlwaysShown) { return; }
     fields->properties.decimalSeparatorAlwaysShown = newValue;
     touchNoError();
@@ -1230,7 +1234,7 @@ UBool DecimalFormat::isDecimalPatternMatchRequired(void) const {
 }
 
 void DecimalFormat::setDecimalPatternMatchRequired(UBool newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(newValue) == fields->properties.decimalPatternMatchRequired) { return; }
     fields->properties.decimalPatternMatchRequired = newValue;
     touchNoError();
@@ -1246,7 +1250,7 @@ UBool DecimalFormat::isParseNoExponent() const {
 }
 
 void DecimalFormat::setParseNoExponent(UBool value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(value) == fields->properties.parseNoExponent) { return; }
     fields->properties.parseNoExponent = value;
     touchNoError();
@@ -1262,7 +1266,7 @@ UBool DecimalFormat::isParseCaseSensitive() const {
 }
 
 void DecimalFormat::setParseCaseSensitive(UBool value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(value) == fields->properties.parseCaseSensitive) { return; }
     fields->properties.parseCaseSensitive = value;
     touchNoError();
@@ -1278,7 +1282,7 @@ UBool DecimalFormat::isFormatFailIfMoreThanMaxDigits() const {
 }
 
 void DecimalFormat::setFormatFailIfMoreThanMaxDigits(UBool value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (UBOOL_TO_BOOL(value) == fields->properties.formatFailIfMoreThanMaxDigits) { return; }
     fields->properties.formatFailIfMoreThanMaxDigits = value;
     touchNoError();
@@ -1338,6 +1342,10 @@ void DecimalFormat::applyPattern(const UnicodeString& pattern, UErrorCode& statu
         status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    if (fields->frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return;
+    }
     setPropertiesFromPattern(pattern, IGNORE_ROUNDING_NEVER, status);
     touch(status);
 }
@@ -1356,13 +1364,17 @@ void DecimalFormat::applyLocalizedPattern(const UnicodeString& localizedPattern,
         status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    if (fields->frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return;
+    }
     UnicodeString pattern = PatternStringUtils::convertLocalized(
             localizedPattern, *fields->symbols, false, status);
     applyPattern(pattern, status);
 }
 
 void DecimalFormat::setMaximumIntegerDigits(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.maximumIntegerDigits) { return; }
     // For backwards compatibility, conflicting min/max need to keep the most recent setting.
     int32_t min = fields->properties.minimumIntegerDigits;
@@ -1374,7 +1386,7 @@ void DecimalFormat::setMaximumIntegerDigits(int32_t newValue) {
 }
 
 void DecimalFormat::setMinimumIntegerDigits(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.minimumIntegerDigits) { return; }
     // For backwards compatibility, conflicting min/max need to keep the most recent setting.
     int32_t max = fields->properties.maximumIntegerDigits;
@@ -1386,7 +1398,7 @@ void DecimalFormat::setMinimumIntegerDigits(int32_t newValue) {
 }
 
 void DecimalFormat::setMaximumFractionDigits(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.maximumFractionDigits) { return; }
     // cap for backward compatibility, formerly 340, now 999
     if (newValue > kMaxIntFracSig) {
@@ -1402,7 +1414,7 @@ void DecimalFormat::setMaximumFractionDigits(int32_t newValue) {
 }
 
 void DecimalFormat::setMinimumFractionDigits(int32_t newValue) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (newValue == fields->properties.minimumFractionDigits) { return; }
     // For backwards compatibility, conflicting min/max need to keep the most recent setting.
     int32_t max = fields->properties.maximumFractionDigits;
@@ -1432,7 +1444,7 @@ int32_t DecimalFormat::getMaximumSignificantDigits() const {
 }
 
 void DecimalFormat::setMinimumSignificantDigits(int32_t value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (value == fields->properties.minimumSignificantDigits) { return; }
     int32_t max = fields->properties.maximumSignificantDigits;
     if (max >= 0 && max < value) {
@@ -1443,7 +1455,7 @@ void DecimalFormat::setMinimumSignificantDigits(int32_t value) {
 }
 
 void DecimalFormat::setMaximumSignificantDigits(int32_t value) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     if (value == fields->properties.maximumSignificantDigits) { return; }
     int32_t min = fields->properties.minimumSignificantDigits;
     if (min >= 0 && min > value) {
@@ -1466,7 +1478,7 @@ UBool DecimalFormat::areSignificantDigitsUsed() const {
 }
 
 void DecimalFormat::setSignificantDigitsUsed(UBool useSignificantDigits) {
-    if (fields == nullptr) { return; }
+    if (fields == nullptr || fields->frozen) { return; }
     
     // These are the default values from the old implementation.
     if (useSignificantDigits) {
@@ -1495,6 +1507,10 @@ void DecimalFormat::setCurrency(const char16_t* theCurrency, UErrorCode& ec) {
         ec = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    if (fields->frozen) {
+        ec = U_NO_WRITE_PERMISSION;
+        return;
+    }
     CurrencyUnit currencyUnit(theCurrency, ec);
     if (U_FAILURE(ec)) { return; }
     if (!fields->properties.currency.isNull() && fields->properties.currency.getNoError() == currencyUnit) {
@@ -1519,6 +1535,10 @@ void DecimalFormat::setCurrencyUsage(UCurrencyUsage newUsage, UErrorCode* ec) {
         *ec = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
+    if (fields->frozen) {
+        *ec = U_NO_WRITE_PERMISSION;
+        return;
+    }
     if (!fields->properties.currencyUsage.isNull() && newUsage == fields->properties.currencyUsage.getNoError()) {
         return;
     }
@@ -1573,6 +1593,31 @@ const number::LocalizedNumberFormatter* DecimalFormat::toNumberFormatter(UErrorC
     return &fields->formatter;
 }
 
+void DecimalFormat::freeze(UErrorCode& status) {
+    if (U_FAILURE(status)) { return; }
+    if (fields == nullptr) {
+        // We only get here if an OOM error happend during construction, copy construction, assignment, or modification.
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    if (fields->frozen) { return; }
+
+    // Build the compiled formatter now rather than on one of the first few format() calls:
+    // A threshold of 1 makes the next call build it, and the setters can no longer replace it.
+    fields->formatter = fields->formatter.threshold(1);
+    fields->formatter.formatInt(0, status);
+
+    // Same for the parsers.
+    getParser(status);
+    getCurrencyParser(status);
+    if (U_FAILURE(status)) { return; }
+    fields->frozen = true;
+}
+
+UBool DecimalFormat::isFrozen() const {
+    return fields != nullptr && fields->frozen;
+}
+
 /** Rebuilds the formatter object from the property bag. */
 void DecimalFormat::touch(UErrorCode& status) {
     if (U_FAILURE(status)) {
@@ -39,6 +39,7 @@
 #include "uhash.h"
 #include "uresimp.h"
 #include "dtptngen_impl.h"
+#include "unifiedcache.h"
 #include "ucln_in.h"
 #include "charstr.h"
 #include "uassert.h"
@@ -301,8 +302,49 @@ DateTimePatternGenerator::createInstance(UErrorCode& status) {
     return createInstance(Locale::getDefault(), status);
 }
 
+SharedDateTimePatternGenerator::~SharedDateTimePatternGenerator() {
+    delete ptr;
+}
+
+template<> U_I18N_API
+const SharedDateTimePatternGenerator *LocaleCacheKey<SharedDateTimePatternGenerator>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    LocalPointer<DateTimePatternGenerator> dtpg(
+            DateTimePatternGenerator::internalMakeInstance(fLoc, status), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<SharedDateTimePatternGenerator> result(
+            new SharedDateTimePatternGenerator(dtpg.getAlias()), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    dtpg.orphan(); // result was successfully created so it owns dtpg.
+    result->addRef();
+    return result.orphan();
+}
+
 DateTimePatternGenerator* U_EXPORT2
 DateTimePatternGenerator::createInstance(const Locale& locale, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    // Loading the locale data is much slower than copying a generator that has it.
+    const SharedDateTimePatternGenerator *shared = nullptr;
+    UnifiedCache::getByLocale(locale, shared, status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<DateTimePatternGenerator> result((*shared)->clone(), status);
+    shared->removeRef();
+    if (U_SUCCESS(status) && U_FAILURE(result->internalErrorCode)) {
+        status = result->internalErrorCode;
+    }
+    return U_SUCCESS(status) ? result.orphan() : nullptr;
+}
+
+DateTimePatternGenerator* U_EXPORT2
+DateTimePatternGenerator::internalMakeInstance(const Locale& locale, UErrorCode& status) {
     if (U_FAILURE(status)) {
         return nullptr;
     }
@@ -324,6 +366,7 @@ DateTimePatternGenerator::createEmptyInstance(UErrorCode& status) {
 DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatterns(nullptr),
     fDefaultHourFormatChar(0),
     internalErrorCode(U_ZERO_ERROR)
 {
@@ -339,6 +382,7 @@ DateTimePatternGenerator::DateTimePatternGenerator(UErrorCode &status) :
 DateTimePatternGenerator::DateTimePatternGenerator(const Locale& locale, UErrorCode &status) :
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatterns(nullptr),
     fDefaultHourFormatChar(0),
     internalErrorCode(U_ZERO_ERROR)
 {
@@ -358,6 +402,7 @@ DateTimePatternGenerator::DateTimePatternGenerator(const DateTimePatternGenerato
     UObject(),
     skipMatcher(nullptr),
     fAvailableFormatKeyHash(nullptr),
+    fBestPatterns(nullptr),
     fDefaultHourFormatChar(0),
     internalErrorCode(U_ZERO_ERROR)
 {
@@ -377,9 +422,11 @@ DateTimePatternGenerator::operator=(const DateTimePatternGenerator& other) {
     if (&other == this) {
         return *this;
     }
+    clearBestPatterns();
     internalErrorCode = other.internalErrorCode;
     pLocale = other.pLocale;
     fDefaultHourFormatChar = other.fDefaultHourFormatChar;
+    uprv_memcpy(fAllowedHourFormats, other.fAllowedHourFormats, sizeof(fAllowedHourFormats));
     *fp = *(other.fp);
     dtMatcher->copyFrom(other.dtMatcher->skeleton);
     *distanceInfo = *(other.distanceInfo);
@@ -447,6 +494,7 @@ DateTimePatternGenerator::~DateTimePatternGenerator() {
     if (fAvailableFormatKeyHash!=nullptr) {
         delete fAvailableFormatKeyHash;
     }
+    delete fBestPatterns;
 
     if (fp != nullptr) delete fp;
     if (dtMatcher != nullptr) delete dtMatcher;
@@ -1098,6 +1146,7 @@ DateTimePatternGenerator::initHashtable(UErrorCode& err) {
 
 void
 DateTimePatternGenerator::setAppendItemFormat(UDateTimePatternField field, const UnicodeString& value) {
+    clearBestPatterns();
     appendItemFormats[field] = value;
     // NUL-terminate for the C API.
     appendItemFormats[field].getTerminatedBuffer();
@@ -1120,6 +1169,7 @@ DateTimePatternGenerator::getAppendItemName(UDateTimePatternField field) const {
 
 void
 DateTimePatternGenerator::setFieldDisplayName(UDateTimePatternField field, UDateTimePGDisplayWidth width, const UnicodeString& value) {
+    clearBestPatterns();
     fieldDisplayNames[field][width] = value;
     // NUL-terminate for the C API.
     fieldDisplayNames[field][width].getTerminatedBuffer();
@@ -1156,6 +1206,50 @@ DateTimePatternGenerator::getBestPattern(const UnicodeString& patternForm, UDate
         status = internalErrorCode;
         return UnicodeString();
     }
+    // Applications tend to ask for the same few skeletons over and over.
+    // All valid options fit into the first char of the memo key.
+    if ((options & ~0xffff) != 0) {
+        return computeBestPattern(patternForm, options, status);
+    }
+    UnicodeString key((UChar)options);
+    key.append(patternForm);
+    if (fBestPatterns != nullptr) {
+        const UnicodeString *memo = static_cast<const UnicodeString *>(fBestPatterns->get(key));
+        if (memo != nullptr) {
+            return *memo;
+        }
+    }
+    UnicodeString result = computeBestPattern(patternForm, options, status);
+    if (U_FAILURE(status)) {
+        return result;
+    }
+    UErrorCode localStatus = U_ZERO_ERROR;
+    if (fBestPatterns == nullptr) {
+        LocalPointer<Hashtable> memo(new Hashtable(localStatus), localStatus);
+        if (U_FAILURE(localStatus)) {
+            return result;  // The memo is only an optimization.
+        }
+        memo->setValueDeleter(uprv_deleteUObject);
+        fBestPatterns = memo.orphan();
+    } else if (fBestPatterns->count() >= MAX_BEST_PATTERNS) {
+        fBestPatterns->removeAll();
+    }
+    UnicodeString *value = new UnicodeString(result);
+    if (value != nullptr) {
+        fBestPatterns->put(key, value, localStatus);
+    }
+    return result;
+}
+
+void
+DateTimePatternGenerator::clearBestPatterns() {
+    if (fBestPatterns != nullptr) {
+        fBestPatterns->removeAll();
+    }
+}
+
+UnicodeString
+DateTimePatternGenerator::computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status) {
     const UnicodeString *bestPattern = nullptr;
     UnicodeString dtFormat;
     UnicodeString resultPattern;
@@ -1313,6 +1407,7 @@ DateTimePatternGenerator::replaceFieldTypes(const UnicodeString& pattern,
 
 void
 DateTimePatternGenerator::setDecimal(const UnicodeString& newDecimal) {
+    clearBestPatterns();
     this->decimal = newDecimal;
     // NUL-terminate for the C API.
     this->decimal.getTerminatedBuffer();
@@ -1338,6 +1433,7 @@ DateTimePatternGenerator::addCanonicalItems(UErrorCode& status) {
 
 void
 DateTimePatternGenerator::setDateTimeFormat(const UnicodeString& dtFormat) {
+    clearBestPatterns();
     dateTimeFormat = dtFormat;
     // NUL-terminate for the C API.
     dateTimeFormat.getTerminatedBuffer();
@@ -1437,6 +1533,7 @@ DateTimePatternGenerator::addPatternWithSkeleton(
         status = internalErrorCode;
         return UDATPG_NO_CONFLICT;
     }
+    clearBestPatterns();
 
     UnicodeString basePattern;
     PtnSkeleton   skeleton;
@@ -18,6 +18,7 @@
 
 #include "unicode/strenum.h"
 #include "unicode/unistr.h"
+#include "sharedobject.h"
 #include "uvector.h"
 
 // TODO(claireho): Split off Builder class.
@@ -28,6 +29,7 @@
 #define MAX_DT_TOKEN        50
 #define MAX_RESOURCE_FIELD  12
 #define MAX_AVAILABLE_FORMATS  12
+#define MAX_BEST_PATTERNS  256
 #define NONE          0
 #define EXTRA_FIELD   0x10000
 #define MISSING_FIELD  0x1000
@@ -304,6 +306,22 @@ class DTRedundantEnumeration : public StringEnumeration {
     LocalPointer<UVector> fPatterns;
 };
 
+/**
+ * A DateTimePatternGenerator loaded from the data of one locale, shared through the UnifiedCache.
+ * It is never modified; DateTimePatternGenerator::createInstance() returns clones of it.
+ */
+class U_I18N_API SharedDateTimePatternGenerator : public SharedObject {
+public:
+    SharedDateTimePatternGenerator(DateTimePatternGenerator *dtpgToAdopt) : ptr(dtpgToAdopt) { }
+    virtual ~SharedDateTimePatternGenerator();
+    const DateTimePatternGenerator *operator->() const { return ptr; }
+    const DateTimePatternGenerator &operator*() const { return *ptr; }
+private:
+    DateTimePatternGenerator *ptr;
+    SharedDateTimePatternGenerator(const SharedDateTimePatternGenerator &);
+    SharedDateTimePatternGenerator &operator=(const SharedDateTimePatternGenerator &);
+};
+
 U_NAMESPACE_END
 
 #endif
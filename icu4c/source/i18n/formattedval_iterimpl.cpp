@@ -11,6 +11,7 @@
 
 #include "formattedval_impl.h"
 #include "putilimp.h"
+#include "uarrsort.h"
 
 U_NAMESPACE_BEGIN
 
@@ -123,53 +124,36 @@ void FormattedValueFieldPositionIteratorImpl::addOverlapSpans(
 }
 
 
-void FormattedValueFieldPositionIteratorImpl::sort() {
-    // Use bubble sort, O(N^2) but easy and no fancy data structures.
-    int32_t numFields = fFields.size() / 4;
-    while (true) {
-        bool isSorted = true;
-        for (int32_t i=0; i<numFields-1; i++) {
-            int32_t categ1 = fFields.elementAti(i*4 + 0);
-            int32_t field1 = fFields.elementAti(i*4 + 1);
-            int32_t start1 = fFields.elementAti(i*4 + 2);
-            int32_t limit1 = fFields.elementAti(i*4 + 3);
-            int32_t categ2 = fFields.elementAti(i*4 + 4);
-            int32_t field2 = fFields.elementAti(i*4 + 5);
-            int32_t start2 = fFields.elementAti(i*4 + 6);
-            int32_t limit2 = fFields.elementAti(i*4 + 7);
-            int64_t comparison = 0;
-            if (start1 != start2) {
-                // Higher start index -> higher rank
-                comparison = start2 - start1;
-            } else if (limit1 != limit2) {
-                // Higher length (end index) -> lower rank
-                comparison = limit1 - limit2;
-            } else if (categ1 != categ2) {
-                // Higher field category -> lower rank
-                comparison = categ1 - categ2;
-            } else if (field1 != field2) {
-                // Higher field -> higher rank
-                comparison = field2 - field1;
-            }
-            if (comparison < 0) {
-                // Perform a swap
-                isSorted = false;
-                fFields.setElementAt(categ2, i*4 + 0);
-                fFields.setElementAt(field2, i*4 + 1);
-                fFields.setElementAt(start2, i*4 + 2);
-                fFields.setElementAt(limit2, i*4 + 3);
-                fFields.setElementAt(categ1, i*4 + 4);
-                fFields.setElementAt(field1, i*4 + 5);
-                fFields.setElementAt(start1, i*4 + 6);
-                fFields.setElementAt(limit1, i*4 + 7);
-            }
-        }
-        if (isSorted) {
-            break;
-        }
+U_CDECL_BEGIN
+static int32_t U_CALLCONV
+compareFields(const void * /*context*/, const void *left, const void *right) {
+    // Each field is {category, field, start, limit}.
+    const int32_t *f1 = static_cast<const int32_t *>(left);
+    const int32_t *f2 = static_cast<const int32_t *>(right);
+    if (f1[2] != f2[2]) {
+        // Higher start index -> higher rank
+        return f1[2] < f2[2] ? -1 : 1;
+    } else if (f1[3] != f2[3]) {
+        // Higher length (end index) -> lower rank
+        return f1[3] > f2[3] ? -1 : 1;
+    } else if (f1[0] != f2[0]) {
+        // Higher field category -> lower rank
+        return f1[0] > f2[0] ? -1 : 1;
+    } else if (f1[1] != f2[1]) {
+        // Higher field -> higher rank
+        return f1[1] < f2[1] ? -1 : 1;
     }
+    return 0;
 }
+U_CDECL_END
 
+void FormattedValueFieldPositionIteratorImpl::sort() {
+    // Fields which compare equal are identical, so the sort need not be stable.
+    // Formatters such as ListFormatter can produce thousands of fields.
+    UErrorCode status = U_ZERO_ERROR;
+    uprv_sortArray(fFields.getBuffer(), fFields.size() / 4, 4 * sizeof(int32_t),
+                   compareFields, nullptr, FALSE, &status);
+}
 
 U_NAMESPACE_END
 
@@ -22,6 +22,10 @@ U_NAMESPACE_BEGIN
 
 #define BUFFER_SIZE 8192
 
+// Maximum amount of raw input kept by appendText(). When markup is being stripped,
+//   more than BUFFER_SIZE raw bytes may be needed to fill the input buffer.
+#define APPEND_BUFFER_SIZE (8 * BUFFER_SIZE)
+
 #define NEW_ARRAY(type,count) (type *) uprv_malloc((count) * sizeof(type))
 #define DELETE_ARRAY(array) uprv_free((void *) (array))
 
@@ -32,7 +36,11 @@ InputText::InputText(UErrorCode &status)
                                                  //   Value is percent, not absolute.
       fDeclaredEncoding(0),
       fRawInput(0),
-      fRawLength(0)
+      fRawLength(0),
+      fAppendBuffer(0),
+      fAppending(FALSE),
+      fAppendInMarkup(FALSE),
+      fAppendStrippedLen(0)
 {
     if (fInputBytes == NULL || fByteStats == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -44,6 +52,7 @@ InputText::~InputText()
     DELETE_ARRAY(fDeclaredEncoding);
     DELETE_ARRAY(fByteStats);
     DELETE_ARRAY(fInputBytes);
+    DELETE_ARRAY(fAppendBuffer);
 }
 
 void InputText::setText(const char *in, int32_t len)
@@ -52,6 +61,88 @@ void InputText::setText(const char *in, int32_t len)
     fC1Bytes   = FALSE;
     fRawInput  = (const uint8_t *) in;
     fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
+    fAppending = FALSE;
+}
+
+/**
+*  appendText - add a chunk of input to the text to be checked. The input is copied,
+*               up to the amount that detection can make use of.
+*
+*  @return TRUE if more input would still be examined by the detectors.
+*
+* @internal
+*/
+UBool InputText::appendText(const char *in, int32_t len, UBool fStripTags, UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return FALSE;
+    }
+    if (fAppendBuffer == NULL) {
+        fAppendBuffer = NEW_ARRAY(uint8_t, APPEND_BUFFER_SIZE);
+        if (fAppendBuffer == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return FALSE;
+        }
+    }
+
+    if (!fAppending) {
+        // Continue from any text that was set with setText().
+        const uint8_t *prevInput = fRawInput;
+        int32_t prevLength = fRawInput != NULL ? fRawLength : 0;
+
+        fInputLen          = 0;
+        fC1Bytes           = FALSE;
+        fRawInput          = fAppendBuffer;
+        fRawLength         = 0;
+        fAppending         = TRUE;
+        fAppendInMarkup    = FALSE;
+        fAppendStrippedLen = 0;
+        appendBytes(prevInput, prevLength);
+    }
+
+    if (in != NULL) {
+        appendBytes((const uint8_t *) in, len == -1? (int32_t)uprv_strlen(in) : len);
+    }
+
+    return !isSampleComplete(fStripTags);
+}
+
+void InputText::appendBytes(const uint8_t *in, int32_t len)
+{
+    if (len > APPEND_BUFFER_SIZE - fRawLength) {
+        len = APPEND_BUFFER_SIZE - fRawLength;
+    }
+
+    // Track what MungeInput() would keep when stripping markup, so that
+    //   we know when enough input has been seen.
+    for (int32_t i = 0; i < len; i += 1) {
+        uint8_t b = in[i];
+
+        fAppendBuffer[fRawLength++] = b;
+
+        if (b == (uint8_t)0x3C) {
+            fAppendInMarkup = TRUE;
+        }
+
+        if (!fAppendInMarkup) {
+            fAppendStrippedLen += 1;
+        }
+
+        if (b == (uint8_t)0x3E) {
+            fAppendInMarkup = FALSE;
+        }
+    }
+}
+
+UBool InputText::isSampleComplete(UBool fStripTags) const
+{
+    if (fRawLength >= APPEND_BUFFER_SIZE) {
+        return TRUE;
+    }
+
+    // Once MungeInput() can fill its buffer, further input is only seen by the
+    //   recognizers that scan the raw bytes (the UTFs), and is not worth waiting for.
+    return (fStripTags ? fAppendStrippedLen : fRawLength) >= BUFFER_SIZE;
 }
 
 void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
@@ -34,6 +34,7 @@ class InputText : public UMemory
     ~InputText();
 
     void setText(const char *in, int32_t len);
+    UBool appendText(const char *in, int32_t len, UBool fStripTags, UErrorCode &status);
     void setDeclaredEncoding(const char *encoding, int32_t len);
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
@@ -55,6 +56,16 @@ class InputText : public UMemory
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
 
+private:
+    void appendBytes(const uint8_t *in, int32_t len);
+    UBool isSampleComplete(UBool fStripTags) const;
+
+    // Owned copy of the raw input when it is supplied in chunks with appendText().
+    //   Only as much as the detectors can make use of is retained.
+    uint8_t *fAppendBuffer;
+    UBool    fAppending;         // True if fRawInput points to fAppendBuffer.
+    UBool    fAppendInMarkup;    // Running markup state of the appended input,
+    int32_t  fAppendStrippedLen; //   and how many bytes markup stripping would keep.
 };
 
 U_NAMESPACE_END
@@ -21,6 +21,7 @@
 #include "unicode/listformatter.h"
 #include "unicode/simpleformatter.h"
 #include "unicode/ulistformatter.h"
+#include "unicode/ustring.h"
 #include "fphdlimp.h"
 #include "mutex.h"
 #include "hash.h"
@@ -35,12 +36,66 @@
 
 U_NAMESPACE_BEGIN
 
+/**
+ * A list pattern split at its two arguments, for formatting a whole list in
+ * one pass. For "{0}, {1}" prefix and suffix are empty and between is ", ".
+ * If reversed is true, the pattern has {1} before {0}.
+ */
+struct ListPatternParts : public UMemory {
+    UnicodeString prefix;
+    UnicodeString between;
+    UnicodeString suffix;
+    UBool reversed;
+
+    ListPatternParts() : reversed(FALSE) {}
+
+    /**
+     * Sets the parts from the pattern.
+     * Returns FALSE if the pattern does not contain each of {0} and {1}
+     * exactly once.
+     */
+    UBool init(const SimpleFormatter &pattern) {
+        int32_t offsets[2];
+        UnicodeString text = pattern.getTextWithNoArguments(offsets, UPRV_LENGTHOF(offsets));
+        if (pattern.getArgumentLimit() != 2 || offsets[0] < 0 || offsets[1] < 0) {
+            return FALSE;
+        }
+        // Formatting with one-character values adds exactly two characters
+        // only if neither argument is repeated.
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UnicodeString probe((UChar)0x30), formatted;
+        pattern.format(probe, probe, formatted, errorCode);
+        if (U_FAILURE(errorCode) || formatted.length() != text.length() + 2) {
+            return FALSE;
+        }
+        reversed = offsets[1] < offsets[0];
+        int32_t first = reversed ? offsets[1] : offsets[0];
+        int32_t second = reversed ? offsets[0] : offsets[1];
+        text.extract(0, first, prefix);
+        text.extract(first, second - first, between);
+        text.extract(second, text.length() - second, suffix);
+        return TRUE;
+    }
+
+    int32_t length() const {
+        return prefix.length() + between.length() + suffix.length();
+    }
+};
+
 struct ListFormatInternal : public UMemory {
     SimpleFormatter twoPattern;
     SimpleFormatter startPattern;
     SimpleFormatter middlePattern;
     SimpleFormatter endPattern;
 
+    // The same patterns preparsed for the single-pass formatter.
+    // Only used if hasParts is TRUE.
+    ListPatternParts twoParts;
+    ListPatternParts startParts;
+    ListPatternParts middleParts;
+    ListPatternParts endParts;
+    UBool hasParts;
+
 ListFormatInternal(
         const UnicodeString& two,
         const UnicodeString& start,
@@ -50,19 +105,36 @@ ListFormatInternal(
         twoPattern(two, 2, 2, errorCode),
         startPattern(start, 2, 2, errorCode),
         middlePattern(middle, 2, 2, errorCode),
-        endPattern(end, 2, 2, errorCode) {}
+        endPattern(end, 2, 2, errorCode) {
+    initParts(errorCode);
+}
 
 ListFormatInternal(const ListFormatData &data, UErrorCode &errorCode) :
         twoPattern(data.twoPattern, errorCode),
         startPattern(data.startPattern, errorCode),
         middlePattern(data.middlePattern, errorCode),
-        endPattern(data.endPattern, errorCode) { }
+        endPattern(data.endPattern, errorCode) {
+    initParts(errorCode);
+}
 
 ListFormatInternal(const ListFormatInternal &other) :
     twoPattern(other.twoPattern),
     startPattern(other.startPattern),
     middlePattern(other.middlePattern),
-    endPattern(other.endPattern) { }
+    endPattern(other.endPattern),
+    twoParts(other.twoParts),
+    startParts(other.startParts),
+    middleParts(other.middleParts),
+    endParts(other.endParts),
+    hasParts(other.hasParts) { }
+
+void initParts(UErrorCode &errorCode) {
+    hasParts = U_SUCCESS(errorCode) &&
+        twoParts.init(twoPattern) &&
+        startParts.init(startPattern) &&
+        middleParts.init(middlePattern) &&
+        endParts.init(endPattern);
+}
 };
 
 
@@ -424,6 +496,136 @@ static void joinStringsAndReplace(
     if (offsetSecond != nullptr) *offsetSecond = offsets[1];
 }
 
+#if !UCONFIG_NO_FORMATTING
+static inline const ListPatternParts &getListPatternParts(
+        const ListFormatInternal &data, int32_t i, int32_t nItems) {
+    if (i == 1) {
+        return nItems == 2 ? data.twoParts : data.startParts;
+    }
+    return i == nItems - 1 ? data.endParts : data.middleParts;
+}
+
+static inline int32_t copyInto(UChar *dest, int32_t destIndex, const UnicodeString &s) {
+    int32_t length = s.length();
+    if (length > 0) {
+        u_memcpy(dest + destIndex, s.getBuffer(), length);
+    }
+    return length;
+}
+
+/**
+ * Formats nItems >= 2 items with the preparsed patterns and appends the result
+ * to dest, writing each item and each piece of pattern text exactly once.
+ * Indexes passed to the handler and returned in offset are shifted by shift.
+ *
+ * The patterns nest from the last item inward: the end pattern wraps the list
+ * of all but the last item, and so on down to the first pattern, which wraps
+ * items[0]. Each pattern's text before its inner list goes on the left and the
+ * rest on the right, so the output is filled in from both ends toward items[0].
+ */
+static void formatListInOnePass(
+        const ListFormatInternal &data,
+        const UnicodeString items[],
+        int32_t nItems,
+        UnicodeString &dest,
+        int32_t shift,
+        int32_t index,
+        int32_t &offset,
+        FieldPositionHandler *handler,
+        UErrorCode &errorCode) {
+    int64_t length64 = items[0].length();
+    for (int32_t i = 1; i < nItems; ++i) {
+        length64 += items[i].length() + getListPatternParts(data, i, nItems).length();
+    }
+    int32_t start = dest.length();
+    if (start + length64 > INT32_MAX) {
+        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+    int32_t length = static_cast<int32_t>(length64);
+    // starts[i] is the start of items[i]; order lists the items in output order.
+    MaybeStackArray<int32_t, 20> starts;
+    int32_t *order = nullptr;
+    if (handler != nullptr) {
+        if (starts.resize(2 * nItems) == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        order = starts.getAlias() + nItems;
+    }
+    UChar *buffer = dest.getBuffer(start + length);
+    if (buffer == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t left = start;
+    int32_t right = start + length;
+    int32_t leftCount = 0;
+    int32_t rightCount = 0;
+    for (int32_t i = nItems - 1; i > 0; --i) {
+        const ListPatternParts &parts = getListPatternParts(data, i, nItems);
+        int32_t itemStart;
+        left += copyInto(buffer, left, parts.prefix);
+        if (parts.reversed) {
+            itemStart = left;
+            left += copyInto(buffer, left, items[i]);
+            left += copyInto(buffer, left, parts.between);
+            right -= parts.suffix.length();
+            copyInto(buffer, right, parts.suffix);
+        } else {
+            right -= parts.suffix.length();
+            copyInto(buffer, right, parts.suffix);
+            right -= items[i].length();
+            itemStart = right;
+            copyInto(buffer, right, items[i]);
+            right -= parts.between.length();
+            copyInto(buffer, right, parts.between);
+        }
+        if (i == index) {
+            offset = itemStart + shift;
+        }
+        if (handler != nullptr) {
+            starts[i] = itemStart + shift;
+            if (parts.reversed) {
+                order[leftCount++] = i;
+            } else {
+                order[nItems - 1 - rightCount++] = i;
+            }
+        }
+    }
+    // Now right - left == items[0].length().
+    copyInto(buffer, left, items[0]);
+    if (index == 0) {
+        offset = left + shift;
+    }
+    dest.releaseBuffer(start + length);
+
+    if (handler != nullptr) {
+        starts[0] = left + shift;
+        order[leftCount] = 0;
+        // Output the ULISTFMT_ELEMENT_FIELD in the order of the input elements,
+        // then the ULISTFMT_LITERAL_FIELD between them in output order.
+        for (int32_t i = 0; i < nItems; ++i) {
+            handler->addAttribute(
+                ULISTFMT_ELEMENT_FIELD,  // id
+                starts[i],  // index
+                starts[i] + items[i].length());  // limit
+        }
+        int32_t literalStart = start + shift;
+        for (int32_t k = 0; k < nItems; ++k) {
+            int32_t i = order[k];
+            if (literalStart != starts[i]) {
+                handler->addAttribute(ULISTFMT_LITERAL_FIELD, literalStart, starts[i]);
+            }
+            literalStart = starts[i] + items[i].length();
+        }
+        if (literalStart != start + length + shift) {
+            handler->addAttribute(ULISTFMT_LITERAL_FIELD, literalStart, start + length + shift);
+        }
+    }
+}
+#endif
+
 UnicodeString& ListFormatter::format(
         const UnicodeString items[],
         int32_t nItems,
@@ -514,6 +716,25 @@ UnicodeString& ListFormatter::format_(
         appendTo.append(items[0]);
         return appendTo;
     }
+    if (data->hasParts) {
+        // Write directly into appendTo unless one of the items is appendTo itself.
+        for (int32_t i = 0; i < nItems; ++i) {
+            if (&items[i] == &appendTo) {
+                UnicodeString result;
+                formatListInOnePass(*data, items, nItems, result, appendTo.length(),
+                                    index, offset, handler, errorCode);
+                if (U_SUCCESS(errorCode)) {
+                    appendTo += result;
+                }
+                return appendTo;
+            }
+        }
+        formatListInOnePass(*data, items, nItems, appendTo, 0,
+                            index, offset, handler, errorCode);
+        return appendTo;
+    }
+    // Patterns which the single-pass formatter cannot handle
+    // (repeated or missing arguments) are joined pairwise.
     UnicodeString result(items[0]);
     if (index == 0) {
         offset = 0;
@@ -244,6 +244,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  plan(NULL),
+  frozen(FALSE),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -266,6 +268,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  plan(NULL),
+  frozen(FALSE),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -289,6 +293,8 @@ MessageFormat::MessageFormat(const UnicodeString& pattern,
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  plan(NULL),
+  frozen(FALSE),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -311,6 +317,8 @@ MessageFormat::MessageFormat(const MessageFormat& that)
   defaultDateFormat(NULL),
   cachedFormatters(NULL),
   customFormatArgStarts(NULL),
+  plan(NULL),
+  frozen(FALSE),
   pluralProvider(*this, UPLURAL_TYPE_CARDINAL),
   ordinalProvider(*this, UPLURAL_TYPE_ORDINAL)
 {
@@ -326,6 +334,7 @@ MessageFormat::~MessageFormat()
 {
     uhash_close(cachedFormatters);
     uhash_close(customFormatArgStarts);
+    delete plan;
 
     uprv_free(argTypes);
     uprv_free(formatAliases);
@@ -372,7 +381,7 @@ UBool MessageFormat::allocateArgTypes(int32_t capacity, UErrorCode& status) {
 const MessageFormat&
 MessageFormat::operator=(const MessageFormat& that)
 {
-    if (this != &that) {
+    if (this != &that && !frozen) {
         // Calls the super class for assignment first.
         Format::operator=(that);
 
@@ -448,7 +457,7 @@ MessageFormat::clone() const
 void
 MessageFormat::setLocale(const Locale& theLocale)
 {
-    if (fLocale != theLocale) {
+    if (fLocale != theLocale && !frozen) {
         delete defaultNumberFormat;
         defaultNumberFormat = NULL;
         delete defaultDateFormat;
@@ -489,6 +498,10 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
     if(U_FAILURE(ec)) {
         return;
     }
+    if (frozen) {
+        ec = U_NO_WRITE_PERMISSION;
+        return;
+    }
     msgPattern.parse(pattern, &parseError, ec);
     cacheExplicitFormats(ec);
 
@@ -498,6 +511,7 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
 }
 
 void MessageFormat::resetPattern() {
+    clearPlan();
     msgPattern.clear();
     uhash_close(cachedFormatters);
     cachedFormatters = NULL;
@@ -512,6 +526,13 @@ MessageFormat::applyPattern(const UnicodeString& pattern,
                             UMessagePatternApostropheMode aposMode,
                             UParseError* parseError,
                             UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return;
+    }
     if (aposMode != msgPattern.getApostropheMode()) {
         msgPattern.clearPatternAndSetApostropheMode(aposMode);
     }
@@ -554,6 +575,7 @@ void MessageFormat::setArgStartFormat(int32_t argStart,
         delete formatter;
         return;
     }
+    clearPlan();
     if (cachedFormatters == NULL) {
         cachedFormatters=uhash_open(uhash_hashLong, uhash_compareLong,
                                     equalFormatsForHash, &status);
@@ -609,10 +631,11 @@ Format* MessageFormat::getCachedFormatter(int32_t argumentNumber) const {
 void
 MessageFormat::adoptFormats(Format** newFormats,
                             int32_t count) {
-    if (newFormats == NULL || count < 0) {
+    if (newFormats == NULL || count < 0 || frozen) {
         return;
     }
     // Throw away any cached formatters.
+    clearPlan();
     if (cachedFormatters != NULL) {
         uhash_removeAll(cachedFormatters);
     }
@@ -642,10 +665,11 @@ MessageFormat::adoptFormats(Format** newFormats,
 void
 MessageFormat::setFormats(const Format** newFormats,
                           int32_t count) {
-    if (newFormats == NULL || count < 0) {
+    if (newFormats == NULL || count < 0 || frozen) {
         return;
     }
     // Throw away any cached formatters.
+    clearPlan();
     if (cachedFormatters != NULL) {
         uhash_removeAll(cachedFormatters);
     }
@@ -679,7 +703,7 @@ MessageFormat::setFormats(const Format** newFormats,
 void
 MessageFormat::adoptFormat(int32_t n, Format *newFormat) {
     LocalPointer<Format> p(newFormat);
-    if (n >= 0) {
+    if (n >= 0 && !frozen) {
         int32_t formatNumber = 0;
         for (int32_t partIndex = 0; (partIndex = nextTopLevelArgStart(partIndex)) >= 0;) {
             if (n == formatNumber) {
@@ -703,6 +727,10 @@ MessageFormat::adoptFormat(const UnicodeString& formatName,
     if (U_FAILURE(status)) {
         return;
     }
+    if (frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return;
+    }
     int32_t argNumber = MessagePattern::validateArgumentName(formatName);
     if (argNumber < UMSGPAT_ARG_NAME_NOT_NUMBER) {
         status = U_ILLEGAL_ARGUMENT_ERROR;
@@ -735,7 +763,7 @@ MessageFormat::adoptFormat(const UnicodeString& formatName,
 void
 MessageFormat::setFormat(int32_t n, const Format& newFormat) {
 
-    if (n >= 0) {
+    if (n >= 0 && !frozen) {
         int32_t formatNumber = 0;
         for (int32_t partIndex = 0;
              (partIndex = nextTopLevelArgStart(partIndex)) >= 0;) {
@@ -780,6 +808,10 @@ MessageFormat::setFormat(const UnicodeString& formatName,
                          const Format& newFormat,
                          UErrorCode& status) {
     if (U_FAILURE(status)) return;
+    if (frozen) {
+        status = U_NO_WRITE_PERMISSION;
+        return;
+    }
 
     int32_t argNumber = MessagePattern::validateArgumentName(formatName);
     if (argNumber < UMSGPAT_ARG_NAME_NOT_NUMBER) {
@@ -960,6 +992,22 @@ MessageFormat::format(const Formattable* arguments,
     return appendTo;
 }
 
+UnicodeString&
+MessageFormat::formatWithoutPlan(const Formattable* arguments,
+                                 const UnicodeString *argumentNames,
+                                 int32_t cnt,
+                                 UnicodeString& appendTo,
+                                 UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return appendTo;
+    }
+
+    UnicodeStringAppendable usapp(appendTo);
+    AppendableWrapper app(usapp);
+    formatPattern(0, NULL, arguments, argumentNames, cnt, app, NULL, status);
+    return appendTo;
+}
+
 namespace {
 
 /**
@@ -971,6 +1019,7 @@ class PluralSelectorContext {
     PluralSelectorContext(int32_t start, const UnicodeString &name,
                           const Formattable &num, double off, UErrorCode &errorCode)
             : startIndex(start), argName(name), offset(off),
+              plannedNumberArgIndex(0), plannedFormatter(NULL), hasPlannedNumberArg(FALSE),
               numberArgIndex(-1), formatter(NULL), forReplaceNumber(FALSE) {
         // number needs to be set even when select() is not called.
         // Keep it as a Number/Formattable:
@@ -988,6 +1037,11 @@ class PluralSelectorContext {
     /** argument number - plural offset */
     Formattable number;
     double offset;
+    // Precomputed by the MessageFormatPlan for select():
+    // What it would otherwise find via the "other" sub-message.
+    int32_t plannedNumberArgIndex;
+    const Format *plannedFormatter;
+    UBool hasPlannedNumberArg;
     // Output values for plural selection with decimals.
     /** -1 if REPLACE_NUMBER, 0 arg not found, >0 ARG_START index */
     int32_t numberArgIndex;
@@ -1015,6 +1069,27 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
         return;
     }
 
+    if (msgStart == 0 && plNumber == NULL) {
+        const MessageFormatPlan* p = getPlan();
+        if (p != NULL) {
+            format(*p, 0, NULL, arguments, argumentNames, cnt, appendTo, success);
+            return;
+        }
+    }
+    formatPattern(msgStart, plNumber, arguments, argumentNames, cnt, appendTo, ignore, success);
+}
+
+void MessageFormat::formatPattern(int32_t msgStart, const void *plNumber,
+                                  const Formattable* arguments,
+                                  const UnicodeString *argumentNames,
+                                  int32_t cnt,
+                                  AppendableWrapper& appendTo,
+                                  FieldPosition* ignore,
+                                  UErrorCode& success) const {
+    if (U_FAILURE(success)) {
+        return;
+    }
+
     const UnicodeString& msgString = msgPattern.getPatternString();
     int32_t prevIndex = msgPattern.getPart(msgStart).getLimit();
     for (int32_t i = msgStart + 1; U_SUCCESS(success) ; ++i) {
@@ -1159,6 +1234,336 @@ void MessageFormat::format(int32_t msgStart, const void *plNumber,
 }
 
 
+MessageFormatPlan::Op *MessageFormatPlan::appendOp(UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (opCount == ops.getCapacity() && ops.resize(2 * opCount, opCount) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    Op *op = ops.getAlias() + opCount++;
+    uprv_memset(op, 0, sizeof(Op));
+    return op;
+}
+
+MessageFormatPlan::Branch *MessageFormatPlan::appendBranch(UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return NULL;
+    }
+    if (branchCount == branches.getCapacity() &&
+            branches.resize(2 * branchCount, branchCount) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return branches.getAlias() + branchCount++;
+}
+
+void MessageFormat::clearPlan() {
+    delete plan;
+    plan = NULL;
+}
+
+const MessageFormatPlan* MessageFormat::getPlan() const {
+    if (plan == NULL && !frozen && msgPattern.countParts() > 0 &&
+            !MessageImpl::jdkAposMode(msgPattern)) {
+        // JDK apostrophe mode reparses complex sub-messages while formatting,
+        // which the plan does not do; format those by walking the pattern.
+        LocalPointer<MessageFormatPlan> p(new MessageFormatPlan());
+        if (p.isNull()) {
+            return NULL;
+        }
+        UErrorCode errorCode = U_ZERO_ERROR;
+        compileMessage(*p, 0, errorCode);
+        if (U_SUCCESS(errorCode)) {
+            MessageFormat* t = (MessageFormat*) this;
+            t->plan = p.orphan();
+        }
+    }
+    return plan;
+}
+
+int32_t MessageFormat::compileMessage(MessageFormatPlan& p, int32_t msgStart,
+                                      UErrorCode& errorCode) const {
+    int32_t firstOpIndex = p.opCount;
+    int32_t prevIndex = msgPattern.getPart(msgStart).getLimit();
+    for (int32_t i = msgStart + 1; U_SUCCESS(errorCode); ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        const UMessagePatternPartType type = part.getType();
+        int32_t index = part.getIndex();
+        if (index > prevIndex) {
+            MessageFormatPlan::Op *op = p.appendOp(errorCode);
+            if (op == NULL) { break; }
+            op->type = MessageFormatPlan::LITERAL;
+            op->start = prevIndex;
+            op->limit = index;
+        }
+        if (type == UMSGPAT_PART_TYPE_MSG_LIMIT) {
+            MessageFormatPlan::Op *op = p.appendOp(errorCode);
+            if (op != NULL) {
+                op->type = MessageFormatPlan::END;
+            }
+            break;
+        }
+        prevIndex = part.getLimit();
+        if (type == UMSGPAT_PART_TYPE_REPLACE_NUMBER) {
+            MessageFormatPlan::Op *op = p.appendOp(errorCode);
+            if (op != NULL) {
+                op->type = MessageFormatPlan::REPLACE_NUMBER;
+            }
+            continue;
+        }
+        if (type != UMSGPAT_PART_TYPE_ARG_START) {
+            continue;
+        }
+        // Same order of checks as in format(msgStart, ...).
+        int32_t argLimit = msgPattern.getLimitPartIndex(i);
+        UMessagePatternArgType argType = part.getArgType();
+        const MessagePattern::Part& namePart = msgPattern.getPart(i + 1);
+        MessageFormatPlan::Op *op = p.appendOp(errorCode);
+        if (op == NULL) { break; }
+        op->start = i;
+        op->limit = argLimit;
+        op->argNumber = namePart.getValue();
+        op->nameIndex = namePart.getIndex();
+        op->nameLength = namePart.getLength();
+        op->argType = argType;
+        const Format* formatter = getCachedFormatter(i);
+        if (formatter != NULL) {
+            op->type = MessageFormatPlan::FORMAT_ARG;
+            op->formatter = formatter;
+            op->isNestedFormat =
+                dynamic_cast<const ChoiceFormat*>(formatter) != NULL ||
+                dynamic_cast<const PluralFormat*>(formatter) != NULL ||
+                dynamic_cast<const SelectFormat*>(formatter) != NULL;
+        } else if (argType == UMSGPAT_ARG_TYPE_NONE ||
+                   (cachedFormatters != NULL && uhash_iget(cachedFormatters, i) != NULL)) {
+            op->type = MessageFormatPlan::DEFAULT_ARG;
+        } else if (argType == UMSGPAT_ARG_TYPE_CHOICE) {
+            op->type = MessageFormatPlan::CHOICE_ARG;
+        } else if (UMSGPAT_ARG_TYPE_HAS_PLURAL_STYLE(argType)) {
+            op->type = MessageFormatPlan::PLURAL_ARG;
+            // Same as in PluralSelectorProvider::select().
+            UnicodeString argName(FALSE, msgPattern.getPatternString().getBuffer() + op->nameIndex,
+                                  op->nameLength);
+            int32_t otherIndex = findOtherSubMessage(i + 2);
+            op->numberArgIndex = findFirstPluralNumberArg(otherIndex, argName);
+            if (op->numberArgIndex > 0 && cachedFormatters != NULL) {
+                op->numberFormatter = (const Format*)uhash_iget(cachedFormatters, op->numberArgIndex);
+            }
+        } else if (argType == UMSGPAT_ARG_TYPE_SELECT) {
+            op->type = MessageFormatPlan::SELECT_ARG;
+        } else {
+            // This should never happen. Let format(msgStart, ...) report it.
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+            break;
+        }
+        prevIndex = msgPattern.getPart(argLimit).getLimit();
+        i = argLimit;
+    }
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+
+    // Collect the sub-messages of the complex arguments, then compile them
+    // after this message's ops, so that each message is one run of ops.
+    int32_t limitOpIndex = p.opCount;
+    for (int32_t opIndex = firstOpIndex; opIndex < limitOpIndex; ++opIndex) {
+        MessageFormatPlan::OpType type = p.ops[opIndex].type;
+        if (type != MessageFormatPlan::CHOICE_ARG && type != MessageFormatPlan::PLURAL_ARG &&
+                type != MessageFormatPlan::SELECT_ARG) {
+            continue;
+        }
+        p.ops[opIndex].branchStart = p.branchCount;
+        int32_t argLimit = p.ops[opIndex].limit;
+        for (int32_t i = p.ops[opIndex].start + 2; i < argLimit; ++i) {
+            if (msgPattern.getPartType(i) == UMSGPAT_PART_TYPE_MSG_START) {
+                MessageFormatPlan::Branch *branch = p.appendBranch(errorCode);
+                if (branch == NULL) {
+                    return 0;
+                }
+                branch->msgStart = i;
+                branch->selector = i - 1;
+                branch->opIndex = 0;
+                i = msgPattern.getLimitPartIndex(i);
+            }
+        }
+        p.ops[opIndex].branchLimit = p.branchCount;
+    }
+    UnicodeString other(FALSE, OTHER_STRING, 5);
+    for (int32_t opIndex = firstOpIndex; opIndex < limitOpIndex; ++opIndex) {
+        int32_t branchLimit = p.ops[opIndex].branchLimit;
+        for (int32_t b = p.ops[opIndex].branchStart; b < branchLimit; ++b) {
+            int32_t subOpIndex = compileMessage(p, p.branches[b].msgStart, errorCode);
+            if (U_FAILURE(errorCode)) {
+                return 0;
+            }
+            p.branches[b].opIndex = subOpIndex;
+            if (p.ops[opIndex].type == MessageFormatPlan::SELECT_ARG &&
+                    p.ops[opIndex].otherOpIndex == 0 &&
+                    msgPattern.partSubstringMatches(
+                        msgPattern.getPart(p.branches[b].selector), other)) {
+                p.ops[opIndex].otherOpIndex = subOpIndex;
+            }
+        }
+    }
+    return firstOpIndex;
+}
+
+void MessageFormat::format(const MessageFormatPlan& p,
+                           int32_t opIndex,
+                           const void *plNumber,
+                           const Formattable* arguments,
+                           const UnicodeString *argumentNames,
+                           int32_t cnt,
+                           AppendableWrapper& appendTo,
+                           UErrorCode& success) const {
+    const UnicodeString& msgString = msgPattern.getPatternString();
+    for (const MessageFormatPlan::Op* op = p.ops.getAlias() + opIndex; U_SUCCESS(success); ++op) {
+        switch (op->type) {
+        case MessageFormatPlan::END:
+            return;
+        case MessageFormatPlan::LITERAL:
+            appendTo.append(msgString.getBuffer() + op->start, op->limit - op->start);
+            continue;
+        case MessageFormatPlan::REPLACE_NUMBER: {
+            const PluralSelectorContext &pluralNumber =
+                *static_cast<const PluralSelectorContext *>(plNumber);
+            if(pluralNumber.forReplaceNumber) {
+                // number-offset was already formatted.
+                appendTo.formatAndAppend(pluralNumber.formatter,
+                        pluralNumber.number, pluralNumber.numberString, success);
+            } else {
+                const NumberFormat* nf = getDefaultNumberFormat(success);
+                appendTo.formatAndAppend(nf, pluralNumber.number, success);
+            }
+            continue;
+        }
+        default:
+            break;
+        }
+
+        // Read-only alias, no copy. Only needed for named arguments,
+        // plural arguments and missing arguments.
+        UnicodeString argName;
+        const Formattable* arg;
+        if (argumentNames == NULL) {
+            int32_t argNumber = op->argNumber;  // ARG_NUMBER
+            arg = (0 <= argNumber && argNumber < cnt) ? arguments + argNumber : NULL;
+            if (arg == NULL || op->type == MessageFormatPlan::PLURAL_ARG) {
+                argName.setTo(FALSE, msgString.getBuffer() + op->nameIndex, op->nameLength);
+            }
+        } else {
+            argName.setTo(FALSE, msgString.getBuffer() + op->nameIndex, op->nameLength);
+            arg = getArgFromListByName(arguments, argumentNames, cnt, argName);
+        }
+        if (arg == NULL) {
+            appendTo.append(
+                UnicodeString(LEFT_CURLY_BRACE).append(argName).append(RIGHT_CURLY_BRACE));
+            continue;
+        }
+        // The ARG_START part index i-2 and style part index i in format(msgStart, ...).
+        int32_t i = op->start + 2;
+        if(plNumber!=NULL &&
+                static_cast<const PluralSelectorContext *>(plNumber)->numberArgIndex==op->start) {
+            const PluralSelectorContext &pluralNumber =
+                *static_cast<const PluralSelectorContext *>(plNumber);
+            if(pluralNumber.offset == 0) {
+                // The number was already formatted with this formatter.
+                appendTo.formatAndAppend(pluralNumber.formatter, pluralNumber.number,
+                                         pluralNumber.numberString, success);
+            } else {
+                // Do not use the formatted (number-offset) string for a named argument
+                // that formats the number without subtracting the offset.
+                appendTo.formatAndAppend(pluralNumber.formatter, *arg, success);
+            }
+            continue;
+        }
+        switch (op->type) {
+        case MessageFormatPlan::FORMAT_ARG:
+            if (op->isNestedFormat) {
+                // There is no plan in JDK apostrophe mode, see getPlan().
+                UnicodeString subMsgString;
+                op->formatter->format(*arg, subMsgString, success);
+                if (subMsgString.indexOf(LEFT_CURLY_BRACE) >= 0 ||
+                    subMsgString.indexOf(SINGLE_QUOTE) >= 0) {
+                    MessageFormat subMsgFormat(subMsgString, fLocale, success);
+                    subMsgFormat.format(0, NULL, arguments, argumentNames, cnt, appendTo, NULL, success);
+                } else {
+                    appendTo.append(subMsgString);
+                }
+            } else {
+                appendTo.formatAndAppend(op->formatter, *arg, success);
+            }
+            break;
+        case MessageFormatPlan::DEFAULT_ARG:
+            if (arg->isNumeric()) {
+                const NumberFormat* nf = getDefaultNumberFormat(success);
+                appendTo.formatAndAppend(nf, *arg, success);
+            } else if (arg->getType() == Formattable::kDate) {
+                const DateFormat* df = getDefaultDateFormat(success);
+                appendTo.formatAndAppend(df, *arg, success);
+            } else {
+                appendTo.append(arg->getString(success));
+            }
+            break;
+        case MessageFormatPlan::CHOICE_ARG: {
+            if (!arg->isNumeric()) {
+                success = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            const double number = arg->getDouble(success);
+            int32_t subMsgStart = ChoiceFormat::findSubMessage(msgPattern, i, number);
+            format(p, p.getSubMessageOpIndex(*op, subMsgStart), NULL,
+                   arguments, argumentNames, cnt, appendTo, success);
+            break;
+        }
+        case MessageFormatPlan::PLURAL_ARG: {
+            if (!arg->isNumeric()) {
+                success = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            const PluralSelectorProvider &selector =
+                op->argType == UMSGPAT_ARG_TYPE_PLURAL ? pluralProvider : ordinalProvider;
+            double offset = msgPattern.getPluralOffset(i);
+            PluralSelectorContext context(i, argName, *arg, offset, success);
+            context.plannedNumberArgIndex = op->numberArgIndex;
+            context.plannedFormatter = op->numberFormatter;
+            context.hasPlannedNumberArg = TRUE;
+            int32_t subMsgStart = PluralFormat::findSubMessage(
+                    msgPattern, i, selector, &context, arg->getDouble(success), success);
+            if (U_FAILURE(success)) {
+                return;
+            }
+            format(p, p.getSubMessageOpIndex(*op, subMsgStart), &context,
+                   arguments, argumentNames, cnt, appendTo, success);
+            break;
+        }
+        case MessageFormatPlan::SELECT_ARG: {
+            const UnicodeString& keyword = arg->getString(success);
+            if (U_FAILURE(success)) {
+                return;
+            }
+            // Prebound jump table: The first matching selector wins, else "other".
+            int32_t subOpIndex = op->otherOpIndex;
+            for (int32_t b = op->branchStart; b < op->branchLimit; ++b) {
+                if (msgPattern.partSubstringMatches(msgPattern.getPart(p.branches[b].selector), keyword)) {
+                    subOpIndex = p.branches[b].opIndex;
+                    break;
+                }
+            }
+            format(p, subOpIndex, NULL, arguments, argumentNames, cnt, appendTo, success);
+            break;
+        }
+        default:
+            // This should never happen.
+            success = U_INTERNAL_PROGRAM_ERROR;
+            return;
+        }
+    }
+}
+
+
 void MessageFormat::formatComplexSubMessage(int32_t msgStart,
                                             const void *plNumber,
                                             const Formattable* arguments,
@@ -1314,8 +1719,9 @@ void MessageFormat::copyObjects(const MessageFormat& that, UErrorCode& ec) {
     // Deep copy pointer fields.
     // We need not copy the formatAliases because they are re-filled
     // in each getFormats() call.
-    // The defaultNumberFormat, defaultDateFormat and pluralProvider.rules
-    // also get created on demand.
+    // The defaultNumberFormat, defaultDateFormat, pluralProvider.rules
+    // and the plan also get created on demand.
+    clearPlan();
     argTypeCount = that.argTypeCount;
     if (argTypeCount > 0) {
         if (!allocateArgTypes(argTypeCount, ec)) {
@@ -1582,6 +1988,7 @@ static Format* makeRBNF(URBNFRuleSetTag tag, const Locale& locale, const Unicode
 }
 
 void MessageFormat::cacheExplicitFormats(UErrorCode& status) {
+    clearPlan();
     if (U_FAILURE(status)) {
         return;
     }
@@ -1859,6 +2266,52 @@ MessageFormat::usesNamedArguments() const {
     return msgPattern.hasNamedArguments();
 }
 
+void MessageFormat::freeze(UErrorCode& status) {
+    if (U_FAILURE(status) || frozen) {
+        return;
+    }
+    // Create everything that the const methods would otherwise create on first use.
+    getDefaultNumberFormat(status);
+    getDefaultDateFormat(status);
+    for (int32_t i = 0; i < msgPattern.countParts() && U_SUCCESS(status); ++i) {
+        const MessagePattern::Part& part = msgPattern.getPart(i);
+        if (part.getType() == UMSGPAT_PART_TYPE_ARG_START) {
+            UMessagePatternArgType argType = part.getArgType();
+            if (argType == UMSGPAT_ARG_TYPE_PLURAL) {
+                pluralProvider.loadRules(status);
+            } else if (argType == UMSGPAT_ARG_TYPE_SELECTORDINAL) {
+                ordinalProvider.loadRules(status);
+            }
+        }
+    }
+    // Also freeze our own number formatters, so that they are compiled up front too.
+    // (Other argument formatters do not change while formatting.)
+    DecimalFormat* decFmt = dynamic_cast<DecimalFormat*>(defaultNumberFormat);
+    if (decFmt != NULL) {
+        decFmt->freeze(status);
+    }
+    if (cachedFormatters != NULL) {
+        const int32_t count = uhash_count(cachedFormatters);
+        int32_t pos = UHASH_FIRST;
+        for (int32_t idx = 0; idx < count && U_SUCCESS(status); ++idx) {
+            const UHashElement* cur = uhash_nextElement(cachedFormatters, &pos);
+            decFmt = dynamic_cast<DecimalFormat*>((Format*)cur->value.pointer);
+            if (decFmt != NULL) {
+                decFmt->freeze(status);
+            }
+        }
+    }
+    getPlan();
+    if (U_SUCCESS(status)) {
+        frozen = TRUE;
+    }
+}
+
+UBool
+MessageFormat::isFrozen() const {
+    return frozen;
+}
+
 int32_t
 MessageFormat::getArgTypeCount() const {
     return argTypeCount;
@@ -1952,9 +2405,8 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     if (U_FAILURE(ec)) {
         return UnicodeString(FALSE, OTHER_STRING, 5);
     }
-    MessageFormat::PluralSelectorProvider* t = const_cast<MessageFormat::PluralSelectorProvider*>(this);
     if(rules == NULL) {
-        t->rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
+        const_cast<MessageFormat::PluralSelectorProvider*>(this)->loadRules(ec);
         if (U_FAILURE(ec)) {
             return UnicodeString(FALSE, OTHER_STRING, 5);
         }
@@ -1966,11 +2418,16 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     // which must always be present and usually contains the number.
     // Message authors should be consistent across sub-messages.
     PluralSelectorContext &context = *static_cast<PluralSelectorContext *>(ctx);
-    int32_t otherIndex = msgFormat.findOtherSubMessage(context.startIndex);
-    context.numberArgIndex = msgFormat.findFirstPluralNumberArg(otherIndex, context.argName);
-    if(context.numberArgIndex > 0 && msgFormat.cachedFormatters != NULL) {
-        context.formatter =
-            (const Format*)uhash_iget(msgFormat.cachedFormatters, context.numberArgIndex);
+    if(context.hasPlannedNumberArg) {
+        context.numberArgIndex = context.plannedNumberArgIndex;
+        context.formatter = context.plannedFormatter;
+    } else {
+        int32_t otherIndex = msgFormat.findOtherSubMessage(context.startIndex);
+        context.numberArgIndex = msgFormat.findFirstPluralNumberArg(otherIndex, context.argName);
+        if(context.numberArgIndex > 0 && msgFormat.cachedFormatters != NULL) {
+            context.formatter =
+                (const Format*)uhash_iget(msgFormat.cachedFormatters, context.numberArgIndex);
+        }
     }
     if(context.formatter == NULL) {
         context.formatter = msgFormat.getDefaultNumberFormat(ec);
@@ -1994,6 +2451,12 @@ UnicodeString MessageFormat::PluralSelectorProvider::select(void *ctx, double nu
     }
 }
 
+void MessageFormat::PluralSelectorProvider::loadRules(UErrorCode& ec) {
+    if (U_SUCCESS(ec) && rules == NULL) {
+        rules = PluralRules::forLocale(msgFormat.fLocale, type, ec);
+    }
+}
+
 void MessageFormat::PluralSelectorProvider::reset() {
     delete rules;
     rules = NULL;
@@ -19,6 +19,7 @@
 #if !UCONFIG_NO_FORMATTING
     
 #include "unicode/msgfmt.h"
+#include "cmemory.h"
 #include "uvector.h"
 #include "unicode/strenum.h"
 
@@ -38,6 +39,99 @@ class FormatNameEnumeration : public StringEnumeration {
     UVector *fFormatNames;
 };
 
+/**
+ * A MessageFormat pattern compiled into flat arrays, so that formatting
+ * need not walk the MessagePattern parts, look up formatters in hash tables,
+ * nor search for the limits of arguments.
+ *
+ * Each message and sub-message is a run of ops that ends with an END op.
+ * Each complex argument refers to a range of branches, one per sub-message.
+ * Built by MessageFormat::getPlan().
+ */
+class MessageFormatPlan : public UMemory {
+public:
+    enum OpType {
+        END,
+        /** Literal text [start, limit[ of the pattern string. */
+        LITERAL,
+        /** '#' in a plural sub-message. */
+        REPLACE_NUMBER,
+        /** Argument with a custom or explicit formatter. */
+        FORMAT_ARG,
+        /** Argument with the default number/date format, or appended as a string. */
+        DEFAULT_ARG,
+        CHOICE_ARG,
+        PLURAL_ARG,
+        SELECT_ARG
+    };
+
+    struct Op {
+        OpType type;
+        /** LITERAL: pattern string index; arguments: ARG_START part index */
+        int32_t start;
+        /** LITERAL: pattern string limit; arguments: ARG_LIMIT part index */
+        int32_t limit;
+        /** Value of the ARG_NUMBER or ARG_NAME part. */
+        int32_t argNumber;
+        /** Pattern string index and length of the argument name or number. */
+        int32_t nameIndex;
+        int32_t nameLength;
+        /** FORMAT_ARG: the cached formatter; not owned */
+        const Format *formatter;
+        /** FORMAT_ARG: TRUE if the formatter is a ChoiceFormat, PluralFormat or SelectFormat. */
+        UBool isNestedFormat;
+        /** PLURAL_ARG: UMSGPAT_ARG_TYPE_PLURAL or UMSGPAT_ARG_TYPE_SELECTORDINAL */
+        UMessagePatternArgType argType;
+        /**
+         * PLURAL_ARG: ARG_START of the first plural number argument in the "other" sub-message
+         * (-1 for a '#', 0 for neither), and its cached formatter.
+         */
+        int32_t numberArgIndex;
+        const Format *numberFormatter;
+        /** Complex arguments: [branchStart, branchLimit[ of the branches. */
+        int32_t branchStart;
+        int32_t branchLimit;
+        /** SELECT_ARG: first op of the "other" sub-message */
+        int32_t otherOpIndex;
+    };
+
+    struct Branch {
+        /** MSG_START part index of the sub-message */
+        int32_t msgStart;
+        /** ARG_SELECTOR part index (for a select argument) */
+        int32_t selector;
+        /** First op of the sub-message */
+        int32_t opIndex;
+    };
+
+    MessageFormatPlan() : opCount(0), branchCount(0) {}
+
+    Op *appendOp(UErrorCode &errorCode);
+    Branch *appendBranch(UErrorCode &errorCode);
+
+    /**
+     * Returns the first op of the sub-message that starts at msgStart,
+     * or of the top-level message if there is no such branch.
+     */
+    int32_t getSubMessageOpIndex(const Op &op, int32_t msgStart) const {
+        for (int32_t i = op.branchStart; i < op.branchLimit; ++i) {
+            if (branches[i].msgStart == msgStart) {
+                return branches[i].opIndex;
+            }
+        }
+        return 0;
+    }
+
+    MaybeStackArray<Op, 16> ops;
+    int32_t opCount;
+    MaybeStackArray<Branch, 8> branches;
+    int32_t branchCount;
+
+private:
+    MessageFormatPlan(const MessageFormatPlan &) = delete;
+    MessageFormatPlan &operator=(const MessageFormatPlan &) = delete;
+};
+
 U_NAMESPACE_END
 
 #endif
@@ -136,6 +136,7 @@ static const UChar gNoparse[] =
 NFRuleSet::NFRuleSet(RuleBasedNumberFormat *_owner, UnicodeString* descriptions, int32_t index, UErrorCode& status)
   : name()
   , rules(0)
+  , fLeastCommonMultiple(0)
   , owner(_owner)
   , fractionRules()
   , fIsFractionRuleSet(FALSE)
@@ -260,6 +261,55 @@ NFRuleSet::parseRules(UnicodeString& description, UErrorCode& status)
             ++defaultBaseValue;
         }
     }
+
+    buildRuleBounds(status);
+}
+
+void
+NFRuleSet::buildRuleBounds(UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t rulesSize = rules.size();
+    if (rulesSize == 0) {
+        fRuleBounds.adoptInstead(NULL);
+        return;
+    }
+    if (fRuleBounds.allocateInsteadAndCopy(rulesSize, 0) == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < rulesSize; i++) {
+        fRuleBounds[i].baseValue = rules[i]->getBaseValue();
+        fRuleBounds[i].rollBackDivisor = rules[i]->getRollBackDivisor();
+    }
+    if (fIsFractionRuleSet) {
+        computeLeastCommonMultiple();
+    }
+}
+
+/**
+ * Marks this as a fraction rule set. This can happen before or after
+ * parseRules(), while the owning formatter is being constructed.
+ */
+void
+NFRuleSet::makeIntoFractionRuleSet()
+{
+    fIsFractionRuleSet = TRUE;
+    if (fRuleBounds.isValid()) {
+        computeLeastCommonMultiple();
+    }
+}
+
+void
+NFRuleSet::computeLeastCommonMultiple()
+{
+    int64_t leastCommonMultiple = fRuleBounds[0].baseValue;
+    for (uint32_t i = 1; i < rules.size(); ++i) {
+        leastCommonMultiple = util_lcm(leastCommonMultiple, fRuleBounds[i].baseValue);
+    }
+    fLeastCommonMultiple = leastCommonMultiple;
 }
 
 /**
@@ -520,14 +570,15 @@ NFRuleSet::findNormalRule(int64_t number) const
     // the next rule's base value)
     int32_t hi = rules.size();
     if (hi > 0) {
+        const RuleBound *bounds = fRuleBounds.getAlias();
         int32_t lo = 0;
 
         while (lo < hi) {
             int32_t mid = (lo + hi) / 2;
-            if (rules[mid]->getBaseValue() == number) {
+            if (bounds[mid].baseValue == number) {
                 return rules[mid];
             }
-            else if (rules[mid]->getBaseValue() > number) {
+            else if (bounds[mid].baseValue > number) {
                 hi = mid;
             }
             else {
@@ -538,20 +589,19 @@ NFRuleSet::findNormalRule(int64_t number) const
             return NULL; // want to throw exception here
         }
 
-        NFRule *result = rules[hi - 1];
-
-        // use shouldRollBack() to see whether we need to invoke the
-        // rollback rule (see shouldRollBack()'s documentation for
+        // use the rollback divisor to see whether we need to invoke the
+        // rollback rule (see NFRule::getRollBackDivisor() for
         // an explanation of the rollback rule).  If we do, roll back
         // one rule and return that one instead of the one we'd normally
         // return
-        if (result->shouldRollBack(number)) {
+        int64_t rollBackDivisor = bounds[hi - 1].rollBackDivisor;
+        if (rollBackDivisor != 0 && (number % rollBackDivisor) == 0) {
             if (hi == 1) { // bad rule set, no prior rule to rollback to from this base
                 return NULL;
             }
-            result = rules[hi - 2];
+            return rules[hi - 2];
         }
-        return result;
+        return rules[hi - 1];
     }
     // else use the master rule
     return nonNumericalRules[MASTER_RULE_INDEX];
@@ -584,14 +634,10 @@ NFRuleSet::findFractionRuleSetRule(double number) const
     // and multiply this by the number being formatted.  This is
     // all the precision we need, and we can do all of the rest
     // of the math using integer arithmetic
-    int64_t leastCommonMultiple = rules[0]->getBaseValue();
-    int64_t numerator;
-    {
-        for (uint32_t i = 1; i < rules.size(); ++i) {
-            leastCommonMultiple = util_lcm(leastCommonMultiple, rules[i]->getBaseValue());
-        }
-        numerator = util64_fromDouble(number * (double)leastCommonMultiple + 0.5);
-    }
+    // (the least common multiple is computed when the rule set is built)
+    const RuleBound *bounds = fRuleBounds.getAlias();
+    int64_t leastCommonMultiple = fLeastCommonMultiple;
+    int64_t numerator = util64_fromDouble(number * (double)leastCommonMultiple + 0.5);
     // for each rule, do the following...
     int64_t tempDifference;
     int64_t difference = util64_fromDouble(uprv_maxMantissa());
@@ -603,7 +649,7 @@ NFRuleSet::findFractionRuleSetRule(double number) const
         // base value divided bythe LCD.  Here we check to see if
         // that's an integer, and if not, how close it is to being
         // an integer.
-        tempDifference = numerator * rules[i]->getBaseValue() % leastCommonMultiple;
+        tempDifference = numerator * bounds[i].baseValue % leastCommonMultiple;
 
 
         // normalize the result of the above calculation: we want
@@ -633,8 +679,8 @@ NFRuleSet::findFractionRuleSetRule(double number) const
     // do things like "one third"/"two thirds" without haveing to define
     // a whole bunch of extra rule sets)
     if ((unsigned)(winner + 1) < rules.size() &&
-        rules[winner + 1]->getBaseValue() == rules[winner]->getBaseValue()) {
-        double n = ((double)rules[winner]->getBaseValue()) * number;
+        bounds[winner + 1].baseValue == bounds[winner].baseValue) {
+        double n = ((double)bounds[winner].baseValue) * number;
         if (n < 0.5 || n >= 2) {
             ++winner;
         }
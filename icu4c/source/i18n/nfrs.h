@@ -36,7 +36,7 @@ class NFRuleSet : public UMemory {
     void parseRules(UnicodeString& rules, UErrorCode& status);
     void setNonNumericalRule(NFRule *rule);
     void setBestFractionRule(int32_t originalIndex, NFRule *newRule, UBool rememberRule);
-    void makeIntoFractionRuleSet() { fIsFractionRuleSet = TRUE; }
+    void makeIntoFractionRuleSet();
 
     ~NFRuleSet();
 
@@ -66,12 +66,25 @@ class NFRuleSet : public UMemory {
     const NFRule * findNormalRule(int64_t number) const;
     const NFRule * findDoubleRule(double number) const;
     const NFRule * findFractionRuleSetRule(double number) const;
+    void buildRuleBounds(UErrorCode& status);
+    void computeLeastCommonMultiple();
     
     friend class NFSubstitution;
 
 private:
+    // The base value of each normal rule with its rollback divisor (0 if the
+    // rule never rolls back), contiguous so that findNormalRule() can search
+    // them without touching the rules themselves.
+    struct RuleBound {
+        int64_t baseValue;
+        int64_t rollBackDivisor;
+    };
+
     UnicodeString name;
     NFRuleList rules;
+    LocalMemory<RuleBound> fRuleBounds;
+    // The least common multiple of the rules' base values in a fraction rule set.
+    int64_t fLeastCommonMultiple;
     NFRule *nonNumericalRules[6];
     RuleBasedNumberFormat *owner;
     NFRuleList fractionRules;
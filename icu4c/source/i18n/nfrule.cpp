@@ -738,6 +738,29 @@ int64_t NFRule::getDivisor() const
 void
 NFRule::doFormat(int64_t number, UnicodeString& toInsertInto, int32_t pos, int32_t recursionCount, UErrorCode& status) const
 {
+    if (pos == toInsertInto.length()) {
+        // This is the usual case of appending the result: append the rule
+        // text and the substitution results in order, so that the text
+        // does not have to be shifted by inserting into the middle of it.
+        int32_t pluralValue = 0;
+        if (rulePatternFormat) {
+            pluralValue = (int32_t)(number/util64_pow(radix, exponent));
+        }
+        int32_t start = 0;
+        if (sub1 != NULL) {
+            appendRuleText(start, sub1->getPos(), pluralValue, toInsertInto, status);
+            start = sub1->getPos();
+            sub1->doSubstitution(number, toInsertInto, toInsertInto.length() - start, recursionCount, status);
+        }
+        if (sub2 != NULL) {
+            appendRuleText(start, sub2->getPos(), pluralValue, toInsertInto, status);
+            start = sub2->getPos();
+            sub2->doSubstitution(number, toInsertInto, toInsertInto.length() - start, recursionCount, status);
+        }
+        appendRuleText(start, fRuleText.length(), pluralValue, toInsertInto, status);
+        return;
+    }
+
     // first, insert the rule's rule text into toInsertInto at the
     // specified position, then insert the results of the substitutions
     // into the right places in toInsertInto (notice we do the
@@ -789,6 +812,36 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
     // [again, we have two copies of this routine that do the same thing
     // so that we don't sacrifice precision in a long by casting it
     // to a double]
+    if (pos == toInsertInto.length()) {
+        // Append in order, as in the int64_t version.
+        int32_t pluralValue = 0;
+        if (rulePatternFormat) {
+            double pluralVal = number;
+            if (0 <= pluralVal && pluralVal < 1) {
+                // We're in a fractional rule, and we have to match the NumeratorSubstitution behavior.
+                // 2.3 can become 0.2999999999999998 for the fraction due to rounding errors.
+                pluralVal = uprv_round(pluralVal * util64_pow(radix, exponent));
+            }
+            else {
+                pluralVal = pluralVal / util64_pow(radix, exponent);
+            }
+            pluralValue = (int32_t)(pluralVal);
+        }
+        int32_t start = 0;
+        if (sub1 != NULL) {
+            appendRuleText(start, sub1->getPos(), pluralValue, toInsertInto, status);
+            start = sub1->getPos();
+            sub1->doSubstitution(number, toInsertInto, toInsertInto.length() - start, recursionCount, status);
+        }
+        if (sub2 != NULL) {
+            appendRuleText(start, sub2->getPos(), pluralValue, toInsertInto, status);
+            start = sub2->getPos();
+            sub2->doSubstitution(number, toInsertInto, toInsertInto.length() - start, recursionCount, status);
+        }
+        appendRuleText(start, fRuleText.length(), pluralValue, toInsertInto, status);
+        return;
+    }
+
     int32_t pluralRuleStart = fRuleText.length();
     int32_t lengthOffset = 0;
     if (!rulePatternFormat) {
@@ -826,15 +879,36 @@ NFRule::doFormat(double number, UnicodeString& toInsertInto, int32_t pos, int32_
 }
 
 /**
-* Used by the owning rule set to determine whether to invoke the
-* rollback rule (i.e., whether this rule or the one that precedes
-* it in the rule set's list should be used to format the number)
-* @param The number being formatted
-* @return True if the rule set should use the rule that precedes
-* this one in its list; false if it should use this rule
+* Appends the rule text between start and limit to toAppendTo. If the
+* plural pattern begins in that range, it is formatted for pluralValue.
+* A substitution never falls inside the plural pattern.
 */
-UBool
-NFRule::shouldRollBack(int64_t number) const
+void
+NFRule::appendRuleText(int32_t start, int32_t limit, int32_t pluralValue, UnicodeString& toAppendTo, UErrorCode& status) const
+{
+    if (rulePatternFormat) {
+        int32_t pluralRuleStart = fRuleText.indexOf(gDollarOpenParenthesis, -1, 0);
+        if (start <= pluralRuleStart && pluralRuleStart < limit) {
+            int32_t pluralRuleEnd = fRuleText.indexOf(gClosedParenthesisDollar, -1, pluralRuleStart);
+            toAppendTo.append(fRuleText, start, pluralRuleStart - start);
+            FieldPosition pos(FieldPosition::DONT_CARE);
+            rulePatternFormat->format(pluralValue, toAppendTo, pos, status);
+            start = pluralRuleEnd + 2;
+        }
+    }
+    toAppendTo.append(fRuleText, start, limit - start);
+}
+
+/**
+* Returns the divisor that the owning rule set uses to determine whether
+* to invoke the rollback rule (i.e., whether this rule or the one that
+* precedes it in the rule set's list should be used to format the number):
+* the rule set uses the preceding rule for numbers that are even multiples
+* of the divisor.
+* @return The rule's divisor, or 0 if the rule never rolls back
+*/
+int64_t
+NFRule::getRollBackDivisor() const
 {
     // we roll back if the rule contains a modulus substitution,
     // the number being formatted is an even multiple of the rule's
@@ -854,9 +928,11 @@ NFRule::shouldRollBack(int64_t number) const
     // multiple of 100.  This is called the "rollback rule."
     if ((sub1 != NULL && sub1->isModulusSubstitution()) || (sub2 != NULL && sub2->isModulusSubstitution())) {
         int64_t re = util64_pow(radix, exponent);
-        return (number % re) == 0 && (baseValue % re) != 0;
+        if (re != 0 && (baseValue % re) != 0) {
+            return re;
+        }
     }
-    return FALSE;
+    return 0;
 }
 
 //-----------------------------------------------------------------------
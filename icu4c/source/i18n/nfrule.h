@@ -77,7 +77,7 @@ class NFRule : public UMemory {
                   uint32_t nonNumericalExecutedRuleMask,
                   Formattable& result) const;
 
-    UBool shouldRollBack(int64_t number) const;
+    int64_t getRollBackDivisor() const;
 
     void _appendRuleText(UnicodeString& result) const;
 
@@ -91,6 +91,8 @@ class NFRule : public UMemory {
     void extractSubstitutions(const NFRuleSet* ruleSet, const UnicodeString &ruleText, const NFRule* predecessor, UErrorCode& status);
     NFSubstitution* extractSubstitution(const NFRuleSet* ruleSet, const NFRule* predecessor, UErrorCode& status);
     
+    void appendRuleText(int32_t start, int32_t limit, int32_t pluralValue, UnicodeString& toAppendTo, UErrorCode& status) const;
+
     int16_t expectedExponent() const;
     int32_t indexOfAnyRulePrefix() const;
     double matchToDelimiter(const UnicodeString& text, int32_t startPos, double baseValue,
@@ -589,9 +589,13 @@ NFSubstitution::doSubstitution(int64_t number, UnicodeString& toInsertInto, int3
                 numberToFormat = uprv_floor(numberToFormat);
             }
 
-            UnicodeString temp;
-            numberFormat->format(numberToFormat, temp, status);
-            toInsertInto.insert(_pos + this->pos, temp);
+            if (_pos + this->pos == toInsertInto.length()) {
+                numberFormat->format(numberToFormat, toInsertInto, status);
+            } else {
+                UnicodeString temp;
+                numberFormat->format(numberToFormat, temp, status);
+                toInsertInto.insert(_pos + this->pos, temp);
+            }
         } 
         else { 
             // We have gone beyond double precision. Something has to give. 
@@ -602,9 +606,13 @@ NFSubstitution::doSubstitution(int64_t number, UnicodeString& toInsertInto, int3
             // on the type of substitution this is, then just call its 
             // rule set's format() method to format the result 
             int64_t numberToFormat = transformNumber(number); 
-            UnicodeString temp;
-            numberFormat->format(numberToFormat, temp, status);
-            toInsertInto.insert(_pos + this->pos, temp);
+            if (_pos + this->pos == toInsertInto.length()) {
+                numberFormat->format(numberToFormat, toInsertInto, status);
+            } else {
+                UnicodeString temp;
+                numberFormat->format(numberToFormat, temp, status);
+                toInsertInto.insert(_pos + this->pos, temp);
+            }
         } 
     }
 }
@@ -644,9 +652,13 @@ NFSubstitution::doSubstitution(double number, UnicodeString& toInsertInto, int32
         if (ruleSet != NULL) {
             ruleSet->format(numberToFormat, toInsertInto, _pos + this->pos, recursionCount, status);
         } else if (numberFormat != NULL) {
-            UnicodeString temp;
-            numberFormat->format(numberToFormat, temp);
-            toInsertInto.insert(_pos + this->pos, temp);
+            if (_pos + this->pos == toInsertInto.length()) {
+                numberFormat->format(numberToFormat, toInsertInto);
+            } else {
+                UnicodeString temp;
+                numberFormat->format(numberToFormat, temp);
+                toInsertInto.insert(_pos + this->pos, temp);
+            }
         }
     }
 }
@@ -1077,17 +1089,32 @@ FractionalPartSubstitution::doSubstitution(double number, UnicodeString& toInser
     dl.roundToMagnitude(-20, UNUM_ROUND_HALFEVEN, status);     // round to 20 fraction digits.
     
     UBool pad = FALSE;
-    for (int32_t didx = dl.getLowerDisplayMagnitude(); didx<0; didx++) {
-      // Loop iterates over fraction digits, starting with the LSD.
-      //   include both real digits from the number, and zeros
-      //   to the left of the MSD but to the right of the decimal point.
-      if (pad && useSpaces) {
-        toInsertInto.insert(_pos + getPos(), gSpace);
-      } else {
-        pad = TRUE;
+    if (_pos + getPos() == toInsertInto.length()) {
+      // Appending: format the digits in order starting with the MSD, so that
+      // the digits' rules append as well instead of inserting before the
+      // digits formatted so far.
+      for (int32_t didx = -1; didx >= dl.getLowerDisplayMagnitude(); didx--) {
+        if (pad && useSpaces) {
+          toInsertInto.append(gSpace);
+        } else {
+          pad = TRUE;
+        }
+        int64_t digit = dl.getDigit(didx);
+        getRuleSet()->format(digit, toInsertInto, toInsertInto.length(), recursionCount, status);
+      }
+    } else {
+      for (int32_t didx = dl.getLowerDisplayMagnitude(); didx<0; didx++) {
+        // Loop iterates over fraction digits, starting with the LSD.
+        //   include both real digits from the number, and zeros
+        //   to the left of the MSD but to the right of the decimal point.
+        if (pad && useSpaces) {
+          toInsertInto.insert(_pos + getPos(), gSpace);
+        } else {
+          pad = TRUE;
+        }
+        int64_t digit = dl.getDigit(didx);
+        getRuleSet()->format(digit, toInsertInto, _pos + getPos(), recursionCount, status);
       }
-      int64_t digit = dl.getDigit(didx);
-      getRuleSet()->format(digit, toInsertInto, _pos + getPos(), recursionCount, status);
     }
 
     if (!pad) {
@@ -194,6 +194,9 @@ struct DecimalFormatFields : public UMemory {
     /** The effective properties as exported from the formatter object. Used by some getters. */
     DecimalFormatProperties exportedProperties;
 
+    /** Set by DecimalFormat::freeze(); the setters do nothing once this is true. */
+    bool frozen = false;
+
     // Data for fastpath
     bool canUseFastFormat = false;
     struct FastFormatData {
@@ -67,6 +67,7 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(PluralKeywordEnumeration)
 PluralRules::PluralRules(UErrorCode& /*status*/)
 :   UObject(),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
 }
@@ -74,6 +75,7 @@ PluralRules::PluralRules(UErrorCode& /*status*/)
 PluralRules::PluralRules(const PluralRules& other)
 : UObject(other),
     mRules(nullptr),
+    mProgram(nullptr),
     mInternalStatus(U_ZERO_ERROR)
 {
     *this=other;
@@ -81,6 +83,7 @@ PluralRules::PluralRules(const PluralRules& other)
 
 PluralRules::~PluralRules() {
     delete mRules;
+    delete mProgram;
 }
 
 SharedPluralRules::~SharedPluralRules() {
@@ -104,6 +107,8 @@ PluralRules::operator=(const PluralRules& other) {
     if (this != &other) {
         delete mRules;
         mRules = nullptr;
+        delete mProgram;
+        mProgram = nullptr;
         mInternalStatus = other.mInternalStatus;
         if (U_FAILURE(mInternalStatus)) {
             // bail out early if the object we were copying from was already 'invalid'.
@@ -119,6 +124,15 @@ PluralRules::operator=(const PluralRules& other) {
                 mInternalStatus = mRules->fInternalStatus;
             }
         }
+        if (other.mProgram != nullptr && U_SUCCESS(mInternalStatus)) {
+            // Without the program, select() evaluates the RuleChain.
+            UErrorCode programStatus = U_ZERO_ERROR;
+            LocalPointer<PluralRuleProgram> program(
+                new PluralRuleProgram(*other.mProgram, programStatus), programStatus);
+            if (U_SUCCESS(programStatus)) {
+                mProgram = program.orphan();
+            }
+        }
     }
     return *this;
 }
@@ -255,13 +269,36 @@ PluralRules::internalForLocale(const Locale& locale, UPluralType type, UErrorCod
     return newObj.orphan();
 }
 
+/**
+ * Returns the keyword of the rule chain with the given index,
+ * or "other" for the index after the last chain.
+ */
+static UnicodeString
+getChainKeyword(const RuleChain *rules, int32_t index) {
+    for (; index > 0 && rules != nullptr; --index) {
+        rules = rules->fNext;
+    }
+    if (rules != nullptr) {
+        return rules->fKeyword;
+    }
+    return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
+}
+
 UnicodeString
 PluralRules::select(int32_t number) const {
+    if (mProgram != nullptr) {
+        int64_t n = number;
+        return getChainKeyword(mRules, mProgram->selectInteger(n >= 0 ? n : -n));
+    }
     return select(FixedDecimal(number));
 }
 
 UnicodeString
 PluralRules::select(double number) const {
+    if (mProgram != nullptr && number == uprv_floor(number) && uprv_fabs(number) <= INT32_MAX) {
+        // An integer without fraction digits, like FixedDecimal(number).
+        return getChainKeyword(mRules, mProgram->selectInteger((int64_t)uprv_fabs(number)));
+    }
     return select(FixedDecimal(number));
 }
 
@@ -280,6 +317,9 @@ PluralRules::select(const IFixedDecimal &number) const {
     if (mRules == nullptr) {
         return UnicodeString(TRUE, PLURAL_DEFAULT_RULE, -1);
     }
+    else if (mProgram != nullptr) {
+        return getChainKeyword(mRules, mProgram->select(number));
+    }
     else {
         return mRules->select(number);
     }
@@ -672,6 +712,16 @@ PluralRuleParser::parse(const UnicodeString& ruleData, PluralRules *prules, UErr
             break;
         }
     }
+    if (U_SUCCESS(status) && prules->mRules != nullptr) {
+        // Rules that cannot be compiled are evaluated via the RuleChain.
+        UErrorCode programStatus = U_ZERO_ERROR;
+        LocalPointer<PluralRuleProgram> program(
+            new PluralRuleProgram(prules->mRules, programStatus), programStatus);
+        if (U_SUCCESS(programStatus)) {
+            delete prules->mProgram;
+            prules->mProgram = program.orphan();
+        }
+    }
 }
 
 UnicodeString
@@ -971,6 +1021,212 @@ RuleChain::select(const IFixedDecimal &number) const {
     return UnicodeString(TRUE, PLURAL_KEYWORD_OTHER, 5);
 }
 
+PluralRuleProgram::PluralRuleProgram(const RuleChain *rules, UErrorCode &errorCode)
+        : start(0), chainCount(0), instructionsLength(0), rangesLength(0) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    // Count the rule chains, constraints and range limits.
+    int32_t instructionsCapacity = 0;
+    int32_t rangesCapacity = 0;
+    for (const RuleChain *rc = rules; rc != nullptr; rc = rc->fNext) {
+        if (U_FAILURE(rc->fInternalStatus) || rc->ruleHeader == nullptr) {
+            errorCode = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        ++chainCount;
+        for (const OrConstraint *orRule = rc->ruleHeader; orRule != nullptr; orRule = orRule->next) {
+            for (const AndConstraint *andRule = orRule->childNode;
+                    andRule != nullptr; andRule = andRule->next) {
+                ++instructionsCapacity;
+                rangesCapacity += andRule->rangeList != nullptr ? andRule->rangeList->size() : 2;
+            }
+        }
+    }
+    // The chain index for "other" must fit into the smallIntegers table.
+    if (chainCount > 0xff) {
+        errorCode = U_UNSUPPORTED_ERROR;
+        return;
+    }
+    if (instructions.allocateInsteadAndReset(instructionsCapacity > 0 ? instructionsCapacity : 1) == nullptr ||
+            ranges.allocateInsteadAndReset(rangesCapacity > 0 ? rangesCapacity : 1) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    // Each OR branch becomes a sequence of instructions, one per AndConstraint.
+    // If an instruction fails, then the program continues with the next branch.
+    // The instructions of the previous branch wait for where that is.
+    int32_t prevStart = -1;
+    int32_t prevLimit = -1;
+    int32_t chainIndex = 0;
+    UBool isDone = FALSE;
+    for (const RuleChain *rc = rules; rc != nullptr && !isDone; rc = rc->fNext, ++chainIndex) {
+        for (const OrConstraint *orRule = rc->ruleHeader;
+                orRule != nullptr && !isDone; orRule = orRule->next) {
+            int32_t branchStart = instructionsLength;
+            for (const AndConstraint *andRule = orRule->childNode;
+                    andRule != nullptr; andRule = andRule->next) {
+                if (andRule->digitsType == none) {
+                    // An empty AndConstraint is always fulfilled.
+                    continue;
+                }
+                Instruction &ins = instructions[instructionsLength++];
+                ins.flags = 0;
+                if (andRule->negated) { ins.flags |= NEGATED; }
+                if (andRule->integerOnly) { ins.flags |= INTEGER_ONLY; }
+                if (andRule->op == AndConstraint::MOD) { ins.flags |= MOD; }
+                ins.operand = tokenTypeToPluralOperand(andRule->digitsType);
+                ins.modulus = andRule->opNum;
+                ins.rangeStart = rangesLength;
+                if (andRule->rangeList != nullptr) {
+                    for (int32_t r = 0; r < andRule->rangeList->size(); ++r) {
+                        ranges[rangesLength++] = andRule->rangeList->elementAti(r);
+                    }
+                } else if (andRule->value != -1) {
+                    // 'is' rule
+                    ranges[rangesLength++] = andRule->value;
+                    ranges[rangesLength++] = andRule->value;
+                } else {
+                    ins.flags |= EMPTY;
+                }
+                ins.rangeLimit = rangesLength;
+                ins.onTrue = instructionsLength;
+                ins.onFalse = -1;
+            }
+            int32_t entry;
+            if (branchStart < instructionsLength) {
+                instructions[instructionsLength - 1].onTrue = ~chainIndex;
+                entry = branchStart;
+            } else {
+                // This branch is always fulfilled, and no later one is ever reached.
+                entry = ~chainIndex;
+                isDone = TRUE;
+            }
+            if (prevStart < 0) {
+                start = entry;
+            } else {
+                for (int32_t i = prevStart; i < prevLimit; ++i) {
+                    instructions[i].onFalse = entry;
+                }
+            }
+            prevStart = branchStart;
+            prevLimit = instructionsLength;
+        }
+    }
+    if (!isDone) {
+        // No rule is fulfilled: Select "other".
+        if (prevStart < 0) {
+            start = ~chainCount;
+        } else {
+            for (int32_t i = prevStart; i < prevLimit; ++i) {
+                instructions[i].onFalse = ~chainCount;
+            }
+        }
+    }
+
+    for (int32_t i = 0; i < SMALL_INTEGERS_LIMIT; ++i) {
+        smallIntegers[i] = (uint8_t)evaluateInteger(i);
+    }
+}
+
+PluralRuleProgram::PluralRuleProgram(const PluralRuleProgram &other, UErrorCode &errorCode)
+        : start(other.start), chainCount(other.chainCount),
+          instructionsLength(other.instructionsLength), rangesLength(other.rangesLength) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (instructions.allocateInsteadAndReset(instructionsLength > 0 ? instructionsLength : 1) == nullptr ||
+            ranges.allocateInsteadAndReset(rangesLength > 0 ? rangesLength : 1) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    uprv_memcpy(instructions.getAlias(), other.instructions.getAlias(), instructionsLength * sizeof(Instruction));
+    uprv_memcpy(ranges.getAlias(), other.ranges.getAlias(), rangesLength * sizeof(int32_t));
+    uprv_memcpy(smallIntegers, other.smallIntegers, sizeof(smallIntegers));
+}
+
+UBool
+PluralRuleProgram::isInRanges(const Instruction &ins, double n) const {
+    for (int32_t r = ins.rangeStart; r < ins.rangeLimit; r += 2) {
+        if (ranges[r] <= n && n <= ranges[r + 1]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+UBool
+PluralRuleProgram::isInRanges(const Instruction &ins, int64_t n) const {
+    for (int32_t r = ins.rangeStart; r < ins.rangeLimit; r += 2) {
+        if (ranges[r] <= n && n <= ranges[r + 1]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+int32_t
+PluralRuleProgram::select(const IFixedDecimal &number) const {
+    if (number.isNaN() || number.isInfinite()) {
+        return chainCount;
+    }
+    double operands[PLURAL_OPERAND_J + 1];
+    uint32_t haveOperands = 0;
+    int32_t next = start;
+    while (next >= 0) {
+        const Instruction &ins = instructions[next];
+        uint32_t operandBit = (uint32_t)1 << ins.operand;
+        if ((haveOperands & operandBit) == 0) {
+            operands[ins.operand] = number.getPluralOperand(ins.operand);
+            haveOperands |= operandBit;
+        }
+        double n = operands[ins.operand];
+        UBool result;
+        if ((ins.flags & INTEGER_ONLY) != 0 && n != uprv_floor(n)) {
+            result = FALSE;
+        } else if ((ins.flags & EMPTY) != 0) {
+            result = TRUE;
+        } else {
+            if ((ins.flags & MOD) != 0) {
+                n = fmod(n, ins.modulus);
+            }
+            result = isInRanges(ins, n);
+        }
+        if ((ins.flags & NEGATED) != 0) {
+            result = !result;
+        }
+        next = result ? ins.onTrue : ins.onFalse;
+    }
+    return ~next;
+}
+
+int32_t
+PluralRuleProgram::evaluateInteger(int64_t number) const {
+    int32_t next = start;
+    while (next >= 0) {
+        const Instruction &ins = instructions[next];
+        // An integer has i = n and no fraction digits.
+        int64_t n = (ins.operand == PLURAL_OPERAND_N || ins.operand == PLURAL_OPERAND_I) ? number : 0;
+        UBool result;
+        if ((ins.flags & EMPTY) != 0) {
+            result = TRUE;
+        } else if ((ins.flags & MOD) != 0 && ins.modulus == 0) {
+            result = FALSE;  // fmod(n, 0) is NaN.
+        } else {
+            if ((ins.flags & MOD) != 0) {
+                n %= ins.modulus;
+            }
+            result = isInRanges(ins, n);
+        }
+        if ((ins.flags & NEGATED) != 0) {
+            result = !result;
+        }
+        next = result ? ins.onTrue : ins.onFalse;
+    }
+    return ~next;
+}
+
 static UnicodeString tokenString(tokenType tok) {
     UnicodeString s;
     switch (tok) {
@@ -26,6 +26,7 @@
 #include "unicode/parseerr.h"
 #include "unicode/strenum.h"
 #include "unicode/ures.h"
+#include "cmemory.h"
 #include "uvector.h"
 #include "hash.h"
 #include "uassert.h"
@@ -372,6 +373,79 @@ class RuleChain : public UMemory  {
     UBool         isKeyword(const UnicodeString& keyword) const;
 };
 
+/**
+ * The rule chains of a PluralRules object compiled into a flat program,
+ * for faster selection.
+ *
+ * Each instruction tests one AndConstraint and continues with another instruction
+ * or selects a keyword, depending on the result.
+ * Keywords are selected by their index in the list of rule chains;
+ * an index equal to the number of chains selects "other".
+ *
+ * Each plural operand of an IFixedDecimal is fetched at most once.
+ * Integers are evaluated without an IFixedDecimal, with a lookup table for 0..999.
+ */
+class PluralRuleProgram : public UMemory {
+public:
+    /**
+     * Compiles the rules. Sets U_UNSUPPORTED_ERROR if they cannot be compiled;
+     * then the caller should continue to use the RuleChain.
+     */
+    PluralRuleProgram(const RuleChain *rules, UErrorCode &errorCode);
+    PluralRuleProgram(const PluralRuleProgram &other, UErrorCode &errorCode);
+
+    /**
+     * @return the index of the selected rule chain, or the number of chains for "other"
+     */
+    int32_t select(const IFixedDecimal &number) const;
+
+    /**
+     * Same as select(FixedDecimal(number)) but faster.
+     * @param number a non-negative integer
+     */
+    int32_t selectInteger(int64_t number) const {
+        return number < SMALL_INTEGERS_LIMIT ? smallIntegers[number] : evaluateInteger(number);
+    }
+
+private:
+    PluralRuleProgram(const PluralRuleProgram &other) = delete;
+    PluralRuleProgram &operator=(const PluralRuleProgram &other) = delete;
+
+    enum {
+        NEGATED = 1,
+        INTEGER_ONLY = 2,
+        MOD = 4,
+        /** No value or ranges: The constraint is TRUE before negation. */
+        EMPTY = 8
+    };
+
+    static const int32_t SMALL_INTEGERS_LIMIT = 1000;
+
+    struct Instruction {
+        int32_t flags;
+        PluralOperand operand;
+        int32_t modulus;
+        /** [low, high] pairs in ranges[rangeStart..rangeLimit[ */
+        int32_t rangeStart;
+        int32_t rangeLimit;
+        /** Next instruction index, or ~chain index to select that keyword. */
+        int32_t onTrue;
+        int32_t onFalse;
+    };
+
+    UBool isInRanges(const Instruction &ins, double n) const;
+    UBool isInRanges(const Instruction &ins, int64_t n) const;
+    int32_t evaluateInteger(int64_t number) const;
+
+    int32_t start;
+    int32_t chainCount;
+    LocalMemory<Instruction> instructions;
+    int32_t instructionsLength;
+    LocalMemory<int32_t> ranges;
+    int32_t rangesLength;
+    uint8_t smallIntegers[SMALL_INTEGERS_LIMIT];
+};
+
 class PluralKeywordEnumeration : public StringEnumeration {
 public:
     PluralKeywordEnumeration(RuleChain *header, UErrorCode& status);
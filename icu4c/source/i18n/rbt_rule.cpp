@@ -245,6 +245,53 @@ UBool TransliterationRule::matchesIndexValue(uint8_t v) const {
     return (m != NULL) ? m->matchesIndexValue(v) : TRUE;
 }
 
+/**
+ * Internal method.  Returns the first code unit of the key, or of the
+ * post context if the key is empty, if that is a literal character.
+ * Returns -1 if it is a matcher, or if there is neither key nor post context.
+ */
+int32_t TransliterationRule::getFirstUnit() const {
+    if (anteContextLength == pattern.length()) {
+        return -1;
+    }
+    UChar c = pattern.charAt(anteContextLength);
+    return data->lookupMatcher(c) == NULL ? c : -1;
+}
+
+/**
+ * Internal method.  Returns true unless this rule cannot match text
+ * whose first code unit after the ante context is u.
+ * Both the key and post context matchers start with a forward
+ * match at pos.start < pos.limit, so a literal first character
+ * is compared with u, and a set without strings is tested with the
+ * code point there, which is u unless u is a surrogate.
+ */
+UBool TransliterationRule::mayMatchFirstUnit(UChar u) const {
+    if (anteContextLength == pattern.length()) {
+        return TRUE;
+    }
+    UChar c = pattern.charAt(anteContextLength);
+    if (data->lookupMatcher(c) == NULL) {
+        return c == u;
+    }
+    const UnicodeFunctor *f = data->lookup(c);
+    if (f == NULL || f->getDynamicClassID() != UnicodeSet::getStaticClassID() ||
+            U16_IS_SURROGATE(u)) {
+        return TRUE;
+    }
+    const UnicodeSet &set = *static_cast<const UnicodeSet *>(f);
+    if (set.contains(u)) {
+        return TRUE;
+    }
+    // The set might still match a string that starts with u.
+    int32_t codePointCount = 0;
+    int32_t rangeCount = set.getRangeCount();
+    for (int32_t i = 0; i < rangeCount; ++i) {
+        codePointCount += set.getRangeEnd(i) - set.getRangeStart(i) + 1;
+    }
+    return set.size() != codePointCount;
+}
+
 /**
  * Return true if this rule masks another rule.  If r1 masks r2 then
  * r1 matches any input string that r2 matches.  If r1 masks r2 and r2 masks
@@ -242,6 +242,26 @@ class TransliterationRule : public UMemory {
      */
     UBool matchesIndexValue(uint8_t v) const;
 
+    /**
+     * Internal method.  Returns the first code unit of the key, or of the
+     * post context if the key is empty, if that is a literal character.
+     * Returns -1 if it is a matcher, or if there is neither key nor post context.
+     * @return     the first literal code unit, or -1.
+     */
+    int32_t getFirstUnit() const;
+
+    /**
+     * Internal method.  Returns true unless this rule cannot match text
+     * whose first code unit after the ante context is u.  This is decided
+     * by the first character of the key, or of the post context if the
+     * key is empty.  A literal character must be equal to u, and a set of
+     * code points without strings must contain u.  Other matchers, and
+     * rules with only ante context, may match any text.
+     * @param u    the first code unit of the text at the start of the key.
+     * @return     false if this rule cannot match.
+     */
+    UBool mayMatchFirstUnit(UChar u) const;
+
     /**
      * Return true if this rule masks another rule.  If r1 masks r2 then
      * r1 matches any input string that r2 matches.  If r1 masks r2 and r2 masks
@@ -21,6 +21,7 @@
 #include "rbt_rule.h"
 #include "cmemory.h"
 #include "putilimp.h"
+#include "uvectr32.h"
 
 U_CDECL_BEGIN
 static void U_CALLCONV _deleteRule(void *rule) {
@@ -164,6 +165,9 @@ U_NAMESPACE_BEGIN
  * Construct a new empty rule set.
  */
 TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) : UMemory() {
+    dispatch = NULL;
+    candidates = NULL;
+    uprv_memset(dispatchIndex, 0, sizeof(dispatchIndex));
     ruleVector = new UVector(&_deleteRule, NULL, status);
     if (U_FAILURE(status)) {
         return;
@@ -182,10 +186,13 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(0),
     rules(0),
+    dispatch(0),
+    candidates(0),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
     uprv_memcpy(index, other.index, sizeof(index));
+    uprv_memset(dispatchIndex, 0, sizeof(dispatchIndex));
     UErrorCode status = U_ZERO_ERROR;
     ruleVector = new UVector(&_deleteRule, NULL, status);
     if (other.ruleVector != 0 && ruleVector != 0 && U_SUCCESS(status)) {
@@ -215,6 +222,8 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    uprv_free(dispatch);
+    uprv_free(candidates);
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -260,6 +269,11 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = 0;
+    uprv_free(dispatch);
+    dispatch = 0;
+    uprv_free(candidates);
+    candidates = 0;
+    uprv_memset(dispatchIndex, 0, sizeof(dispatchIndex));
 }
 
 /**
@@ -336,6 +350,11 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     /* Freeze things into an array.
      */
     uprv_free(rules); // Contains alias pointers
+    uprv_free(dispatch); // Contains alias pointers into the old rules
+    dispatch = NULL;
+    uprv_free(candidates);
+    candidates = NULL;
+    uprv_memset(dispatchIndex, 0, sizeof(dispatchIndex));
 
     /* You can't do malloc(0)! */
     if (v.size() == 0) {
@@ -386,6 +405,84 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     //if (errors != null) {
     //    throw new IllegalArgumentException(errors.toString());
     //}
+
+    compileDispatch(status);
+}
+
+/**
+ * Builds the dispatch table from rules[] and index[].
+ * Within each bin, the rules are further split by the first code
+ * unit of the text.  A rule whose first key character is a literal
+ * is a candidate only for that code unit.  A rule that starts with
+ * a set is a candidate for each code unit that the set may match,
+ * and for all code units that are not the first literal of any rule
+ * in the bin.  This avoids calling matchAndReplace() for rules that
+ * share only the low byte of the first character.
+ */
+void TransliterationRuleSet::compileDispatch(UErrorCode& status) {
+    UVector32 units(status);  // distinct first literal code units of one bin
+    UVector32 entries(status);  // unit, start, limit
+    UVector32 ruleIndexes(status);  // candidates as indexes into rules[]
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t j;
+    for (int32_t x=0; x<256; ++x) {
+        dispatchIndex[x] = entries.size() / 3;
+        units.removeAllElements();
+        for (j=index[x]; j<index[x+1]; ++j) {
+            int32_t u = rules[j]->getFirstUnit();
+            if (u >= 0 && !units.contains(u)) {
+                units.sortedInsert(u, status);
+            }
+        }
+        for (int32_t k=0; k<units.size(); ++k) {
+            UChar u = (UChar)units.elementAti(k);
+            entries.addElement(u, status);
+            entries.addElement(ruleIndexes.size(), status);
+            for (j=index[x]; j<index[x+1]; ++j) {
+                if (rules[j]->mayMatchFirstUnit(u)) {
+                    ruleIndexes.addElement(j, status);
+                }
+            }
+            entries.addElement(ruleIndexes.size(), status);
+        }
+        // All other code units: Only rules that do not start with a literal.
+        entries.addElement(0, status);
+        entries.addElement(ruleIndexes.size(), status);
+        for (j=index[x]; j<index[x+1]; ++j) {
+            if (rules[j]->getFirstUnit() < 0) {
+                ruleIndexes.addElement(j, status);
+            }
+        }
+        entries.addElement(ruleIndexes.size(), status);
+    }
+    dispatchIndex[256] = entries.size() / 3;
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    dispatch = (Dispatch *)uprv_malloc(dispatchIndex[256] * sizeof(Dispatch));
+    /* You can't do malloc(0)! */
+    candidates = (TransliterationRule **)uprv_malloc(
+        (ruleIndexes.size() > 0 ? ruleIndexes.size() : 1) * sizeof(TransliterationRule *));
+    if (dispatch == NULL || candidates == NULL) {
+        uprv_free(dispatch);
+        dispatch = NULL;
+        uprv_free(candidates);
+        candidates = NULL;
+        uprv_memset(dispatchIndex, 0, sizeof(dispatchIndex));
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (j=0; j<dispatchIndex[256]; ++j) {
+        dispatch[j].unit = (UChar)entries.elementAti(3*j);
+        dispatch[j].start = entries.elementAti(3*j+1);
+        dispatch[j].limit = entries.elementAti(3*j+2);
+    }
+    for (j=0; j<ruleIndexes.size(); ++j) {
+        candidates[j] = rules[ruleIndexes.elementAti(j)];
+    }
 }
 
 /**
@@ -404,22 +501,40 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = (int16_t) (text.char32At(pos.start) & 0xFF);
-    for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
-        UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
-        switch (m) {
-        case U_MATCH:
-            _debugOut("match", rules[i], text, pos);
-            return TRUE;
-        case U_PARTIAL_MATCH:
-            _debugOut("partial match", rules[i], text, pos);
-            return FALSE;
-        default: /* Ram: added default to make GCC happy */
-            break;
+    UChar32 c = text.char32At(pos.start);
+    if (dispatch != NULL) {
+        // Find the entry for the first code unit in the bin for the low byte
+        // of the first character; the last entry is for all other code units.
+        int16_t indexByte = (int16_t) (c & 0xFF);
+        UChar unit = text.charAt(pos.start);
+        int32_t other = dispatchIndex[indexByte+1] - 1;
+        int32_t start = dispatchIndex[indexByte];
+        int32_t limit = other;
+        while (start < limit) {
+            int32_t mid = (start + limit) / 2;
+            if (dispatch[mid].unit < unit) {
+                start = mid + 1;
+            } else {
+                limit = mid;
+            }
+        }
+        const Dispatch &d = dispatch[(start < other && dispatch[start].unit == unit) ? start : other];
+        for (int32_t i=d.start; i<d.limit; ++i) {
+            UMatchDegree m = candidates[i]->matchAndReplace(text, pos, incremental);
+            switch (m) {
+            case U_MATCH:
+                _debugOut("match", candidates[i], text, pos);
+                return TRUE;
+            case U_PARTIAL_MATCH:
+                _debugOut("partial match", candidates[i], text, pos);
+                return FALSE;
+            default: /* Ram: added default to make GCC happy */
+                break;
+            }
         }
     }
     // No match or partial match from any rule
-    pos.start += U16_LENGTH(text.char32At(pos.start));
+    pos.start += U16_LENGTH(c);
     _debugOut("no match", NULL, text, pos);
     return TRUE;
 }
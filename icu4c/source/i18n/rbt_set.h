@@ -58,6 +58,25 @@ class TransliterationRuleSet : public UMemory {
      */
     int32_t index[257];
 
+    /**
+     * Compiled dispatch table, created by freeze() from rules[].  For text
+     * whose first character c has x = c&0xFF, and whose first code unit is u,
+     * dispatch[dispatchIndex[x]..dispatchIndex[x+1]-1] contains one entry
+     * for each u that is the first literal character of a rule in bin x,
+     * sorted by u, followed by one entry for all other code units.  Each
+     * entry lists, in rule order, only those rules of the bin that can
+     * match text starting with its u, as candidates[start..limit-1].
+     * The candidates are alias pointers like rules[].
+     */
+    struct Dispatch {
+        UChar unit;
+        int32_t start;
+        int32_t limit;
+    };
+    Dispatch* dispatch;
+    TransliterationRule** candidates;
+    int32_t dispatchIndex[257];
+
     /**
      * Length of the longest preceding context
      */
@@ -157,6 +176,11 @@ class TransliterationRuleSet : public UMemory {
 
 private:
 
+    /**
+     * Builds the dispatch table from rules[] and index[].
+     */
+    void compileDispatch(UErrorCode& status);
+
     TransliterationRuleSet &operator=(const TransliterationRuleSet &other); // forbid copying of this class
 };
 
@@ -1083,6 +1083,84 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     }
 }
 
+UCollationResult
+RuleBasedCollator::internalCompareComparand(CollationComparand &comparand,
+                                            const UChar *target, int32_t targetLength,
+                                            UBool prefixOnly, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return UCOL_EQUAL; }
+    if(target == NULL ? targetLength != 0 : targetLength < -1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    if(targetLength < 0) { targetLength = u_strlen(target); }
+    const UChar *source = comparand.source.getBuffer();
+    int32_t sourceLength = comparand.source.length();
+
+    int32_t result = CollationFastLatin::BAIL_OUT_RESULT;
+    int32_t fastLatinOptions = settings->fastLatinOptions;
+    if(!prefixOnly && fastLatinOptions >= 0 &&
+            (targetLength == 0 || target[0] <= CollationFastLatin::LATIN_MAX) &&
+            (sourceLength == 0 || source[0] <= CollationFastLatin::LATIN_MAX)) {
+        // Comparing both strings with the fast Latin table is faster
+        // than reusing buffered CEs.
+        result = CollationFastLatin::compareUTF16(data->fastLatinTable,
+                                                  settings->fastLatinPrimaries,
+                                                  fastLatinOptions,
+                                                  target, targetLength,
+                                                  source, sourceLength);
+    }
+
+    UBool numeric = settings->isNumeric();
+    const UChar *targetLimit = target + targetLength;
+    if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        if(comparand.iter != NULL && comparand.options == settings->options &&
+                comparand.variableTop == settings->variableTop) {
+            comparand.iter->rewindCEs();
+        } else {
+            // First use, or the settings changed: Fetch the source CEs anew.
+            delete comparand.iter;
+            if(settings->dontCheckFCD()) {
+                comparand.iter = new UTF16CollationIterator(
+                    data, numeric, source, source, source + sourceLength);
+            } else {
+                comparand.iter = new FCDUTF16CollationIterator(
+                    data, numeric, source, source, source + sourceLength);
+            }
+            if(comparand.iter == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return UCOL_EQUAL;
+            }
+            comparand.options = settings->options;
+            comparand.variableTop = settings->variableTop;
+        }
+        if(settings->dontCheckFCD()) {
+            UTF16CollationIterator targetIter(data, numeric, target, target, targetLimit);
+            result = CollationCompare::compareUpToQuaternary(
+                targetIter, *comparand.iter, *settings, prefixOnly, errorCode);
+        } else {
+            FCDUTF16CollationIterator targetIter(data, numeric, target, target, targetLimit);
+            result = CollationCompare::compareUpToQuaternary(
+                targetIter, *comparand.iter, *settings, prefixOnly, errorCode);
+        }
+    }
+    if(result != UCOL_EQUAL || prefixOnly ||
+            settings->getStrength() < UCOL_IDENTICAL || U_FAILURE(errorCode)) {
+        return (UCollationResult)result;
+    }
+
+    // Compare identical level.
+    const Normalizer2Impl &nfcImpl = data->nfcImpl;
+    if(settings->dontCheckFCD()) {
+        UTF16NFDIterator targetIter(target, targetLimit);
+        UTF16NFDIterator sourceIter(source, source + sourceLength);
+        return compareNFDIter(nfcImpl, targetIter, sourceIter);
+    } else {
+        FCDUTF16NFDIterator targetIter(nfcImpl, target, targetLimit);
+        FCDUTF16NFDIterator sourceIter(nfcImpl, source, source + sourceLength);
+        return compareNFDIter(nfcImpl, targetIter, sourceIter);
+    }
+}
+
 UCollationResult
 RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
                              const uint8_t *right, int32_t rightLength,
@@ -1339,12 +1417,12 @@ RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
         UTF16CollationIterator iter(data, numeric, s, s, limit);
         CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
                                                   sink, Collation::PRIMARY_LEVEL,
-                                                  callback, TRUE, errorCode);
+                                                  callback, NULL, TRUE, errorCode);
     } else {
         FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
         CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
                                                   sink, Collation::PRIMARY_LEVEL,
-                                                  callback, TRUE, errorCode);
+                                                  callback, NULL, TRUE, errorCode);
     }
     if(settings->getStrength() == UCOL_IDENTICAL) {
         writeIdenticalLevel(s, limit, sink, errorCode);
@@ -1390,6 +1468,7 @@ namespace {
  *
  * When internalNextSortKeyPart() is called again, it restarts with the last level
  * and ignores as many bytes as were written previously for that level.
+ * (The primary level is normally resumed from the middle of the text instead.)
  */
 class PartLevelCallback : public CollationKeys::LevelCallback {
 public:
@@ -1417,6 +1496,148 @@ class PartLevelCallback : public CollationKeys::LevelCallback {
     int32_t levelCapacity;
 };
 
+/**
+ * Stops after the first level.
+ * Used when a level is written from the middle of the text,
+ * where the weights for the other levels would be incomplete.
+ */
+class PrimaryOnlyLevelCallback : public CollationKeys::LevelCallback {
+public:
+    virtual ~PrimaryOnlyLevelCallback() {}
+    virtual UBool needToWrite(Collation::Level /*level*/) { return FALSE; }
+};
+
+/*
+ * internalNextSortKeyPart() state.
+ *
+ * Normally, state[0] is the level to continue with,
+ * and state[1] is the number of bytes of that level that were returned already.
+ * The text is iterated from the start for every part.
+ *
+ * When a level was cut off, then the next part is usually continued from the last
+ * CollationKeys::ResumePoint, so that iteration need not start over:
+ * state[0] bits   2..0: the level
+ *          bit       3: PART_RESUME
+ *   primary level:
+ *          bits  15..4: number of bytes returned already from the resume point
+ *          bits 31..16: the resume point's prevReorderedPrimary
+ *   secondary, tertiary and quaternary levels:
+ *          bits  23..4: number of bytes returned already from the resume point
+ *          bits 30..24: the resume point's commonWeights
+ *          bit      31: the resume point's levelHasBytes
+ * state[1] is the resume point's text offset.
+ */
+const uint32_t PART_LEVEL_MASK = 7;
+const uint32_t PART_RESUME = 8;
+const int32_t PART_RESUME_SKIP_SHIFT = 4;
+const int32_t PART_MAX_PRIMARY_RESUME_SKIP = 0xfff;
+const int32_t PART_MAX_LEVEL_RESUME_SKIP = 0xfffff;
+const int32_t PART_COMMON_WEIGHTS_SHIFT = 24;
+const int32_t PART_COMMON_WEIGHTS_MASK = 0x7f;
+const uint32_t PART_LEVEL_HAS_BYTES = 0x80000000;
+
+/**
+ * @return TRUE if the level can be written starting from a ResumePoint
+ */
+UBool canResumeLevel(Collation::Level level, const CollationSettings &settings) {
+    switch(level) {
+    case Collation::PRIMARY_LEVEL:
+    case Collation::TERTIARY_LEVEL:
+    case Collation::QUATERNARY_LEVEL:
+        return TRUE;
+    case Collation::SECONDARY_LEVEL:
+        // Backward secondary weights are reversed within whole segments.
+        return (settings.options & CollationSettings::BACKWARD_SECONDARY) == 0;
+    default:
+        // The case level packs two weights into each byte.
+        return FALSE;
+    }
+}
+
+void initResumePoint(CollationKeys::ResumePoint &resumePoint, int32_t offset,
+                     int32_t remainingCapacity) {
+    resumePoint.offset = offset;
+    resumePoint.prevReorderedPrimary = 0;
+    resumePoint.commonWeights = 0;
+    resumePoint.levelHasBytes = FALSE;
+    resumePoint.remainingCapacity = remainingCapacity;
+}
+
+/**
+ * Sets the state for continuing the level from the resume point.
+ * @return FALSE if the state cannot represent the resume point
+ */
+UBool setResumeState(Collation::Level level, const CollationKeys::ResumePoint &resumePoint,
+                     uint32_t state[2]) {
+    if(resumePoint.offset < 0 || resumePoint.remainingCapacity < 0) { return FALSE; }
+    uint32_t s0 = (uint32_t)level | PART_RESUME |
+        ((uint32_t)resumePoint.remainingCapacity << PART_RESUME_SKIP_SHIFT);
+    if(level == Collation::PRIMARY_LEVEL) {
+        if(resumePoint.remainingCapacity > PART_MAX_PRIMARY_RESUME_SKIP) { return FALSE; }
+        s0 |= resumePoint.prevReorderedPrimary;
+    } else {
+        if(resumePoint.remainingCapacity > PART_MAX_LEVEL_RESUME_SKIP) { return FALSE; }
+        U_ASSERT(resumePoint.commonWeights <= PART_COMMON_WEIGHTS_MASK);
+        s0 |= (uint32_t)resumePoint.commonWeights << PART_COMMON_WEIGHTS_SHIFT;
+        if(resumePoint.levelHasBytes) { s0 |= PART_LEVEL_HAS_BYTES; }
+    }
+    state[0] = s0;
+    state[1] = (uint32_t)resumePoint.offset;
+    return TRUE;
+}
+
+/**
+ * Writes levels from the iterator's current index, which must be offset.
+ */
+void writeLevelsFrom(const CollationData *data, const CollationSettings &settings,
+                     UCharIterator &iter, int32_t offset, SortKeyByteSink &sink,
+                     Collation::Level level, CollationKeys::LevelCallback &callback,
+                     CollationKeys::ResumePoint *resumePoint, UErrorCode &errorCode) {
+    UBool numeric = settings.isNumeric();
+    if(settings.dontCheckFCD()) {
+        UIterCollationIterator ci(data, numeric, iter);
+        CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, settings,
+                                                  sink, level, callback, resumePoint,
+                                                  FALSE, errorCode);
+    } else {
+        FCDUIterCollationIterator ci(data, numeric, iter, offset);
+        CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, settings,
+                                                  sink, level, callback, resumePoint,
+                                                  FALSE, errorCode);
+    }
+}
+
+/**
+ * Returns the length of the level for the text before limit,
+ * which must be a ResumePoint offset.
+ * For a beyond-primary level, the length does not include the level separator.
+ * Needed only when a part ends too far from a resume point.
+ */
+int32_t levelLengthBefore(const CollationData *data, const CollationSettings &settings,
+                          UCharIterator *iter, Collation::Level level, int32_t limit,
+                          UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return 0; }
+    UnicodeString s;
+    iter->move(iter, 0, UITER_START);
+    while(iter->getIndex(iter, UITER_CURRENT) < limit) {
+        UChar32 c = iter->next(iter);
+        if(c < 0) { break; }
+        s.append((UChar)c);
+    }
+    UCharIterator prefixIter;
+    uiter_setString(&prefixIter, s.getBuffer(), s.length());
+    // Only count, and record the resume point at the end of the prefix.
+    char buffer[1];
+    FixedSortKeyByteSink sink(buffer, 0);
+    sink.IgnoreBytes(INT32_MAX);
+    CollationKeys::ResumePoint resumePoint;
+    initResumePoint(resumePoint, 0, INT32_MAX);
+    PrimaryOnlyLevelCallback callback;
+    writeLevelsFrom(data, settings, prefixIter, 0, sink, level, callback, &resumePoint, errorCode);
+    U_ASSERT(U_FAILURE(errorCode) || resumePoint.offset == s.length());
+    return INT32_MAX - resumePoint.remainingCapacity;
+}
+
 }  // namespace
 
 int32_t
@@ -1430,38 +1651,101 @@ RuleBasedCollator::internalNextSortKeyPart(UCharIterator *iter, uint32_t state[2
     if(count == 0) { return 0; }
 
     FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), count);
-    sink.IgnoreBytes((int32_t)state[1]);
-    iter->move(iter, 0, UITER_START);
-
-    Collation::Level level = (Collation::Level)state[0];
-    if(level <= Collation::QUATERNARY_LEVEL) {
-        UBool numeric = settings->isNumeric();
-        PartLevelCallback callback(sink);
-        if(settings->dontCheckFCD()) {
-            UIterCollationIterator ci(data, numeric, *iter);
-            CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
-                                                      sink, level, callback, FALSE, errorCode);
+    Collation::Level level = (Collation::Level)(state[0] & PART_LEVEL_MASK);
+    UBool writeNormalLevels = level <= Collation::QUATERNARY_LEVEL;
+    CollationKeys::ResumePoint resumePoint;
+    PrimaryOnlyLevelCallback levelOnlyCallback;
+
+    if((state[0] & PART_RESUME) != 0) {
+        // Continue the level from where the previous part left off.
+        int32_t offset = (int32_t)state[1];
+        int32_t skip;
+        initResumePoint(resumePoint, offset, 0);
+        if(level == Collation::PRIMARY_LEVEL) {
+            skip = (int32_t)(state[0] >> PART_RESUME_SKIP_SHIFT) & PART_MAX_PRIMARY_RESUME_SKIP;
+            resumePoint.prevReorderedPrimary = state[0] & 0xffff0000;
         } else {
-            FCDUIterCollationIterator ci(data, numeric, *iter, 0);
-            CollationKeys::writeSortKeyUpToQuaternary(ci, data->compressibleBytes, *settings,
-                                                      sink, level, callback, FALSE, errorCode);
+            skip = (int32_t)(state[0] >> PART_RESUME_SKIP_SHIFT) & PART_MAX_LEVEL_RESUME_SKIP;
+            resumePoint.commonWeights =
+                (int32_t)(state[0] >> PART_COMMON_WEIGHTS_SHIFT) & PART_COMMON_WEIGHTS_MASK;
+            resumePoint.levelHasBytes = (state[0] & PART_LEVEL_HAS_BYTES) != 0;
         }
+        // The starting point itself is a resume point.
+        resumePoint.remainingCapacity = skip + count;
+        sink.IgnoreBytes(skip);
+        iter->move(iter, offset, UITER_ZERO);
+        writeLevelsFrom(data, *settings, *iter, offset, sink, level, levelOnlyCallback,
+                        &resumePoint, errorCode);
         if(U_FAILURE(errorCode)) { return 0; }
         if(sink.NumberOfBytesAppended() > count) {
-            state[0] = (uint32_t)callback.getLevel();
-            state[1] = (uint32_t)callback.getLevelCapacity();
+            if(!setResumeState(level, resumePoint, state)) {
+                // There was no resume point near enough to the end of this part.
+                // Fall back to continuing from the start of the text.
+                int32_t length = levelLengthBefore(data, *settings, iter, level, offset, errorCode);
+                if(U_FAILURE(errorCode)) { return 0; }
+                if(level != Collation::PRIMARY_LEVEL) {
+                    ++length;  // level separator
+                }
+                state[0] = (uint32_t)level;
+                state[1] = (uint32_t)(length + skip + count);
+            }
             return count;
         }
+        // This level is done. Write the following ones, which need the whole text.
+        level = (Collation::Level)(level + 1);
+    } else {
+        sink.IgnoreBytes((int32_t)state[1]);
+        if(Collation::PRIMARY_LEVEL < level && level <= Collation::QUATERNARY_LEVEL &&
+                canResumeLevel(level, *settings)) {
+            // Write only this level, recording where the next part can continue.
+            sink.Append(Collation::LEVEL_SEPARATOR_BYTE);
+            initResumePoint(resumePoint, 0, sink.GetRemainingCapacity());
+            iter->move(iter, 0, UITER_START);
+            writeLevelsFrom(data, *settings, *iter, 0, sink, level, levelOnlyCallback,
+                            &resumePoint, errorCode);
+            if(U_FAILURE(errorCode)) { return 0; }
+            if(sink.NumberOfBytesAppended() > count) {
+                if(!setResumeState(level, resumePoint, state)) {
+                    state[0] = (uint32_t)level;
+                    state[1] += (uint32_t)count;
+                }
+                return count;
+            }
+            level = (Collation::Level)(level + 1);
+        }
+    }
+
+    if(writeNormalLevels) {
+        if(level <= Collation::QUATERNARY_LEVEL) {
+            iter->move(iter, 0, UITER_START);
+            PartLevelCallback callback(sink);
+            CollationKeys::ResumePoint *rp = NULL;
+            if(level <= Collation::PRIMARY_LEVEL) {
+                initResumePoint(resumePoint, 0, sink.GetRemainingCapacity());
+                rp = &resumePoint;
+            }
+            writeLevelsFrom(data, *settings, *iter, 0, sink, level, callback, rp, errorCode);
+            if(U_FAILURE(errorCode)) { return 0; }
+            if(sink.NumberOfBytesAppended() > count) {
+                if(rp == NULL || callback.getLevel() != Collation::PRIMARY_LEVEL ||
+                        !setResumeState(Collation::PRIMARY_LEVEL, resumePoint, state)) {
+                    state[0] = (uint32_t)callback.getLevel();
+                    state[1] = (uint32_t)callback.getLevelCapacity();
+                }
+                return count;
+            }
+        }
         // All of the normal levels are done.
         if(settings->getStrength() == UCOL_IDENTICAL) {
             level = Collation::IDENTICAL_LEVEL;
-            iter->move(iter, 0, UITER_START);
+        } else {
+            level = Collation::ZERO_LEVEL;
         }
-        // else fall through to setting ZERO_LEVEL
     }
 
     if(level == Collation::IDENTICAL_LEVEL) {
         int32_t levelCapacity = sink.GetRemainingCapacity();
+        iter->move(iter, 0, UITER_START);
         UnicodeString s;
         for(;;) {
             UChar32 c = iter->next(iter);
@@ -0,0 +1,183 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// transbuf.cpp
+// created: 2020feb17
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/rep.h"
+#include "unicode/unistr.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "transbuf.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_BEGIN
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(TransliterationBuffer)
+
+TransliterationBuffer::TransliterationBuffer(const UChar *text, int32_t length)
+        : buffer(nullptr), capacity(0), gapStart(0), gapLimit(0), memoryError(FALSE) {
+    // Leave some room for replacements that lengthen the text.
+    int32_t newCapacity = length <= (INT32_MAX - 16) / 2 ? length + length / 4 + 16 : length;
+    buffer = (UChar *)uprv_malloc((newCapacity > 0 ? newCapacity : 1) * U_SIZEOF_UCHAR);
+    if (buffer == nullptr) {
+        memoryError = TRUE;
+        return;
+    }
+    capacity = newCapacity;
+    // Transliteration starts at the beginning of the text: Put the gap there.
+    gapLimit = capacity - length;
+    u_memcpy(buffer + gapLimit, text, length);
+}
+
+TransliterationBuffer::~TransliterationBuffer() {
+    uprv_free(buffer);
+}
+
+int32_t TransliterationBuffer::extract(UChar *dest, int32_t destCapacity, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if (memoryError) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t length = getLength();
+    if (length <= destCapacity) {
+        u_memcpy(dest, buffer, gapStart);
+        u_memcpy(dest + gapStart, buffer + gapLimit, length - gapStart);
+    }
+    return u_terminateUChars(dest, destCapacity, length, &errorCode);
+}
+
+void TransliterationBuffer::extractBetween(int32_t start, int32_t limit,
+                                           UnicodeString &target) const {
+    int32_t length = getLength();
+    if (start < 0) { start = 0; }
+    if (limit > length) { limit = length; }
+    target.remove();
+    if (start < gapStart) {
+        target.append(buffer + start, (limit < gapStart ? limit : gapStart) - start);
+    }
+    if (gapStart < limit) {
+        int32_t s = start > gapStart ? start : gapStart;
+        target.append(buffer + s + (gapLimit - gapStart), limit - s);
+    }
+}
+
+void TransliterationBuffer::handleReplaceBetween(int32_t start, int32_t limit,
+                                                 const UnicodeString &text) {
+    if (memoryError) {
+        return;
+    }
+    int32_t length = getLength();
+    if (start < 0) { start = 0; }
+    if (limit > length) { limit = length; }
+    if (start > limit) { start = limit; }
+    // Remove [start..limit[ by making it part of the gap.
+    if (gapStart < start) {
+        moveGap(start);
+        gapLimit += limit - start;
+    } else if (limit < gapStart) {
+        moveGap(limit);
+        gapStart = start;
+    } else {
+        gapLimit += limit - gapStart;
+        gapStart = start;
+    }
+    int32_t textLength = text.length();
+    if ((gapLimit - gapStart) < textLength && !ensureGap(textLength)) {
+        return;
+    }
+    text.extract(0, textLength, buffer + gapStart);
+    gapStart += textLength;
+}
+
+void TransliterationBuffer::copy(int32_t start, int32_t limit, int32_t dest) {
+    UnicodeString text;
+    extractBetween(start, limit, text);
+    handleReplaceBetween(dest, dest, text);
+}
+
+UBool TransliterationBuffer::hasMetaData() const {
+    return FALSE;
+}
+
+int32_t TransliterationBuffer::getLength() const {
+    return capacity - (gapLimit - gapStart);
+}
+
+UChar TransliterationBuffer::getCharAt(int32_t offset) const {
+    if (offset < gapStart) {
+        return offset >= 0 ? buffer[offset] : (UChar)0xffff;
+    }
+    offset += gapLimit - gapStart;
+    return offset < capacity ? buffer[offset] : (UChar)0xffff;
+}
+
+UChar32 TransliterationBuffer::getChar32At(int32_t offset) const {
+    UChar c = getCharAt(offset);
+    UChar c2;
+    if (U16_IS_LEAD(c)) {
+        if (U16_IS_TRAIL(c2 = getCharAt(offset + 1))) {
+            return U16_GET_SUPPLEMENTARY(c, c2);
+        }
+    } else if (U16_IS_TRAIL(c)) {
+        if (offset > 0 && U16_IS_LEAD(c2 = getCharAt(offset - 1))) {
+            return U16_GET_SUPPLEMENTARY(c2, c);
+        }
+    }
+    return c;
+}
+
+void TransliterationBuffer::moveGap(int32_t index) {
+    if (index < gapStart) {
+        int32_t n = gapStart - index;
+        u_memmove(buffer + gapLimit - n, buffer + index, n);
+        gapStart = index;
+        gapLimit -= n;
+    } else if (index > gapStart) {
+        int32_t n = index - gapStart;
+        u_memmove(buffer + gapStart, buffer + gapLimit, n);
+        gapStart = index;
+        gapLimit += n;
+    }
+}
+
+UBool TransliterationBuffer::ensureGap(int32_t gapLength) {
+    int32_t length = getLength();
+    if (gapLength > INT32_MAX - 16 - length) {
+        memoryError = TRUE;
+        return FALSE;
+    }
+    int32_t newCapacity = capacity <= INT32_MAX / 2 ? 2 * capacity : INT32_MAX;
+    if (newCapacity < (length + gapLength + 16)) {
+        newCapacity = length + gapLength + 16;
+    }
+    UChar *newBuffer = (UChar *)uprv_malloc(newCapacity * U_SIZEOF_UCHAR);
+    if (newBuffer == nullptr) {
+        memoryError = TRUE;
+        return FALSE;
+    }
+    int32_t tailLength = capacity - gapLimit;
+    u_memcpy(newBuffer, buffer, gapStart);
+    u_memcpy(newBuffer + newCapacity - tailLength, buffer + gapLimit, tailLength);
+    uprv_free(buffer);
+    buffer = newBuffer;
+    capacity = newCapacity;
+    gapLimit = newCapacity - tailLength;
+    return TRUE;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
@@ -0,0 +1,90 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// transbuf.h
+// created: 2020feb17
+
+#ifndef TRANSBUF_H
+#define TRANSBUF_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/rep.h"
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * A Replaceable text buffer without metadata, for transliterating plain
+ * UChar strings.
+ *
+ * The text is stored with a gap at the position of the last replacement.
+ * Transliterators work from the start of the text towards its end,
+ * and each replacement is near the previous one, so moving the gap costs
+ * little. A UnicodeString instead moves the whole rest of the text for
+ * every replacement that changes the length, which is quadratic for long
+ * texts with many such replacements.
+ * Each pass of a compound transliterator moves the gap through the text
+ * once, like copying it between two buffers.
+ *
+ * If memory allocation fails, then further replacements are ignored,
+ * and extract() sets U_MEMORY_ALLOCATION_ERROR.
+ */
+class TransliterationBuffer : public Replaceable {
+public:
+    /**
+     * Copies the text into the buffer, with the gap at the start.
+     */
+    TransliterationBuffer(const UChar *text, int32_t length);
+
+    virtual ~TransliterationBuffer();
+
+    /**
+     * Copies the text into dest, NUL-terminated if there is room.
+     * @return the text length
+     */
+    int32_t extract(UChar *dest, int32_t capacity, UErrorCode &errorCode) const;
+
+    virtual void extractBetween(int32_t start, int32_t limit, UnicodeString &target) const;
+
+    virtual void handleReplaceBetween(int32_t start, int32_t limit, const UnicodeString &text);
+
+    virtual void copy(int32_t start, int32_t limit, int32_t dest);
+
+    virtual UBool hasMetaData() const;
+
+    static UClassID U_EXPORT2 getStaticClassID();
+
+    virtual UClassID getDynamicClassID() const;
+
+protected:
+    virtual int32_t getLength() const;
+
+    virtual UChar getCharAt(int32_t offset) const;
+
+    virtual UChar32 getChar32At(int32_t offset) const;
+
+private:
+    TransliterationBuffer(const TransliterationBuffer &other) = delete;
+    TransliterationBuffer &operator=(const TransliterationBuffer &other) = delete;
+
+    /** Moves the gap so that it starts at the text index. */
+    void moveGap(int32_t index);
+    /** Grows the buffer so that the gap has at least the given length. */
+    UBool ensureGap(int32_t gapLength);
+
+    UChar *buffer;
+    int32_t capacity;
+    /** Text [0..gapStart[ is at buffer[0..gapStart[. */
+    int32_t gapStart;
+    /** Text [gapStart..length[ is at buffer[gapLimit..capacity[. */
+    int32_t gapLimit;
+    UBool memoryError;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
+#endif  // TRANSBUF_H
@@ -25,6 +25,7 @@
 #include "unicode/unifilt.h"
 #include "unicode/uniset.h"
 #include "unicode/uscript.h"
+#include "unicode/ustring.h"
 #include "unicode/strenum.h"
 #include "unicode/utf16.h"
 #include "cpdtrans.h"
@@ -43,6 +44,7 @@
 #include "brktrans.h"
 #include "esctrn.h"
 #include "unesctrn.h"
+#include "transbuf.h"
 #include "tridpars.h"
 #include "anytrans.h"
 #include "util.h"
@@ -213,6 +215,32 @@ void Transliterator::transliterate(Replaceable& text) const {
     transliterate(text, 0, text.length());
 }
 
+int32_t Transliterator::transliterate(const char16_t *src, int32_t srcLength,
+                                      char16_t *dest, int32_t destCapacity,
+                                      UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return 0;
+    }
+    if ((src == NULL && srcLength != 0) || srcLength < -1 ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (srcLength < 0) {
+        srcLength = u_strlen(src);
+    }
+    // The source and destination buffers must not overlap.
+    if (dest != NULL &&
+            ((src >= dest && src < (dest + destCapacity)) ||
+             (dest >= src && dest < (src + srcLength)))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    TransliterationBuffer text(src, srcLength);
+    transliterate(text, 0, srcLength);
+    return text.extract(dest, destCapacity, errorCode);
+}
+
 /**
  * Transliterates the portion of the text buffer that can be
  * transliterated unambiguosly after new text has been inserted,
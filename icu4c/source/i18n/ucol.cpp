@@ -31,6 +31,8 @@
 #include "unicode/ustring.h"
 #include "cmemory.h"
 #include "collation.h"
+#include "collationcompare.h"
+#include "collationsort.h"
 #include "cstring.h"
 #include "putilimp.h"
 #include "uassert.h"
@@ -487,6 +489,95 @@ ucol_strcollUTF8(
 }
 
 
+U_CAPI UCollationComparand * U_EXPORT2
+ucol_openComparand(const UCollator *coll,
+                   const UChar *source, int32_t sourceLength,
+                   UErrorCode *status) {
+    if(U_FAILURE(*status)) { return NULL; }
+    if(coll == NULL || (source == NULL ? sourceLength != 0 : sourceLength < -1)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc == NULL) {
+        *status = U_UNSUPPORTED_ERROR;
+        return NULL;
+    }
+    LocalPointer<CollationComparand> comparand(
+        new CollationComparand(*rbc, source, sourceLength), *status);
+    if(U_FAILURE(*status)) { return NULL; }
+    if(comparand->source.isBogus()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    return reinterpret_cast<UCollationComparand *>(comparand.orphan());
+}
+
+U_CAPI void U_EXPORT2
+ucol_closeComparand(UCollationComparand *comparand) {
+    delete reinterpret_cast<CollationComparand *>(comparand);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_strcollComparand(UCollationComparand *comparand,
+                      const UChar *target, int32_t targetLength,
+                      UErrorCode *status) {
+    if(U_FAILURE(*status)) { return UCOL_EQUAL; }
+    if(comparand == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    CollationComparand *c = reinterpret_cast<CollationComparand *>(comparand);
+    return c->collator.internalCompareComparand(*c, target, targetLength, FALSE, *status);
+}
+
+U_CAPI UCollationResult U_EXPORT2
+ucol_strcollComparandPrefix(UCollationComparand *comparand,
+                            const UChar *target, int32_t targetLength,
+                            UErrorCode *status) {
+    if(U_FAILURE(*status)) { return UCOL_EQUAL; }
+    if(comparand == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return UCOL_EQUAL;
+    }
+    CollationComparand *c = reinterpret_cast<CollationComparand *>(comparand);
+    return c->collator.internalCompareComparand(*c, target, targetLength, TRUE, *status);
+}
+
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings, int32_t *lengths, int32_t count,
+                 UCollationExecutor *executor, void *executorContext,
+                 UErrorCode *status) {
+    if(U_FAILURE(*status)) { return; }
+    if(coll == NULL || count < 0 || (count > 0 && strings == NULL)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    MaybeStackArray<int32_t, 64> indexes(count);
+    MaybeStackArray<const UChar *, 64> sortedStrings(count);
+    if(indexes.getCapacity() < count || sortedStrings.getCapacity() < count) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    CollationSort::sortIndexes(*Collator::fromUCollator(coll), strings, lengths, count,
+                               executor, executorContext, indexes.getAlias(), *status);
+    if(U_FAILURE(*status)) { return; }
+    for(int32_t i = 0; i < count; ++i) {
+        sortedStrings[i] = strings[indexes[i]];
+    }
+    uprv_memcpy(strings, sortedStrings.getAlias(), (size_t)count * sizeof(strings[0]));
+    if(lengths != NULL) {
+        // Reuse the indexes array for the sorted lengths.
+        for(int32_t i = 0; i < count; ++i) {
+            indexes[i] = lengths[indexes[i]];
+        }
+        uprv_memcpy(lengths, indexes.getAlias(), (size_t)count * sizeof(lengths[0]));
+    }
+}
+
+
 /* convenience function for comparing strings */
 U_CAPI UBool U_EXPORT2
 ucol_greater(    const    UCollator        *coll,
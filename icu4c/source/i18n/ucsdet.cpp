@@ -62,6 +62,21 @@ ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCo
     ((CharsetDetector *) ucsd)->setText(textIn, len);
 }
 
+U_CAPI UBool U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return FALSE;
+    }
+
+    if (len < -1 || (textIn == NULL && len != 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return FALSE;
+    }
+
+    return ((CharsetDetector *) ucsd)->appendText(textIn, len, *status);
+}
+
 U_CAPI const char * U_EXPORT2
 ucsdet_getName(const UCharsetMatch *ucsm, UErrorCode *status)
 {
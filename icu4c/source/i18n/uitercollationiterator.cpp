@@ -41,6 +41,11 @@ UIterCollationIterator::getOffset() const {
     return iter.getIndex(&iter, UITER_CURRENT);
 }
 
+UBool
+UIterCollationIterator::canResumeAtOffset() const {
+    return TRUE;
+}
+
 uint32_t
 UIterCollationIterator::handleNextCE32(UChar32 &c, UErrorCode & /*errorCode*/) {
     c = iter.next(&iter);
@@ -105,6 +110,16 @@ FCDUIterCollationIterator::getOffset() const {
     }
 }
 
+UBool
+FCDUIterCollationIterator::canResumeAtOffset() const {
+    // Forward FCD checking does not look back before the current index.
+    // Inside a segment, restarting could check or normalize the text differently,
+    // but at the end of a forward segment the iterator is at its limit.
+    return state == ITER_CHECK_FWD ||
+        (state == ITER_IN_FCD_SEGMENT && pos == limit) ||
+        (state == IN_NORM_ITER_AT_LIMIT && pos == normalized.length());
+}
+
 uint32_t
 FCDUIterCollationIterator::handleNextCE32(UChar32 &c, UErrorCode &errorCode) {
     for(;;) {
@@ -43,6 +43,8 @@ class U_I18N_API UIterCollationIterator : public CollationIterator {
 
     virtual int32_t getOffset() const;
 
+    virtual UBool canResumeAtOffset() const;
+
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
 
     virtual UChar32 previousCodePoint(UErrorCode &errorCode);
@@ -75,6 +77,8 @@ class U_I18N_API FCDUIterCollationIterator : public UIterCollationIterator {
 
     virtual int32_t getOffset() const;
 
+    virtual UBool canResumeAtOffset() const;
+
     virtual UChar32 nextCodePoint(UErrorCode &errorCode);
 
     virtual UChar32 previousCodePoint(UErrorCode &errorCode);
@@ -1041,6 +1041,32 @@ class U_I18N_API Collator : public UObject {
     virtual int32_t getSortKey(const char16_t*source, int32_t sourceLength,
                                uint8_t*result, int32_t resultLength) const = 0;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Sorts an array of strings according to this collator.
+     * The sort is stable: Strings that compare equal keep their relative order.
+     *
+     * Long arrays are sorted via sort keys, and the work is split into tasks
+     * which are run via the executor, if one is provided.
+     * This collator must not be modified while the strings are sorted.
+     *
+     * @param strings the array of strings to be sorted in place
+     * @param count the number of strings
+     * @param executor runs the sorting tasks, for example on a thread pool;
+     *                 if NULL, then they are run on the calling thread
+     * @param executorContext passed through to the executor
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @see ucol_sortStrings
+     * @draft ICU 67
+     */
+    void sort(UnicodeString *strings, int32_t count,
+              UCollationExecutor *executor, void *executorContext,
+              UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Produce a bound for a given sortkey and a number of levels.
      * Return value is always the number of bytes needed, regardless of
@@ -2116,6 +2116,36 @@ class U_I18N_API DecimalFormat : public NumberFormat {
     const number::LocalizedNumberFormatter* toNumberFormatter(UErrorCode& status) const;
 #endif  /* U_HIDE_DRAFT_API */
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Freezes this DecimalFormat (makes it immutable), so that a single instance
+     * can be shared by several threads rather than cloned for each of them.
+     *
+     * Freezing does the work that would otherwise be done lazily by the first calls
+     * to the const methods: It compiles the number formatter and builds the parsers.
+     * After that, format() and parse() on a frozen DecimalFormat do not modify it
+     * and may be called concurrently without any locking.
+     *
+     * A frozen DecimalFormat cannot be thawed. Its setters have no effect;
+     * the ones that take a UErrorCode set U_NO_WRITE_PERMISSION.
+     * A copy or clone of a frozen DecimalFormat is not frozen.
+     *
+     * @param status Set on failure, like U_MEMORY_ALLOCATION_ERROR.
+     * @see isFrozen
+     * @draft ICU 67
+     */
+    void freeze(UErrorCode& status);
+
+    /**
+     * Returns whether this DecimalFormat has been frozen.
+     *
+     * @return TRUE if freeze() has been called successfully.
+     * @see freeze
+     * @draft ICU 67
+     */
+    UBool isFrozen() const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Return the class ID for this class.  This is useful only for
      * comparing to a return value from getDynamicClassID().  For example:
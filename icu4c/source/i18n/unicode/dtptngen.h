@@ -67,6 +67,10 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
 
     /**
      * Construct a flexible generator according to data for a given locale.
+     *
+     * Starting with ICU 67, the locale data is loaded only once per locale and
+     * then shared: This returns a copy of a cached generator for the locale.
+     *
      * @param uLocale
      * @param status  Output param set to success/failure code on exit,
      *               which must not indicate a failure before the function call.
@@ -77,7 +81,8 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
 #ifndef U_HIDE_INTERNAL_API
 
     /**
-     * For ICU use only
+     * For ICU use only.
+     * Loads a new generator from the locale data, bypassing the cache used by createInstance().
      *
      * @internal
      */
@@ -551,6 +556,9 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     UnicodeString decimal;
     DateTimeMatcher *skipMatcher;
     Hashtable *fAvailableFormatKeyHash;
+    // Memo of getBestPattern() results, keyed by the options (as the first char) and the skeleton.
+    // Cleared by all setters that can change the results.
+    Hashtable *fBestPatterns;
     UnicodeString emptyString;
     char16_t fDefaultHourFormatChar;
 
@@ -594,6 +602,8 @@ class U_I18N_API DateTimePatternGenerator : public UObject {
     void setAvailableFormat(const UnicodeString &key, UErrorCode& status);
     UBool isAvailableFormatSet(const UnicodeString &key) const;
     void copyHashtable(Hashtable *other, UErrorCode &status);
+    UnicodeString computeBestPattern(const UnicodeString& patternForm, UDateTimePatternMatchOptions options, UErrorCode& status);
+    void clearBestPatterns();
     UBool isCanonicalItem(const UnicodeString& item) const;
     static void U_CALLCONV loadAllowedHourFormatsData(UErrorCode &status);
     void getAllowedHourFormats(const Locale &locale, UErrorCode &status);
@@ -43,9 +43,12 @@ struct UHashtable;
 typedef struct UHashtable UHashtable; /**< @internal */
 U_CDECL_END
 
+class TestMessageFormat;
+
 U_NAMESPACE_BEGIN
 
 class AppendableWrapper;
+class MessageFormatPlan;
 class DateFormat;
 class NumberFormat;
 
@@ -824,6 +827,37 @@ class U_I18N_API MessageFormat : public Format {
      */
     UBool usesNamedArguments() const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Freezes this MessageFormat (makes it immutable), so that a single instance
+     * can be shared by several threads rather than cloned for each of them.
+     *
+     * Freezing builds everything that the formatting methods would otherwise
+     * create on first use: the compiled pattern, the default number and date formats,
+     * the plural rules, and the compiled number formatters of DecimalFormat arguments,
+     * which are frozen as well. After that, format() and parse() on a frozen
+     * MessageFormat do not modify it and may be called concurrently without any locking.
+     *
+     * A frozen MessageFormat cannot be thawed. Its setters have no effect;
+     * the ones that take a UErrorCode set U_NO_WRITE_PERMISSION.
+     * A copy or clone of a frozen MessageFormat is not frozen.
+     *
+     * @param status Input/output error code.
+     * @see isFrozen
+     * @draft ICU 67
+     */
+    void freeze(UErrorCode& status);
+
+    /**
+     * Returns whether this MessageFormat has been frozen.
+     *
+     * @return TRUE if freeze() has been called successfully.
+     * @see freeze
+     * @draft ICU 67
+     */
+    UBool isFrozen() const;
+#endif  /* U_HIDE_DRAFT_API */
+
 
 #ifndef U_HIDE_INTERNAL_API
     /**
@@ -900,6 +934,8 @@ class U_I18N_API MessageFormat : public Format {
         virtual ~PluralSelectorProvider();
         virtual UnicodeString select(void *ctx, double number, UErrorCode& ec) const;
 
+        /** Loads the plural rules if they have not been loaded yet. */
+        void loadRules(UErrorCode& ec);
         void reset();
     private:
         const MessageFormat &msgFormat;
@@ -942,6 +978,15 @@ class U_I18N_API MessageFormat : public Format {
     UHashtable* cachedFormatters;
     UHashtable* customFormatArgStarts;
 
+    /**
+     * The pattern and formatters compiled for format().
+     * Built on demand, and deleted when either of them changes.
+     */
+    MessageFormatPlan* plan;
+
+    /** TRUE after freeze(). */
+    UBool frozen;
+
     PluralSelectorProvider pluralProvider;
     PluralSelectorProvider ordinalProvider;
 
@@ -999,6 +1044,58 @@ class U_I18N_API MessageFormat : public Format {
                 FieldPosition* pos,
                 UErrorCode& success) const;
 
+    /**
+     * Same as the format(msgStart, ...) variant but walks the msgPattern
+     * instead of running the compiled plan.
+     */
+    void formatPattern(int32_t msgStart,
+                       const void *plNumber,
+                       const Formattable* arguments,
+                       const UnicodeString *argumentNames,
+                       int32_t cnt,
+                       AppendableWrapper& appendTo,
+                       FieldPosition* pos,
+                       UErrorCode& success) const;
+
+    /**
+     * Same as the format(arguments, ...) variant but walks the msgPattern
+     * instead of running the compiled plan. For testing the plan.
+     */
+    UnicodeString& formatWithoutPlan(const Formattable* arguments,
+                                     const UnicodeString *argumentNames,
+                                     int32_t cnt,
+                                     UnicodeString& appendTo,
+                                     UErrorCode& status) const;
+
+    /**
+     * Returns the compiled plan, building it on demand, or NULL if there is
+     * none for this pattern (for example in JDK apostrophe mode).
+     * Semantically const, but may modify *this.
+     */
+    const MessageFormatPlan* getPlan() const;
+
+    /**
+     * Appends the ops for the message starting at msgStart to the plan,
+     * followed by those of its sub-messages.
+     * @return the index of the first op of the message
+     */
+    int32_t compileMessage(MessageFormatPlan& plan, int32_t msgStart, UErrorCode& errorCode) const;
+
+    /**
+     * Same as the format(msgStart, ...) variant but runs the compiled plan
+     * from the op at opIndex.
+     */
+    void format(const MessageFormatPlan& plan,
+                int32_t opIndex,
+                const void *plNumber,
+                const Formattable* arguments,
+                const UnicodeString *argumentNames,
+                int32_t cnt,
+                AppendableWrapper& appendTo,
+                UErrorCode& success) const;
+
+    void clearPlan();
+
     UnicodeString getArgName(int32_t partIndex);
 
     void setArgStartFormat(int32_t argStart, Format* formatter, UErrorCode& status);
@@ -1107,6 +1204,7 @@ class U_I18N_API MessageFormat : public Format {
     };
 
     friend class MessageFormatAdapter; // getFormatTypeList() access
+    friend class ::TestMessageFormat;  // formatWithoutPlan() access
 };
 
 U_NAMESPACE_END
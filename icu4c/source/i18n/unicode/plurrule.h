@@ -42,12 +42,15 @@
  */
 #define UPLRULES_NO_UNIQUE_VALUE ((double)-0.00123456777)
 
+class PluralRulesTest;
+
 U_NAMESPACE_BEGIN
 
 class Hashtable;
 class IFixedDecimal;
 class RuleChain;
 class PluralRuleParser;
+class PluralRuleProgram;
 class PluralKeywordEnumeration;
 class AndConstraint;
 class SharedPluralRules;
@@ -515,6 +518,7 @@ class U_I18N_API PluralRules : public UObject {
 
 private:
     RuleChain  *mRules;
+    PluralRuleProgram *mProgram;
 
     PluralRules();   // default constructor not implemented
     void            parseDescription(const UnicodeString& ruleData, UErrorCode &status);
@@ -529,6 +533,7 @@ class U_I18N_API PluralRules : public UObject {
     UErrorCode mInternalStatus;
 
     friend class PluralRuleParser;
+    friend class ::PluralRulesTest;  // compares mProgram with mRules
 };
 
 U_NAMESPACE_END
@@ -79,6 +79,7 @@ struct CollationCacheEntry;
 struct CollationData;
 struct CollationSettings;
 struct CollationTailoring;
+class CollationComparand;
 /**
 * @stable ICU 2.0
 */
@@ -796,6 +797,16 @@ class U_I18N_API RuleBasedCollator : public Collator {
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_strcollComparand() and ucol_strcollComparandPrefix().
+     * Compares the target string with the comparand's string.
+     * @internal
+     */
+    UCollationResult internalCompareComparand(
+            CollationComparand &comparand,
+            const char16_t *target, int32_t targetLength,
+            UBool prefixOnly, UErrorCode &errorCode) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
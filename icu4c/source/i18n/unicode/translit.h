@@ -651,6 +651,33 @@ class U_I18N_API Transliterator : public UObject {
      */
     virtual void transliterate(Replaceable& text) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Transliterates a string from a source buffer into a destination buffer.
+     * This is faster than transliterating a UnicodeString in place when the text
+     * is long and many replacements change its length.
+     *
+     * The result is NUL-terminated if there is room.
+     * If destCapacity is too small, then U_BUFFER_OVERFLOW_ERROR is set
+     * and the full length of the result is returned (preflighting).
+     * The source and destination buffers must not overlap.
+     *
+     * @param src       the string to be transliterated
+     * @param srcLength the length of src, or -1 if it is NUL-terminated
+     * @param dest      destination buffer; can be NULL if destCapacity==0
+     * @param destCapacity the number of char16_t units available at dest
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return the length of the transliterated string
+     * @draft ICU 67
+     */
+    int32_t transliterate(const char16_t *src, int32_t srcLength,
+                          char16_t *dest, int32_t destCapacity,
+                          UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Transliterates the portion of the text buffer that can be
      * transliterated unambiguosly after new text has been inserted,
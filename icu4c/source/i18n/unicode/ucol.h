@@ -667,6 +667,169 @@ ucol_strcollIter(  const    UCollator    *coll,
                   UCharIterator *tIter,
                   UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * A string prepared for comparing it with many other strings,
+ * for example a search key that is compared with the strings in a sorted list.
+ * @draft ICU 67
+ */
+typedef struct UCollationComparand UCollationComparand;
+
+/**
+ * Opens a comparand for repeated comparisons of the source string with other strings.
+ * The collation elements of the source string are computed once and reused
+ * in each comparison, so that only those of the other string need to be computed.
+ * The string is copied.
+ *
+ * The collator must not be closed while the comparand is in use.
+ * A comparand must not be used concurrently in multiple threads.
+ *
+ * @param coll The UCollator containing the comparison rules.
+ * @param source The source string.
+ * @param sourceLength The length of source, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *               U_UNSUPPORTED_ERROR if the collator is not a RuleBasedCollator.
+ * @return A pointer to a UCollationComparand, or NULL if an error occurred.
+ * @see ucol_strcollComparand
+ * @see ucol_closeComparand
+ * @draft ICU 67
+ */
+U_DRAFT UCollationComparand * U_EXPORT2
+ucol_openComparand(const UCollator *coll,
+                   const UChar *source, int32_t sourceLength,
+                   UErrorCode *status);
+
+/**
+ * Closes a UCollationComparand.
+ * @param comparand The UCollationComparand to close.
+ * @draft ICU 67
+ */
+U_DRAFT void U_EXPORT2
+ucol_closeComparand(UCollationComparand *comparand);
+
+/**
+ * Compares a string with the comparand's source string.
+ * Equivalent to ucol_strcoll(coll, target, targetLength, source, sourceLength)
+ * with the collator and source string of the comparand,
+ * using the collator's current options.
+ * @param comparand The UCollationComparand.
+ * @param target The target string.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The result of comparing the target string with the source string;
+ *         one of UCOL_EQUAL, UCOL_GREATER, UCOL_LESS
+ * @see ucol_strcoll
+ * @draft ICU 67
+ */
+U_DRAFT UCollationResult U_EXPORT2
+ucol_strcollComparand(UCollationComparand *comparand,
+                      const UChar *target, int32_t targetLength,
+                      UErrorCode *status);
+
+/**
+ * Compares the start of a string with the comparand's source string.
+ * Like ucol_strcollComparand() but the part of the target string after
+ * the collation elements that correspond to the source string is ignored:
+ * Returns UCOL_EQUAL if the target string starts with a prefix that compares
+ * equal to the source string. Ignorable characters (for example combining marks)
+ * that follow such a prefix are part of the comparison.
+ * The identical level is not compared.
+ *
+ * For example, with a sorted list of strings, the ones that start with the source string
+ * are the ones for which this function returns UCOL_EQUAL,
+ * and they form a contiguous range that can be found with a binary search.
+ *
+ * @param comparand The UCollationComparand.
+ * @param target The target string.
+ * @param targetLength The length of target, or -1 if null-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The result of comparing the start of the target string with the source string;
+ *         one of UCOL_EQUAL, UCOL_GREATER, UCOL_LESS
+ * @see ucol_strcollComparand
+ * @draft ICU 67
+ */
+U_DRAFT UCollationResult U_EXPORT2
+ucol_strcollComparandPrefix(UCollationComparand *comparand,
+                            const UChar *target, int32_t targetLength,
+                            UErrorCode *status);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUCollationComparandPointer
+ * "Smart pointer" class, closes a UCollationComparand via ucol_closeComparand().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 67
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUCollationComparandPointer, UCollationComparand, ucol_closeComparand);
+
+U_NAMESPACE_END
+
+#endif
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+U_CDECL_BEGIN
+/**
+ * A task to be run by a UCollationExecutor.
+ * @param context the taskContext that was passed to the executor
+ * @param index the index of the task, from 0 to taskCount-1
+ * @draft ICU 67
+ */
+typedef void U_CALLCONV
+UCollationTask(void *context, int32_t index);
+
+/**
+ * Function type for running a number of independent tasks,
+ * for example on a thread pool.
+ * The executor must call task(taskContext, i) exactly once for each i
+ * from 0 to taskCount-1, in any order and on any threads,
+ * and it must return only after all of these calls have returned.
+ * @param executorContext the context pointer that was passed to the sort function
+ * @param task the task function
+ * @param taskContext to be passed into each task call
+ * @param taskCount the number of tasks
+ * @see ucol_sortStrings
+ * @draft ICU 67
+ */
+typedef void U_CALLCONV
+UCollationExecutor(void *executorContext,
+                   UCollationTask *task, void *taskContext, int32_t taskCount);
+U_CDECL_END
+
+/**
+ * Sorts an array of strings according to the collator.
+ * The sort is stable: Strings that compare equal keep their relative order.
+ *
+ * Long arrays are sorted via sort keys, and the work is split into tasks
+ * which are run via the executor, if one is provided.
+ * The collator must not be modified while the strings are sorted.
+ *
+ * @param coll The UCollator containing the comparison rules.
+ * @param strings The array of string pointers, which is reordered in place.
+ * @param lengths The array of string lengths (-1 for a NUL-terminated string),
+ *                which is reordered together with the strings;
+ *                or NULL if all of the strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param executor Runs the sorting tasks, for example on a thread pool.
+ *                 If NULL, then they are run on the calling thread.
+ * @param executorContext Passed through to the executor.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_strcoll
+ * @draft ICU 67
+ */
+U_DRAFT void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar **strings, int32_t *lengths, int32_t count,
+                 UCollationExecutor *executor, void *executorContext,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Get the collation strength used in a UCollator.
  * The strength influences how strings are compared.
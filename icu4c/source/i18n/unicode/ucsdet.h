@@ -127,6 +127,33 @@ U_NAMESPACE_END
 U_STABLE void U_EXPORT2
 ucsdet_setText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  * Append a chunk of input byte data whose charset is to be detected.
+  *
+  * This allows the input to be supplied incrementally, for example while
+  * it is being read from a stream. The data is copied, so the caller may reuse
+  * its buffer after the call. The chunks are appended to any text previously
+  * set with ucsdet_setText(); to start over with a new stream, call
+  * ucsdet_setText() with an empty string first.
+  *
+  * Detection only looks at the start of the input data. Once enough input has
+  * been supplied, further data is ignored and this function returns FALSE, at
+  * which point the caller can stop reading and call ucsdet_detect().
+  * Text returned by ucsdet_getUChars() is limited to the data that was retained.
+  *
+  * @param ucsd   the charset detector to be used.
+  * @param textIn the next chunk of the input text of unknown encoding.
+  * @param len    the length of the chunk, or -1 if it is NUL terminated.
+  * @param status any error conditions are reported back in this variable.
+  * @return       TRUE if the detector would make use of more input data.
+  *
+  * @draft ICU 67
+  */
+U_DRAFT UBool U_EXPORT2
+ucsdet_appendText(UCharsetDetector *ucsd, const char *textIn, int32_t len, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Set the declared encoding for charset detection.
  *  The declared encoding of an input text is an encoding obtained
@@ -158,6 +185,8 @@ ucsdet_setDeclaredEncoding(UCharsetDetector *ucsd, const char *encoding, int32_t
  * there is a possibility that the returned charset will fail to handle
  * the full set of input data.
  * <p>
+ * Detection stops early as soon as a charset matches with full confidence.
+ * <p>
  * The returned UCharsetMatch object is owned by the UCharsetDetector.
  * It will remain valid until the detector input is reset, or until
  * the detector is closed.
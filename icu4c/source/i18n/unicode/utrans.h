@@ -510,6 +510,37 @@ utrans_transIncrementalUChars(const UTransliterator* trans,
                               UTransPosition* pos,
                               UErrorCode* status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Transliterate a string from a source buffer into a separate
+ * destination buffer.  The source string is not modified.
+ * This is faster than transliterating in place when the text is long
+ * and many replacements change its length.
+ *
+ * The result is NUL-terminated if there is room.  If destCapacity is
+ * too small, then U_BUFFER_OVERFLOW_ERROR is set and the full length
+ * of the result is returned (preflighting).
+ * The source and destination buffers must not overlap.
+ *
+ * @param trans the transliterator
+ * @param src the string to be transliterated
+ * @param srcLength the length of src, or -1 if it is zero-terminated
+ * @param dest the destination buffer; can be NULL if destCapacity==0
+ * @param destCapacity the length of the destination buffer
+ * @param status a pointer to the UErrorCode
+ * @return the length of the transliterated string
+ * @see utrans_transUChars
+ * @draft ICU 67
+ */
+U_DRAFT int32_t U_EXPORT2
+utrans_transUCharsToBuffer(const UTransliterator* trans,
+                           const UChar* src,
+                           int32_t srcLength,
+                           UChar* dest,
+                           int32_t destCapacity,
+                           UErrorCode* status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Create a rule string that can be passed to utrans_openU to recreate this
  * transliterator.
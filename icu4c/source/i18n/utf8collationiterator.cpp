@@ -42,7 +42,7 @@ UTF8CollationIterator::getOffset() const {
 }
 
 uint32_t
-UTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode & /*errorCode*/) {
+UTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode &errorCode) {
     if(pos == length) {
         c = U_SENTINEL;
         return Collation::FALLBACK_CE32;
@@ -51,7 +51,7 @@ UTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode & /*errorCode*/) {
     c = u8[pos++];
     if(U8_IS_SINGLE(c)) {
         // ASCII 00..7F
-        return trie->data32[c];
+        return handleASCIICE32(c, length, errorCode);
     }
     uint8_t t1, t2;
     if(0xe0 <= c && c < 0xf0 &&
@@ -76,6 +76,51 @@ UTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode & /*errorCode*/) {
     }
 }
 
+namespace {
+
+/**
+ * Returns the CE32 for an ASCII character,
+ * from the base data if the tailoring does not override it.
+ */
+inline uint32_t getASCIICE32(const CollationData *data, UChar32 c) {
+    uint32_t ce32 = data->trie->data32[c];
+    if(ce32 == Collation::FALLBACK_CE32 && data->base != NULL) {
+        ce32 = data->base->trie->data32[c];
+    }
+    return ce32;
+}
+
+}  // namespace
+
+uint32_t
+UTF8CollationIterator::handleASCIICE32(UChar32 c, int32_t runLimit, UErrorCode &errorCode) {
+    uint32_t ce32 = getASCIICE32(data, c);
+    if(Collation::isSpecialCE32(ce32)) {
+        // Contraction, prefix, digit, U+0000 etc.: Let nextCE() handle this character.
+        return trie->data32[c];
+    }
+    // A simple CE32 yields the same CE from the tailoring or from the base data.
+    // Most text has runs of such characters (letters, space, punctuation):
+    // Fetch their CEs without going through nextCE() for each one.
+    if(pos == runLimit || !canAppendLookaheadCEs(ASCII_LOOKAHEAD_LENGTH, errorCode)) {
+        return ce32;
+    }
+    int32_t lookaheadLimit = pos + ASCII_LOOKAHEAD_LENGTH;
+    if(runLimit >= 0 && lookaheadLimit > runLimit) {
+        lookaheadLimit = runLimit;
+    }
+    while(pos < lookaheadLimit) {
+        // Stops at a NUL terminator because U+0000 has a special CE32.
+        UChar32 next = u8[pos];
+        if(!U8_IS_SINGLE(next)) { break; }
+        uint32_t nextCE32 = getASCIICE32(data, next);
+        if(Collation::isSpecialCE32(nextCE32)) { break; }
+        appendLookaheadCE(Collation::ceFromSimpleCE32(nextCE32));
+        ++pos;
+    }
+    return ce32;
+}
+
 UBool
 UTF8CollationIterator::foundNULTerminator() {
     if(length < 0) {
@@ -159,7 +204,8 @@ FCDUTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode &errorCode) {
             c = u8[pos++];
             if(U8_IS_SINGLE(c)) {
                 // ASCII 00..7F
-                return trie->data32[c];
+                // ASCII characters pass the FCD check, regardless of their neighbors.
+                return handleASCIICE32(c, length, errorCode);
             }
             uint8_t t1, t2;
             if(0xe0 <= c && c < 0xf0 &&
@@ -207,6 +253,11 @@ FCDUTF8CollationIterator::handleNextCE32(UChar32 &c, UErrorCode &errorCode) {
             }
             continue;
         } else if(state == IN_FCD_SEGMENT && pos != limit) {
+            if(U8_IS_SINGLE(c = u8[pos])) {
+                // No ASCII lookahead beyond the segment limit.
+                ++pos;
+                return trie->data32[c];
+            }
             return UTF8CollationIterator::handleNextCE32(c, errorCode);
         } else if(state == IN_NORMALIZED && pos != normalized.length()) {
             c = normalized[pos++];
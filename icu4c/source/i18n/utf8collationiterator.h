@@ -69,6 +69,18 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
 
     virtual void backwardNumCodePoints(int32_t num, UErrorCode &errorCode);
 
+    /**
+     * Returns the CE32 for the ASCII character c before pos.
+     * ASCII fastpath: If that CE32 is simple, then the CEs for up to
+     * ASCII_LOOKAHEAD_LENGTH following ASCII characters with simple CE32s
+     * are appended to the CE buffer as well, and pos is advanced past them.
+     *
+     * @param runLimit the limit for lookahead, <0 for NUL-terminated strings
+     */
+    uint32_t handleASCIICE32(UChar32 c, int32_t runLimit, UErrorCode &errorCode);
+
+    static const int32_t ASCII_LOOKAHEAD_LENGTH = 16;
+
     const uint8_t *u8;
     int32_t pos;
     int32_t length;  // <0 for NUL-terminated strings
@@ -26,6 +26,7 @@
 #include "uenumimp.h"
 #include "cpputils.h"
 #include "rbt.h"
+#include "transbuf.h"
 
 // Following macro is to be followed by <return value>';' or just ';'
 #define utrans_ENTRY(s) if ((s)==NULL || U_FAILURE(*(s))) return
@@ -452,12 +453,13 @@ utrans_transUChars(const UTransliterator* trans,
  
     int32_t textLen = (textLength == NULL || *textLength < 0)
         ? u_strlen(text) : *textLength;
-    // writeable alias: for this ct, len CANNOT be -1 (why?)
-    UnicodeString str(text, textLen, textCapacity);
+    // Transliterate a copy of the text, which moves less text around
+    // than a writable-alias UnicodeString when replacements change the length.
+    TransliterationBuffer str(text, textLen);
 
     *limit = ((Transliterator*) trans)->transliterate(str, start, *limit);
 
-    // Copy the string buffer back to text (only if necessary)
+    // Copy the transliterated text back to text
     // and fill in *neededCapacity (if neededCapacity != NULL).
     textLen = str.extract(text, textCapacity, *status);
     if(textLength != NULL) {
@@ -482,12 +484,11 @@ utrans_transIncrementalUChars(const UTransliterator* trans,
 
     int32_t textLen = (textLength == NULL || *textLength < 0)
         ? u_strlen(text) : *textLength;
-    // writeable alias: for this ct, len CANNOT be -1 (why?)
-    UnicodeString str(text, textLen, textCapacity);
+    TransliterationBuffer str(text, textLen);
 
     ((Transliterator*) trans)->transliterate(str, *pos, *status);
 
-    // Copy the string buffer back to text (only if necessary)
+    // Copy the transliterated text back to text
     // and fill in *neededCapacity (if neededCapacity != NULL).
     textLen = str.extract(text, textCapacity, *status);
     if(textLength != NULL) {
@@ -495,6 +496,23 @@ utrans_transIncrementalUChars(const UTransliterator* trans,
     }
 }
 
+U_CAPI int32_t U_EXPORT2
+utrans_transUCharsToBuffer(const UTransliterator* trans,
+                           const UChar* src,
+                           int32_t srcLength,
+                           UChar* dest,
+                           int32_t destCapacity,
+                           UErrorCode* status) {
+    utrans_ENTRY(status) 0;
+
+    if (trans == 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    return ((const Transliterator*) trans)->transliterate(src, srcLength, dest, destCapacity, *status);
+}
+
 U_CAPI int32_t U_EXPORT2
 utrans_toRules(     const UTransliterator* trans,
                     UBool escapeUnprintable,
@@ -90,6 +90,8 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestBengaliSortKey, "tscoll/capitst/TestBengaliSortKey");
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
+    addTest(root, &TestComparand, "tscoll/capitst/TestComparand");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
 }
 
 void TestGetSetAttr(void) {
@@ -2565,4 +2567,236 @@ static void TestStrcollNull(void) {
     ucol_close(coll);
 }
 
+static void TestComparand(void) {
+    static const char *const strings[] = {
+        "", "a", "ab", "abc", "Abc", "ab\\u0301c", "a-b", "ab c", "ab10", "ab9",
+        "\\u00e4b", "a\\u0308b", "cote", "cot\\u00e9", "c\\u00f4te", "c\\u00f4t\\u00e9",
+        "\\u03b1\\u03b2", "\\u03b1\\u03b2\\u03b3", "\\u5c71\\u5ddd", "\\u5c71", "\\uac00\\ub098",
+        "\\u0915\\u094d\\u0937", "ab\\u00ad", "\\u00c5", "A\\u030a", "\\u212b"
+    };
+    static const struct {
+        const char *locale;
+        UColAttribute attr;
+        UColAttributeValue value;
+    } settings[] = {
+        { "en", UCOL_STRENGTH, UCOL_TERTIARY },
+        { "en", UCOL_STRENGTH, UCOL_IDENTICAL },
+        { "en", UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED },
+        { "en", UCOL_CASE_LEVEL, UCOL_ON },
+        { "en", UCOL_NUMERIC_COLLATION, UCOL_ON },
+        { "en", UCOL_NORMALIZATION_MODE, UCOL_ON },
+        { "fr_CA", UCOL_STRENGTH, UCOL_TERTIARY },
+        { "ko", UCOL_STRENGTH, UCOL_PRIMARY }
+    };
+    UChar s[UPRV_LENGTHOF(strings)][20], t[20];
+    int32_t sLengths[UPRV_LENGTHOF(strings)];
+    int32_t i, j, k;
+    for(i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+        sLengths[i] = u_unescape(strings[i], s[i], 20);
+    }
+    for(k = 0; k < UPRV_LENGTHOF(settings); ++k) {
+        UErrorCode status = U_ZERO_ERROR;
+        UCollator *coll = ucol_open(settings[k].locale, &status);
+        if(U_FAILURE(status)) {
+            log_err_status(status, "ucol_open(%s) failed - %s\n", settings[k].locale, u_errorName(status));
+            return;
+        }
+        ucol_setAttribute(coll, settings[k].attr, settings[k].value, &status);
+        if(settings[k].attr == UCOL_ALTERNATE_HANDLING) {
+            ucol_setStrength(coll, UCOL_QUATERNARY);
+        }
+        for(i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            UCollationComparand *comparand = ucol_openComparand(coll, s[i], sLengths[i], &status);
+            if(U_FAILURE(status)) {
+                log_err("ucol_openComparand(%s) failed - %s\n", strings[i], u_errorName(status));
+                break;
+            }
+            /* Compare twice to exercise the reuse of the comparand's collation elements. */
+            for(j = 0; j < 2 * UPRV_LENGTHOF(strings); ++j) {
+                int32_t m = (i + j) % UPRV_LENGTHOF(strings);
+                UCollationResult expected = ucol_strcoll(coll, s[m], sLengths[m], s[i], sLengths[i]);
+                UCollationResult actual = ucol_strcollComparand(comparand, s[m], sLengths[m], &status);
+                if(U_FAILURE(status) || actual != expected) {
+                    log_err("%s/%d: ucol_strcollComparand(%s vs. %s)=%d (%s) but ucol_strcoll()=%d\n",
+                            settings[k].locale, k, strings[m], strings[i],
+                            (int)actual, u_errorName(status), (int)expected);
+                }
+                /* NUL-terminated target */
+                actual = ucol_strcollComparand(comparand, s[m], -1, &status);
+                if(U_FAILURE(status) || actual != expected) {
+                    log_err("%s/%d: ucol_strcollComparand(%s/-1 vs. %s)=%d (%s) but ucol_strcoll()=%d\n",
+                            settings[k].locale, k, strings[m], strings[i],
+                            (int)actual, u_errorName(status), (int)expected);
+                }
+            }
+            ucol_closeComparand(comparand);
+        }
+        ucol_close(coll);
+    }
+
+    {
+        /* Prefix comparisons. */
+        static const struct {
+            const char *target;
+            UCollationResult result;
+        } prefixTests[] = {
+            { "", UCOL_LESS },
+            { "a", UCOL_LESS },
+            { "ab", UCOL_EQUAL },
+            { "abc", UCOL_EQUAL },
+            { "ab-c", UCOL_EQUAL },
+            { "a\\u00adbz", UCOL_EQUAL },
+            { "Abc", UCOL_GREATER },
+            { "ab\\u0301c", UCOL_GREATER },
+            { "\\u00e1bc", UCOL_GREATER },
+            { "ac", UCOL_GREATER },
+            { "aa", UCOL_LESS },
+            { "b", UCOL_GREATER }
+        };
+        UErrorCode status = U_ZERO_ERROR;
+        UCollator *coll = ucol_open("en", &status);
+        UCollationComparand *comparand;
+        UCollationResult result;
+        static const UChar ab[] = { 0x61, 0x62, 0 };
+        static const UChar alphaBeta[] = { 0x3b1, 0x3b2, 0 };
+        static const UChar alphaBetaGamma[] = { 0x3b1, 0x3b2, 0x3b3, 0 };
+        if(U_FAILURE(status)) {
+            log_err_status(status, "ucol_open(en) failed - %s\n", u_errorName(status));
+            return;
+        }
+        comparand = ucol_openComparand(coll, ab, -1, &status);
+        for(i = 0; i < UPRV_LENGTHOF(prefixTests) && U_SUCCESS(status); ++i) {
+            int32_t length = u_unescape(prefixTests[i].target, t, UPRV_LENGTHOF(t));
+            result = ucol_strcollComparandPrefix(comparand, t, length, &status);
+            if(U_FAILURE(status) || result != prefixTests[i].result) {
+                log_err("ucol_strcollComparandPrefix(%s vs. ab)=%d (%s) but expected %d\n",
+                        prefixTests[i].target, (int)result, u_errorName(status),
+                        (int)prefixTests[i].result);
+            }
+        }
+        /* Changing the settings must not leave stale collation elements in the comparand. */
+        ucol_setStrength(coll, UCOL_PRIMARY);
+        result = ucol_strcollComparandPrefix(comparand, ab, 1, &status);
+        if(U_FAILURE(status) || result != UCOL_LESS) {
+            log_err("ucol_strcollComparandPrefix(a vs. ab) at primary strength failed\n");
+        }
+        u_unescape("Ab\\u0301c", t, UPRV_LENGTHOF(t));
+        result = ucol_strcollComparandPrefix(comparand, t, -1, &status);
+        if(U_FAILURE(status) || result != UCOL_EQUAL) {
+            log_err("ucol_strcollComparandPrefix(Ab\\u0301c vs. ab) at primary strength=%d (%s)\n",
+                    (int)result, u_errorName(status));
+        }
+        ucol_closeComparand(comparand);
+
+        ucol_setStrength(coll, UCOL_TERTIARY);
+        comparand = ucol_openComparand(coll, alphaBeta, 2, &status);
+        result = ucol_strcollComparandPrefix(comparand, alphaBetaGamma, -1, &status);
+        if(U_FAILURE(status) || result != UCOL_EQUAL) {
+            log_err("ucol_strcollComparandPrefix(alpha beta gamma vs. alpha beta)=%d (%s)\n",
+                    (int)result, u_errorName(status));
+        }
+        result = ucol_strcollComparand(comparand, alphaBetaGamma, -1, &status);
+        if(U_FAILURE(status) || result != UCOL_GREATER) {
+            log_err("ucol_strcollComparand(alpha beta gamma vs. alpha beta)=%d (%s)\n",
+                    (int)result, u_errorName(status));
+        }
+        ucol_closeComparand(comparand);
+
+        /* Argument errors. */
+        comparand = ucol_openComparand(NULL, ab, -1, &status);
+        if(comparand != NULL || status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucol_openComparand(NULL collator) did not fail with U_ILLEGAL_ARGUMENT_ERROR\n");
+        }
+        status = U_ZERO_ERROR;
+        comparand = ucol_openComparand(coll, NULL, 0, &status);
+        ucol_strcollComparand(comparand, NULL, 5, &status);
+        if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucol_strcollComparand(NULL/5) did not fail with U_ILLEGAL_ARGUMENT_ERROR\n");
+        }
+        ucol_closeComparand(comparand);
+        ucol_close(coll);
+    }
+}
+
+/* Runs the tasks on the calling thread, in reverse order. */
+static void U_CALLCONV
+reverseExecutor(void *executorContext, UCollationTask *task, void *taskContext, int32_t taskCount) {
+    int32_t i;
+    ++*(int32_t *)executorContext;
+    for(i = taskCount - 1; i >= 0; --i) {
+        task(taskContext, i);
+    }
+}
+
+static void TestSortStrings(void) {
+    enum { COUNT = 5000, MAX_LENGTH = 8 };
+    static const UChar alphabet[] = { 0x61, 0x41, 0xe4, 0x62, 0x2d, 0x20, 0x430, 0x3b1, 0x31, 0 };
+    UChar (*buffer)[MAX_LENGTH + 1] = (UChar (*)[MAX_LENGTH + 1])malloc(COUNT * sizeof(*buffer));
+    const UChar **strings = (const UChar **)malloc(COUNT * sizeof(const UChar *));
+    int32_t *lengths = (int32_t *)malloc(COUNT * sizeof(int32_t));
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    uint32_t seed = 1;
+    int32_t i, j, counts[] = { 0, 1, 30, COUNT };
+    if(U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(en) failed - %s\n", u_errorName(status));
+        free(buffer);
+        free(strings);
+        free(lengths);
+        return;
+    }
+    for(i = 0; i < COUNT; ++i) {
+        int32_t length;
+        seed = seed * 1103515245 + 12345;
+        length = (int32_t)((seed >> 16) % MAX_LENGTH);
+        for(j = 0; j < length; ++j) {
+            seed = seed * 1103515245 + 12345;
+            buffer[i][j] = alphabet[(seed >> 16) % (UPRV_LENGTHOF(alphabet) - 1)];
+        }
+        buffer[i][length] = 0;
+    }
+    for(i = 0; i < UPRV_LENGTHOF(counts); ++i) {
+        int32_t count = counts[i];
+        int32_t withExecutor;
+        for(withExecutor = 0; withExecutor <= 1; ++withExecutor) {
+            int32_t executorCalls = 0;
+            for(j = 0; j < count; ++j) {
+                strings[j] = buffer[j];
+                lengths[j] = (j & 1) ? -1 : u_strlen(buffer[j]);
+            }
+            ucol_sortStrings(coll, strings, withExecutor ? lengths : NULL, count,
+                             withExecutor ? reverseExecutor : NULL, &executorCalls, &status);
+            if(U_FAILURE(status)) {
+                log_err("ucol_sortStrings(%d strings) failed - %s\n", (int)count, u_errorName(status));
+                status = U_ZERO_ERROR;
+                continue;
+            }
+            for(j = 1; j < count; ++j) {
+                UCollationResult order = ucol_strcoll(coll, strings[j - 1], -1, strings[j], -1);
+                /* Stable: Equal strings keep their original order. */
+                if(order == UCOL_GREATER || (order == UCOL_EQUAL && strings[j - 1] > strings[j])) {
+                    log_err("ucol_sortStrings(%d strings, executor=%d) wrong order at %d\n",
+                            (int)count, (int)withExecutor, (int)j);
+                    break;
+                }
+                if(withExecutor && lengths[j] >= 0 && lengths[j] != u_strlen(strings[j])) {
+                    log_err("ucol_sortStrings(%d strings) did not reorder the lengths\n", (int)count);
+                    break;
+                }
+            }
+            if(withExecutor && count == COUNT && executorCalls == 0) {
+                log_err("ucol_sortStrings(%d strings) did not call the executor\n", (int)count);
+            }
+        }
+    }
+    ucol_sortStrings(coll, NULL, NULL, 3, NULL, NULL, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(NULL strings) did not fail with U_ILLEGAL_ARGUMENT_ERROR\n");
+    }
+    ucol_close(coll);
+    free(buffer);
+    free(strings);
+    free(lengths);
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
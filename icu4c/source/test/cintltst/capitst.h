@@ -137,6 +137,16 @@
      */
     static void TestStrcollNull(void);
 
+    /**
+     * test ucol_openComparand & ucol_strcollComparand(Prefix)
+     */
+    static void TestComparand(void);
+
+    /**
+     * test ucol_sortStrings
+     */
+    static void TestSortStrings(void);
+
 #endif /* #if !UCONFIG_NO_COLLATION */
 
 #endif
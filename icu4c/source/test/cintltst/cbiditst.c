@@ -91,6 +91,7 @@ static void doTailTest(void);
 
 static void testBracketOverflow(void);
 static void TestExplicitLevel0(void);
+static void TestSetParas(void);
 
 /* new BIDI API */
 static void testReorderingMode(void);
@@ -140,6 +141,7 @@ addComplexTest(TestNode** root) {
     addTest(root, testContext, "complex/bidi/testContext");
     addTest(root, testBracketOverflow, "complex/bidi/TestBracketOverflow");
     addTest(root, TestExplicitLevel0, "complex/bidi/TestExplicitLevel0");
+    addTest(root, TestSetParas, "complex/bidi/TestSetParas");
 
     addTest(root, doArabicShapingTest, "complex/arabic-shaping/ArabicShapingTest");
     addTest(root, doLamAlefSpecialVLTRArabicShapingTest, "complex/arabic-shaping/lamalef");
@@ -4949,3 +4951,121 @@ static void TestExplicitLevel0(void) {
     }
     ubidi_close(bidi);
 }
+
+static void TestSetParas(void) {
+    /* Compare with ubidi_setPara(), ubidi_getLevels() and ubidi_getVisualRun(). */
+    static const UChar latin[] = { 0x41, 0x62, 0x20, 0x31, 0x32, 0x2c, 0x20, 0xe9, 0x2e, 0 };
+    static const UChar greek[] = { 0x3b1, 0x301, 0x3b2, 0x20, 0x430, 0x28, 0x29, 0 };
+    static const UChar mixed[] = { 0x61, 0x62, 0x20, 0x5d0, 0x5d1, 0x20, 0x31, 0x32, 0x20, 0x63, 0 };
+    static const UChar hebrew[] = { 0x5d0, 0x20, 0x5d1, 0x2e, 0 };
+    static const UChar arabicDigits[] = { 0x20, 0x661, 0x662, 0x20, 0 };
+    static const UChar paras[] = { 0x61, 0x20, 0x0a, 0x5d0, 0x20, 0x0a, 0x31, 0 };
+    static const UChar digits[] = { 0x31, 0x32, 0x20, 0 };
+    static const UChar controls[] = { 0x61, 0x202e, 0x62, 0x63, 0x202c, 0x64, 0 };
+    static const UChar empty[] = { 0 };
+    static const UChar *const texts[] = {
+        latin, greek, mixed, empty, hebrew, arabicDigits, paras, digits, controls
+    };
+    static const UBiDiLevel setParasLevels[] = { 0, 1, UBIDI_DEFAULT_LTR, UBIDI_DEFAULT_RTL };
+    enum { COUNT = UPRV_LENGTHOF(texts) };
+    UBiDiLevel levels[100];
+    UBiDiVisualRun runs[100];
+    int32_t runLimits[COUNT];
+    int32_t i, j, p, levelsStart, runCount, totalLength = 0;
+    UBiDi *bidi = ubidi_open();
+    UBiDi *expected = ubidi_open();
+    UErrorCode errorCode = U_ZERO_ERROR;
+
+    for (i = 0; i < COUNT; ++i) {
+        totalLength += u_strlen(texts[i]);
+    }
+    for (p = 0; p < UPRV_LENGTHOF(setParasLevels); ++p) {
+        runCount = ubidi_setParas(bidi, texts, NULL, COUNT, setParasLevels[p],
+                                  levels, UPRV_LENGTHOF(levels),
+                                  runs, UPRV_LENGTHOF(runs), runLimits, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("ubidi_setParas(paraLevel %d) failed: %s\n", setParasLevels[p], u_errorName(errorCode));
+            break;
+        }
+        if (runCount != runLimits[COUNT - 1]) {
+            log_err("ubidi_setParas(paraLevel %d) returned %d != runLimits[last]=%d\n",
+                    setParasLevels[p], runCount, runLimits[COUNT - 1]);
+        }
+        levelsStart = 0;
+        runCount = 0;
+        for (i = 0; i < COUNT; ++i) {
+            int32_t length = u_strlen(texts[i]);
+            int32_t expectedRunCount = 0;
+            ubidi_setPara(expected, texts[i], length, setParasLevels[p], NULL, &errorCode);
+            if (length > 0) {
+                const UBiDiLevel *expectedLevels = ubidi_getLevels(expected, &errorCode);
+                expectedRunCount = ubidi_countRuns(expected, &errorCode);
+                if (U_FAILURE(errorCode)) {
+                    log_err("ubidi_setPara(text %d, paraLevel %d) failed: %s\n",
+                            i, setParasLevels[p], u_errorName(errorCode));
+                    break;
+                }
+                if (0 != memcmp(levels + levelsStart, expectedLevels, length)) {
+                    log_err("ubidi_setParas(text %d, paraLevel %d) wrong levels\n", i, setParasLevels[p]);
+                }
+            }
+            if (runLimits[i] - runCount != expectedRunCount) {
+                log_err("ubidi_setParas(text %d, paraLevel %d) %d runs != %d\n",
+                        i, setParasLevels[p], runLimits[i] - runCount, expectedRunCount);
+            } else {
+                for (j = 0; j < expectedRunCount; ++j) {
+                    int32_t logicalStart, runLength;
+                    UBiDiDirection dir = ubidi_getVisualRun(expected, j, &logicalStart, &runLength);
+                    const UBiDiVisualRun *run = runs + runCount + j;
+                    if (run->logicalStart != logicalStart || run->length != runLength ||
+                            run->direction != dir) {
+                        log_err("ubidi_setParas(text %d, paraLevel %d) run %d is "
+                                "(%d, %d, %d) != (%d, %d, %d)\n",
+                                i, setParasLevels[p], j,
+                                run->logicalStart, run->length, run->direction,
+                                logicalStart, runLength, dir);
+                    }
+                }
+            }
+            levelsStart += length;
+            runCount = runLimits[i];
+        }
+    }
+
+    /* Preflighting and overflow. */
+    errorCode = U_ZERO_ERROR;
+    runCount = ubidi_setParas(bidi, texts, NULL, COUNT, UBIDI_DEFAULT_LTR,
+                              NULL, 0, NULL, 0, runLimits, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || runCount != runLimits[COUNT - 1] || runCount <= COUNT) {
+        log_err("ubidi_setParas(preflighting) failed: %s runs %d\n", u_errorName(errorCode), runCount);
+    }
+    errorCode = U_ZERO_ERROR;
+    ubidi_setParas(bidi, texts, NULL, COUNT, UBIDI_DEFAULT_LTR,
+                   levels, totalLength - 1, runs, UPRV_LENGTHOF(runs), runLimits, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+        log_err("ubidi_setParas(levels overflow) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    runCount = ubidi_setParas(bidi, texts, NULL, COUNT, UBIDI_DEFAULT_LTR,
+                              levels, totalLength, runs, UPRV_LENGTHOF(runs), runLimits, &errorCode);
+    if (U_FAILURE(errorCode) || ubidi_getText(bidi) != controls) {
+        log_err("ubidi_setParas(exact levels capacity) failed: %s\n", u_errorName(errorCode));
+    }
+
+    /* Illegal arguments. */
+    ubidi_setParas(bidi, texts, NULL, COUNT, UBIDI_DEFAULT_LTR,
+                   levels, UPRV_LENGTHOF(levels), runs, UPRV_LENGTHOF(runs), NULL, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_setParas(runLimits=NULL) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    ubidi_setReorderingOptions(bidi, UBIDI_OPTION_STREAMING);
+    ubidi_setParas(bidi, texts, NULL, COUNT, UBIDI_DEFAULT_LTR,
+                   levels, UPRV_LENGTHOF(levels), runs, UPRV_LENGTHOF(runs), runLimits, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ubidi_setParas(UBIDI_OPTION_STREAMING) failed: %s\n", u_errorName(errorCode));
+    }
+
+    ubidi_close(expected);
+    ubidi_close(bidi);
+}
@@ -6086,6 +6086,7 @@ const char* const locale_to_langtag[][3] = {
 
 static void TestToLanguageTag(void) {
     char langtag[256];
+    char savedDefault[ULOC_FULLNAME_CAPACITY];
     int32_t i;
     UErrorCode status;
     int32_t len;
@@ -6138,6 +6139,23 @@ static void TestToLanguageTag(void) {
             }
         }
     }
+
+    /* NULL is the default locale, with a simple tag and with the test default locale */
+    uprv_strcpy(savedDefault, uloc_getDefault());
+    for (i = 0; i < 4; i++) {
+        char defaultLangtag[256];
+        UBool strict = (UBool)(i & 1);
+        status = U_ZERO_ERROR;
+        uloc_setDefault(i < 2 ? "de_CH" : savedDefault, &status);
+        uloc_toLanguageTag(uloc_getDefault(), defaultLangtag, sizeof(defaultLangtag), strict, &status);
+        uloc_toLanguageTag(NULL, langtag, sizeof(langtag), strict, &status);
+        if (U_FAILURE(status)) {
+            log_err("uloc_toLanguageTag(NULL, strict=%d) failed - %s\n", (int)strict, u_errorName(status));
+        } else if (uprv_strcmp(langtag, defaultLangtag) != 0 || (i < 2 && uprv_strcmp(langtag, "de-CH") != 0)) {
+            log_err("uloc_toLanguageTag(NULL, strict=%d) returned [%s] - expected: [%s] for the default locale\n",
+                (int)strict, langtag, defaultLangtag);
+        }
+    }
 }
 
 static void TestBug20132(void) {
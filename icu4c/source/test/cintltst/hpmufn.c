@@ -16,6 +16,7 @@
 #include "unicode/uchar.h"
 #include "unicode/ures.h"
 #include "cintltst.h"
+#include "cmemory.h"
 #include "unicode/utrace.h"
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +31,7 @@ typedef union {
 } ctest_AlignedMemory;
 
 static void TestHeapFunctions(void);
+static void TestSizedMalloc(void);
 
 void addHeapMutexTest(TestNode **root);
 
@@ -37,6 +39,8 @@ void addHeapMutexTest(TestNode **root);
 void
 addHeapMutexTest(TestNode** root)
 {
+    /* Before TestHeapFunctions: The small-block cache is off once u_setMemoryFunctions() is called. */
+    addTest(root, &TestSizedMalloc,         "hpmufn/TestSizedMalloc"    );
     addTest(root, &TestHeapFunctions,       "hpmufn/TestHeapFunctions"  );
 }
 
@@ -199,4 +203,103 @@ static void TestHeapFunctions() {
     ctest_resetICU();
 }
 
+/* Returns the number of cache hits for blocks of the size class for size. */
+static int64_t getSizedMallocHits(int32_t size, int64_t *allocations) {
+    int32_t blockSizes[64];
+    int64_t allocs[64], hits[64];
+    int32_t i;
+    int32_t count = uprv_getSizedMallocStats(blockSizes, allocs, hits, UPRV_LENGTHOF(blockSizes));
+    for (i = 0; i < count && i < UPRV_LENGTHOF(blockSizes); ++i) {
+        if (blockSizes[i] >= size) {
+            *allocations = allocs[i];
+            return hits[i];
+        }
+    }
+    *allocations = 0;
+    return 0;
+}
 
+static void TestSizedMalloc() {
+    UErrorCode status = U_ZERO_ERROR;
+    char *icuDataDir;
+    char *p, *q;
+    int64_t allocations, hits, allocations2, hits2;
+    int32_t blockSizes[64];
+    int64_t allocs[64], cacheHits[64];
+    int32_t i, count;
+
+    /* The size classes are ascending. */
+    count = uprv_getSizedMallocStats(blockSizes, allocs, cacheHits, UPRV_LENGTHOF(blockSizes));
+    TEST_ASSERT(count > 0 && count <= UPRV_LENGTHOF(blockSizes));
+    for (i = 1; i < count; ++i) {
+        TEST_ASSERT(blockSizes[i - 1] < blockSizes[i]);
+    }
+
+    /* A released block is reused for the next request in its size class. */
+    p = (char *)uprv_sizedMalloc(48);
+    TEST_ASSERT(p != NULL);
+    memset(p, 'a', 48);
+    uprv_sizedFree(p, 48);
+    hits = getSizedMallocHits(48, &allocations);
+    q = (char *)uprv_sizedMalloc(33);
+    TEST_ASSERT(q == p);
+    hits2 = getSizedMallocHits(48, &allocations2);
+    TEST_ASSERT(allocations2 == allocations + 1);
+    TEST_ASSERT(hits2 == hits + 1);
+
+    /* A block released with a smaller size is only reused for up to that size. */
+    uprv_sizedFree(q, 40);
+    p = (char *)uprv_sizedMalloc(48);
+    TEST_ASSERT(p != q);
+    uprv_sizedFree(p, 48);
+    p = (char *)uprv_sizedMalloc(32);
+    TEST_ASSERT(p == q);
+    uprv_sizedFree(p, 32);
+    q = (char *)uprv_sizedMalloc(33);
+
+    /* Growing and shrinking preserve the contents. */
+    memcpy(q, "abcdefghijklmnopqrstuvwxyz012345", 33);
+    q = (char *)uprv_sizedRealloc(q, 33, 2000);
+    TEST_ASSERT(q != NULL && strcmp(q, "abcdefghijklmnopqrstuvwxyz012345") == 0);
+    q = (char *)uprv_sizedRealloc(q, 2000, 100);
+    TEST_ASSERT(q != NULL && strcmp(q, "abcdefghijklmnopqrstuvwxyz012345") == 0);
+    q = (char *)uprv_sizedRealloc(q, 100, 10);
+    TEST_ASSERT(q != NULL && memcmp(q, "abcdefghij", 10) == 0);
+    uprv_sizedFree(q, 10);
+
+    /* Many blocks overflow the per-thread cache without losing any. */
+    {
+        void *blocks[100];
+        for (i = 0; i < UPRV_LENGTHOF(blocks); ++i) {
+            blocks[i] = uprv_sizedMalloc(200);
+            TEST_ASSERT(blocks[i] != NULL);
+        }
+        for (i = 0; i < UPRV_LENGTHOF(blocks); ++i) {
+            uprv_sizedFree(blocks[i], 200);
+        }
+    }
+    uprv_sizedFree(uprv_sizedMalloc(0), 0);
+    uprv_sizedFree(NULL, 8);
+
+    /* User heap functions turn off the cache; its blocks are not handed out or freed through them. */
+    icuDataDir = safeGetICUDataDirectory();
+    ctest_resetICU();
+    u_cleanup();
+    u_setMemoryFunctions(&gContext, myMemAlloc, myMemRealloc, myMemFree, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    gBlockCount = 0;
+    p = (char *)uprv_sizedMalloc(40);
+    TEST_ASSERT(p != NULL && gBlockCount == 1);
+    memset(p, 'b', 40);
+    p = (char *)uprv_sizedRealloc(p, 40, 80);
+    TEST_ASSERT(p != NULL && p[39] == 'b');
+    uprv_sizedFree(p, 80);
+    p = (char *)uprv_sizedMalloc(40);
+    TEST_ASSERT(p != NULL && gBlockCount == 3);
+    uprv_sizedFree(p, 40);
+
+    u_cleanup();
+    u_setDataDirectory(icuDataDir);
+    free(icuDataDir);
+    ctest_resetICU();
+}
@@ -38,6 +38,7 @@ static void TestJB4475(void);
 static void TestLength(void);
 static void TestJB5273(void);
 static void TestUTS46(void);
+static void TestUTS46Names(void);
 
 void addIDNATest(TestNode** root);
 
@@ -67,6 +68,7 @@ addIDNATest(TestNode** root)
    addTest(root, &TestLength,       "idna/TestLength");
    addTest(root, &TestJB5273,       "idna/TestJB5273");
    addTest(root, &TestUTS46,        "idna/TestUTS46");
+   addTest(root, &TestUTS46Names,   "idna/TestUTS46Names");
 }
 
 static void
@@ -1022,6 +1024,90 @@ static void TestUTS46() {
     uidna_close(uts46);
 }
 
+static void TestUTS46Names() {
+    static const char *const names[] = {
+        "www.eXample.cOm", "a_b.com", "b\xc3\xbc" "CHER.de", ""
+    };
+    static const char expected[] =
+        "www.example.com\0a\xef\xbf\xbd" "b.com\0xn--bcher-kva.de\0\0";
+    static const int32_t expectedIndexes[] = { 0, 16, 26, 43 };
+    static const int32_t lengths[] = { -1, 5, 1, -1 };
+    char dest[60];
+    int32_t destIndexes[4];
+    uint32_t errors[4];
+    int32_t length, i;
+
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UIDNA *uts46 = uidna_openUTS46(UIDNA_USE_STD3_RULES|UIDNA_NONTRANSITIONAL_TO_ASCII,
+                                   &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_err_status(errorCode, "uidna_openUTS46() failed: %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    length = uidna_namesToASCII_UTF8(uts46, names, NULL, 4, dest, UPRV_LENGTHOF(dest),
+                                     destIndexes, errors, &errorCode);
+    if( U_FAILURE(errorCode) || length != 44 || 0 != memcmp(dest, expected, 44) ||
+        errors[0] != 0 || errors[1] != UIDNA_ERROR_DISALLOWED || errors[2] != 0 ||
+        errors[3] != UIDNA_ERROR_EMPTY_LABEL
+    ) {
+        log_err("uidna_namesToASCII_UTF8() failed: %s length %d\n",
+                u_errorName(errorCode), (int)length);
+    }
+    for(i = 0; i < 4; ++i) {
+        if(destIndexes[i] != expectedIndexes[i]) {
+            log_err("uidna_namesToASCII_UTF8() destIndexes[%d]=%d != %d\n",
+                    (int)i, (int)destIndexes[i], (int)expectedIndexes[i]);
+        }
+    }
+
+    /* Preflighting, and explicit lengths. */
+    length = uidna_namesToASCII_UTF8(uts46, names, lengths, 4, NULL, 0,
+                                     destIndexes, NULL, &errorCode);
+    if(errorCode != U_BUFFER_OVERFLOW_ERROR || length != 27 || destIndexes[3] != 26) {
+        log_err("uidna_namesToASCII_UTF8(preflighting) failed: %s length %d\n",
+                u_errorName(errorCode), (int)length);
+    }
+    errorCode = U_ZERO_ERROR;
+    length = uidna_namesToASCII_UTF8(uts46, names, lengths, 3, dest, 20,
+                                     NULL, errors, &errorCode);
+    if( errorCode != U_BUFFER_OVERFLOW_ERROR || length != 26 ||
+        0 != memcmp(dest, "www.example.com", 16) || errors[2] != 0
+    ) {
+        log_err("uidna_namesToASCII_UTF8(overflow) failed: %s length %d\n",
+                u_errorName(errorCode), (int)length);
+    }
+
+    /* No names. */
+    errorCode = U_ZERO_ERROR;
+    length = uidna_namesToASCII_UTF8(uts46, NULL, NULL, 0, NULL, 0, NULL, NULL, &errorCode);
+    if(U_FAILURE(errorCode) || length != 0) {
+        log_err("uidna_namesToASCII_UTF8(no names) failed: %s\n", u_errorName(errorCode));
+    }
+
+    /* Illegal arguments. */
+    length = uidna_namesToASCII_UTF8(uts46, names, NULL, -1, dest, UPRV_LENGTHOF(dest),
+                                     NULL, NULL, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uidna_namesToASCII_UTF8(count<0) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = uidna_namesToASCII_UTF8(uts46, NULL, NULL, 2, dest, UPRV_LENGTHOF(dest),
+                                     NULL, NULL, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uidna_namesToASCII_UTF8(names==NULL) failed: %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = uidna_namesToASCII_UTF8(uts46, names, NULL, 4, NULL, 5,
+                                     NULL, NULL, &errorCode);
+    if(errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("uidna_namesToASCII_UTF8(dest==NULL, capacity>0) failed: %s\n",
+                u_errorName(errorCode));
+    }
+
+    uidna_close(uts46);
+}
+
 #endif
 
 /*
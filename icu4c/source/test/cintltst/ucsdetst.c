@@ -31,6 +31,7 @@ static void TestChaining(void);
 static void TestBufferOverflow(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
+static void TestAppendText(void);
 
 void addUCsdetTest(TestNode** root);
 
@@ -43,6 +44,7 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestAppendText, "ucsdetst/TestAppendText");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -426,6 +428,89 @@ static void TestBufferOverflow(void) {
     ucsdet_close(csd);
 }
 
+static void TestAppendText(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "<p> Un tr\\u00E8s petit peu de Fran\\u00E7ais, avec des caract\\u00E8res accentu\\u00E9s. </p> ";
+    static const char utf8[] = "\xCE\x91\xCE\x92\xCE\x93\xCE\x94 is Greek. ";
+    int32_t sLength = 0;
+    UChar s[sizeof(ss)];
+    int32_t byteLength = 0;
+    char *bytes;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch *match;
+    const UCharsetMatch **matches;
+    char name[32];
+    int32_t confidence, matchCount, i;
+    UBool wantsMore = TRUE;
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "ISO-8859-1", &byteLength);
+
+    /* Detection on appended chunks must agree with detection on the whole text. */
+    ucsdet_setText(csd, bytes, byteLength, &status);
+    match = ucsdet_detect(csd, &status);
+    if (U_FAILURE(status) || match == NULL) {
+        log_err("Detection failure on whole text: %s\n", u_errorName(status));
+        goto bail;
+    }
+    strcpy(name, ucsdet_getName(match, &status));
+    confidence = ucsdet_getConfidence(match, &status);
+    ucsdet_detectAll(csd, &matchCount, &status);
+
+    ucsdet_setText(csd, "", 0, &status);
+    for (i = 0; i < byteLength; i += 7) {
+        ucsdet_appendText(csd, bytes + i, byteLength - i < 7 ? byteLength - i : 7, &status);
+    }
+    match = ucsdet_detect(csd, &status);
+    if (U_FAILURE(status) || match == NULL) {
+        log_err("Detection failure on appended text: %s\n", u_errorName(status));
+        goto bail;
+    }
+    if (strcmp(name, ucsdet_getName(match, &status)) != 0 || confidence != ucsdet_getConfidence(match, &status)) {
+        log_err("Appended text detected as %s (%d) rather than %s (%d)\n",
+            ucsdet_getName(match, &status), ucsdet_getConfidence(match, &status), name, confidence);
+    }
+    matches = ucsdet_detectAll(csd, &i, &status);
+    if (matches == NULL || i != matchCount) {
+        log_err("ucsdet_detectAll() on appended text found %d matches rather than %d\n", i, matchCount);
+    }
+
+    /* Appending stops asking for more input after a bounded amount. */
+    ucsdet_setText(csd, "", 0, &status);
+    for (i = 0; i < 100000 && wantsMore; i += 1) {
+        wantsMore = ucsdet_appendText(csd, utf8, -1, &status);
+    }
+    if (U_FAILURE(status) || wantsMore) {
+        log_err("ucsdet_appendText() still wants more input after %d chunks: %s\n", i, u_errorName(status));
+        goto bail;
+    }
+    if (ucsdet_appendText(csd, utf8, -1, &status)) {
+        log_err("ucsdet_appendText() wants more input after reporting that it has enough\n");
+    }
+
+    /* Valid UTF-8 is certain, and detect() stops there without changing the outcome. */
+    match = ucsdet_detect(csd, &status);
+    if (match == NULL || strcmp(ucsdet_getName(match, &status), "UTF-8") != 0 ||
+            ucsdet_getConfidence(match, &status) != 100) {
+        log_err("Appended UTF-8 text was not detected as UTF-8 with full confidence\n");
+    }
+    matches = ucsdet_detectAll(csd, &matchCount, &status);
+    if (matches == NULL || matchCount < 1 || strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0) {
+        log_err("ucsdet_detectAll() after an early ucsdet_detect() did not rank UTF-8 first\n");
+    }
+
+    status = U_ZERO_ERROR;
+    ucsdet_appendText(csd, NULL, 5, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_appendText(NULL, 5) returned %s rather than U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(status));
+    }
+
+bail:
+    freeBytes(bytes);
+    ucsdet_close(csd);
+}
+
 static void TestIBM424(void)
 {
     UErrorCode status = U_ZERO_ERROR;
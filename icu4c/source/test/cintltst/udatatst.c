@@ -73,6 +73,7 @@ static void TestICUDataName(void);
 static void PointerTableOfContents(void);
 static void SetBadCommonData(void);
 static void TestUDataFileAccess(void);
+static void TestTOCIndexLookup(void);
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
 static void TestTZDataDir(void); 
 #endif
@@ -97,6 +98,7 @@ addUDataTest(TestNode** root)
     addTest(root, &PointerTableOfContents, "udatatst/PointerTableOfContents" );
     addTest(root, &SetBadCommonData, "udatatst/SetBadCommonData" );
     addTest(root, &TestUDataFileAccess, "udatatst/TestUDataFileAccess" );
+    addTest(root, &TestTOCIndexLookup, "udatatst/TestTOCIndexLookup" );
 #if !UCONFIG_NO_FORMATTING && !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestTZDataDir, "udatatst/TestTZDataDir" );
 #endif
@@ -1797,6 +1799,175 @@ static void PointerTableOfContents() {
 
 }
 
+/* Item names of the indexed test package, in ToC order. */
+static const char *const gTOCIndexNames[] = {
+    "tocidx/aa.dat",
+    "tocidx/bb.dat",
+    "tocidx/cc.dat",
+    "tocidx/" UDATA_TOC_INDEX_NAME,
+    "tocidx/zz.dat"
+};
+
+enum {
+    TOC_INDEX_ITEM_COUNT = UPRV_LENGTHOF(gTOCIndexNames),
+    TOC_INDEX_INDEX_ITEM = 3,
+    TOC_INDEX_SLOT_COUNT = 8
+};
+
+static void
+setTestDataHeader(DataHeader *pHeader, uint8_t f0, uint8_t f1, uint8_t f2, uint8_t f3) {
+    pHeader->dataHeader.headerSize = 32;
+    pHeader->dataHeader.magic1 = 0xda;
+    pHeader->dataHeader.magic2 = 0x27;
+    pHeader->info.size = sizeof(UDataInfo);
+    pHeader->info.isBigEndian = U_IS_BIG_ENDIAN;
+    pHeader->info.charsetFamily = U_CHARSET_FAMILY;
+    pHeader->info.sizeofUChar = U_SIZEOF_UCHAR;
+    pHeader->info.dataFormat[0] = f0;
+    pHeader->info.dataFormat[1] = f1;
+    pHeader->info.dataFormat[2] = f2;
+    pHeader->info.dataFormat[3] = f3;
+    pHeader->info.formatVersion[0] = 1;
+}
+
+/*
+ * Builds a "CmnD" package with a tocindex.idx item, like icupkg --toc_index,
+ * with a single bucket whose seed maps all names to distinct slots.
+ * Returns the ToC.
+ */
+static UDataOffsetTOC *
+buildTOCIndexPackage(int32_t *buffer, int32_t capacity) {
+    char *base = (char *)buffer;
+    UDataOffsetTOC *toc;
+    char *tocBase;
+    int32_t *indexes;
+    uint16_t *seeds, *slots;
+    uint32_t hashes[TOC_INDEX_ITEM_COUNT];
+    int32_t i, offset;
+    uint32_t seed;
+
+    memset(buffer, 0, capacity * 4);
+    setTestDataHeader((DataHeader *)base, 0x43, 0x6d, 0x6e, 0x44);  /* "CmnD" */
+    toc = (UDataOffsetTOC *)(base + 32);
+    tocBase = (char *)toc;
+    toc->count = TOC_INDEX_ITEM_COUNT;
+    offset = 4 + 8 * TOC_INDEX_ITEM_COUNT;
+    for (i = 0; i < TOC_INDEX_ITEM_COUNT; ++i) {
+        toc->entry[i].nameOffset = offset;
+        strcpy(tocBase + offset, gTOCIndexNames[i]);
+        offset += (int32_t)strlen(gTOCIndexNames[i]) + 1;
+    }
+    for (i = 0; i < TOC_INDEX_ITEM_COUNT; ++i) {
+        offset = (offset + 15) & ~15;
+        toc->entry[i].dataOffset = offset;
+        /* Each plain item is 16 bytes with its number, the index item is 96 bytes. */
+        if (i == TOC_INDEX_INDEX_ITEM) {
+            offset += 96;
+        } else {
+            tocBase[offset] = (char)i;
+            offset += 16;
+        }
+    }
+    if (32 + offset > capacity * 4) {
+        log_err("TestTOCIndexLookup buffer too small\n");
+        return NULL;
+    }
+
+    setTestDataHeader((DataHeader *)(tocBase + toc->entry[TOC_INDEX_INDEX_ITEM].dataOffset),
+                      0x54, 0x6f, 0x43, 0x49);  /* "ToCI" */
+    indexes = (int32_t *)(tocBase + toc->entry[TOC_INDEX_INDEX_ITEM].dataOffset + 32);
+    indexes[UDATA_TOC_INDEX_IX_INDEXES_LENGTH] = UDATA_TOC_INDEX_IX_COUNT;
+    indexes[UDATA_TOC_INDEX_IX_ITEM_COUNT] = TOC_INDEX_ITEM_COUNT;
+    indexes[UDATA_TOC_INDEX_IX_BUCKET_COUNT] = 1;
+    indexes[UDATA_TOC_INDEX_IX_SLOT_COUNT] = TOC_INDEX_SLOT_COUNT;
+    indexes[UDATA_TOC_INDEX_IX_HASH_SEED] = 0;
+    indexes[UDATA_TOC_INDEX_IX_CHECKSUM] = (int32_t)udata_checksumTOC(toc->entry, TOC_INDEX_ITEM_COUNT);
+    seeds = (uint16_t *)(indexes + UDATA_TOC_INDEX_IX_COUNT);
+    slots = seeds + 1;
+    for (i = 0; i < TOC_INDEX_ITEM_COUNT; ++i) {
+        hashes[i] = udata_hashTOCName(gTOCIndexNames[i], 0);
+    }
+    for (seed = 0; seed <= 0xffff; ++seed) {
+        UBool distinct = TRUE;
+        for (i = 0; i < TOC_INDEX_SLOT_COUNT; ++i) {
+            slots[i] = 0xffff;
+        }
+        for (i = 0; i < TOC_INDEX_ITEM_COUNT && distinct; ++i) {
+            int32_t slot = udata_getTOCIndexSlot(hashes[i], seed, TOC_INDEX_SLOT_COUNT);
+            if (slots[slot] == 0xffff) {
+                slots[slot] = (uint16_t)i;
+            } else {
+                distinct = FALSE;
+            }
+        }
+        if (distinct) {
+            seeds[0] = (uint16_t)seed;
+            return toc;
+        }
+    }
+    log_err("TestTOCIndexLookup found no seed for the hash index\n");
+    return NULL;
+}
+
+static const DataHeader *
+lookUpTOCItem(const UDataMemory *pData, const char *name) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length;
+    const DataHeader *pHeader = pData->vFuncs->Lookup(pData, name, &length, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_err("Lookup(%s) failed - %s\n", name, u_errorName(errorCode));
+    }
+    return pHeader;
+}
+
+/* Looks up items in a package whose ToC has a hash index, see ucmndata.h. */
+static void TestTOCIndexLookup(void) {
+    static const char *const missingNames[] = {
+        "tocidx/ab.dat", "tocidx/zzz.dat", "tocidx/aa.da", "tocidx/", "other/aa.dat", "aa.dat", ""
+    };
+    int32_t buffer[128];
+    UDataMemory udm;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UDataOffsetTOC *toc = buildTOCIndexPackage(buffer, UPRV_LENGTHOF(buffer));
+    const char *tocBase = (const char *)toc;
+    int32_t i, pass;
+    if (toc == NULL) {
+        return;
+    }
+
+    /* Pass 0 uses the index; pass 1 has a stale index and uses the binary search. */
+    for (pass = 0; pass < 2; ++pass) {
+        UDataMemory_init(&udm);
+        UDataMemory_setData(&udm, buffer);
+        udata_checkCommonData(&udm, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            log_err("udata_checkCommonData(indexed package) failed - %s\n", u_errorName(errorCode));
+            return;
+        }
+        if (pass == 0 ? udm.tocIndex == NULL : udm.tocIndex != NULL) {
+            log_err("pass %d: the ToC index is %s\n", (int)pass, pass == 0 ? "not used" : "used although stale");
+        }
+
+        /* The first and last entries, and all others in between. */
+        for (i = 0; i < TOC_INDEX_ITEM_COUNT; ++i) {
+            const DataHeader *pHeader = lookUpTOCItem(&udm, gTOCIndexNames[i]);
+            if (pHeader != (const DataHeader *)(tocBase + toc->entry[i].dataOffset)) {
+                log_err("pass %d: Lookup(%s) did not return item %d\n", (int)pass, gTOCIndexNames[i], (int)i);
+            } else if (i != TOC_INDEX_INDEX_ITEM && *(const char *)pHeader != (char)i) {
+                log_err("pass %d: Lookup(%s) returned the wrong contents\n", (int)pass, gTOCIndexNames[i]);
+            }
+        }
+        for (i = 0; i < UPRV_LENGTHOF(missingNames); ++i) {
+            if (lookUpTOCItem(&udm, missingNames[i]) != NULL) {
+                log_err("pass %d: Lookup(%s) found a missing item\n", (int)pass, missingNames[i]);
+            }
+        }
+
+        /* Modify the ToC checksum as if the package had been changed without updating the index. */
+        ((int32_t *)(tocBase + toc->entry[TOC_INDEX_INDEX_ITEM].dataOffset + 32))[UDATA_TOC_INDEX_IX_CHECKSUM] ^= 1;
+    }
+}
+
 static void SetBadCommonData(void) {
     /* It's difficult to test that udata_setCommonData really works within the test framework.
        So we just test that foolish people can't do bad things. */
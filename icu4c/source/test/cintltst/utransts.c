@@ -775,6 +775,33 @@ static void _expect(const UTransliterator* trans,
                 id, cfrom, actual, cto);
     }
 
+    /* utrans_transUCharsToBuffer() */
+    {
+        UChar dest[CAP];
+        int32_t destLength = utrans_transUCharsToBuffer(trans, from, -1, dest, CAP, &status);
+        if (U_FAILURE(status)) {
+            log_err("FAIL: utrans_transUCharsToBuffer() failed, error=%s\n",
+                    u_errorName(status));
+            return;
+        }
+        if (destLength == u_strlen(to) && 0 == u_strcmp(dest, to)) {
+            log_verbose("Ok: utrans_transUCharsToBuffer(%s) x %s -> %s\n",
+                        id, cfrom, cto);
+        } else {
+            char actual[CAP];
+            u_austrcpy(actual, dest);
+            log_err("FAIL: utrans_transUCharsToBuffer(%s) x %s -> %s, expected %s\n",
+                    id, cfrom, actual, cto);
+        }
+        /* preflighting */
+        destLength = utrans_transUCharsToBuffer(trans, from, -1, NULL, 0, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR || destLength != u_strlen(to)) {
+            log_err("FAIL: utrans_transUCharsToBuffer(%s, preflighting) -> %d %s, expected %d\n",
+                    id, (int)destLength, u_errorName(status), (int)u_strlen(to));
+        }
+        status = U_ZERO_ERROR;
+    }
+
     /* utrans_transIncrementalUChars() */
     u_strcpy(buf, from);
     pos.start = pos.contextStart = 0;
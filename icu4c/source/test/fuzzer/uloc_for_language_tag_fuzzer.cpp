@@ -1,10 +1,14 @@
 // © 2019 and later: Unicode, Inc. and others.
 // License & terms of use: http://www.unicode.org/copyright.html
 
+#include <cstdlib>
+#include <cstring>
 #include <string>
 
 #include "locale_util.h"
+#include "unicode/bytestream.h"
 #include "unicode/uloc.h"
+#include "ulocimp.h"
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
   // Full locale id.
@@ -14,8 +18,47 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
   const std::string input = MakeZeroTerminatedInput(data, size);
 
   UErrorCode status = U_ZERO_ERROR;
-  uloc_forLanguageTag(input.c_str(), locale_id, locale_id_capacity, nullptr,
-                      &status);
+  int32_t parsed_length = 0;
+  int32_t length = uloc_forLanguageTag(input.c_str(), locale_id,
+                                       locale_id_capacity, &parsed_length,
+                                       &status);
+
+  // The fast path for simple tags must yield the same results as the full
+  // parser.
+  char full_locale_id[ULOC_FULLNAME_CAPACITY];
+  UErrorCode full_status = U_ZERO_ERROR;
+  int32_t full_parsed_length = 0;
+  icu::CheckedArrayByteSink sink(full_locale_id, ULOC_FULLNAME_CAPACITY);
+  ulocimp_forLanguageTagFull(input.c_str(), -1, sink, &full_parsed_length,
+                             &full_status);
+  int32_t full_length = sink.NumberOfBytesAppended();
+  if (U_SUCCESS(full_status) && sink.Overflowed()) {
+    full_status = U_BUFFER_OVERFLOW_ERROR;
+  }
+  if (U_FAILURE(status) != U_FAILURE(full_status) ||
+      length != full_length || parsed_length != full_parsed_length ||
+      (U_SUCCESS(status) &&
+       std::memcmp(locale_id, full_locale_id, length) != 0)) {
+    std::abort();
+  }
+
+  // Same for the reverse direction, using the input as a locale ID.
+  std::string tag, full_tag;
+  icu::StringByteSink<std::string> tag_sink(&tag);
+  icu::StringByteSink<std::string> full_tag_sink(&full_tag);
+  for (UBool strict : {FALSE, TRUE}) {
+    UErrorCode tag_status = U_ZERO_ERROR;
+    full_status = U_ZERO_ERROR;
+    tag.clear();
+    full_tag.clear();
+    ulocimp_toLanguageTag(input.c_str(), tag_sink, strict, &tag_status);
+    ulocimp_toLanguageTagFull(input.c_str(), full_tag_sink, strict,
+                              &full_status);
+    if (tag_status != full_status ||
+        (U_SUCCESS(tag_status) && tag != full_tag)) {
+      std::abort();
+    }
+  }
 
   return 0;
 }
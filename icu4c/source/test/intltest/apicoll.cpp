@@ -48,6 +48,10 @@
 #include "sfwdchit.h"
 #include "cmemory.h"
 #include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 void
 CollationAPITest::doAssert(UBool condition, const char *message)
@@ -2517,6 +2521,99 @@ void CollationAPITest::TestGapTooSmall() {
     }
 }
 
+namespace {
+
+// Runs the tasks on a few threads.
+void U_CALLCONV threadExecutor(void *executorContext,
+                               UCollationTask *task, void *taskContext, int32_t taskCount) {
+    std::atomic<int32_t> &maxConcurrency = *static_cast<std::atomic<int32_t> *>(executorContext);
+    std::atomic<int32_t> nextTask(0);
+    std::vector<std::thread> threads;
+    int32_t threadCount = std::min(taskCount, (int32_t)4);
+    if(threadCount > maxConcurrency) { maxConcurrency = threadCount; }
+    for(int32_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            int32_t i;
+            while((i = nextTask++) < taskCount) {
+                task(taskContext, i);
+            }
+        });
+    }
+    for(std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+void CollationAPITest::TestSort() {
+    IcuTestErrorCode errorCode(*this, "TestSort");
+    LocalPointer<Collator> coll(Collator::createInstance("de", errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(de)")) {
+        return;
+    }
+    // Many strings with a small alphabet, so that there are long common prefixes,
+    // and with canonically equivalent variants that compare equal,
+    // which must keep their relative order.
+    static const char16_t *const pieces[] = {
+        u"a", u"A", u"\u00e4", u"a\u0308", u"b", u"ss", u"\u00df", u"-", u" ",
+        u"\u0430", u"\u4e00", u"1", u"10", u"\U0001F600", u"\u00C5", u"\u212B"
+    };
+    UnicodeString unescaped[UPRV_LENGTHOF(pieces)];
+    for(int32_t i = 0; i < UPRV_LENGTHOF(pieces); ++i) {
+        unescaped[i] = UnicodeString(pieces[i]).unescape();
+    }
+    uint32_t seed = 12345;
+    std::vector<UnicodeString> strings;
+    for(int32_t i = 0; i < 10000; ++i) {
+        UnicodeString s;
+        seed = seed * 1103515245 + 12345;
+        int32_t length = (seed >> 16) % 12;
+        for(int32_t j = 0; j < length; ++j) {
+            seed = seed * 1103515245 + 12345;
+            s.append(unescaped[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+        }
+        strings.push_back(s);
+    }
+
+    for(int32_t count : { 0, 1, 50, 5000, 10000 }) {
+        std::vector<UnicodeString> expected(strings.begin(), strings.begin() + count);
+        std::stable_sort(expected.begin(), expected.end(),
+                         [&](const UnicodeString &left, const UnicodeString &right) {
+            return coll->compare(left, right, errorCode) < 0;
+        });
+        for(int32_t withExecutor = 0; withExecutor <= 1; ++withExecutor) {
+            std::vector<UnicodeString> sorted(strings.begin(), strings.begin() + count);
+            std::atomic<int32_t> maxConcurrency(0);
+            coll->sort(sorted.data(), count,
+                       withExecutor ? threadExecutor : nullptr, &maxConcurrency, errorCode);
+            if(errorCode.errIfFailureAndReset("Collator::sort(%d strings)", (int)count)) {
+                continue;
+            }
+            for(int32_t i = 0; i < count; ++i) {
+                if(sorted[i] != expected[i]) {
+                    errln("Collator::sort(%d strings, executor=%d) differs from std::stable_sort at %d",
+                          (int)count, (int)withExecutor, (int)i);
+                    break;
+                }
+            }
+            if(withExecutor && count >= 5000 && maxConcurrency < 2) {
+                errln("Collator::sort(%d strings) did not run concurrent tasks", (int)count);
+            }
+        }
+    }
+
+    // Bogus strings sort like empty ones.
+    UnicodeString withBogus[3] = { u"b", UnicodeString(), u"a" };
+    withBogus[1].setToBogus();
+    coll->sort(withBogus, 3, nullptr, nullptr, errorCode);
+    assertSuccess("Collator::sort(with bogus string)", errorCode);
+    assertTrue("bogus string sorts first", withBogus[0].isBogus());
+    assertEquals("then a", u"a", withBogus[1]);
+    coll->sort(nullptr, 3, nullptr, nullptr, errorCode);
+    assertEquals("Collator::sort(NULL)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
  void CollationAPITest::dump(UnicodeString msg, RuleBasedCollator* c, UErrorCode& status) {
     const char* bigone = "One";
     const char* littleone = "one";
@@ -2560,6 +2657,7 @@ void CollationAPITest::runIndexedTest( int32_t index, UBool exec, const char* &n
     TESTCASE_AUTO(TestIterNumeric);
     TESTCASE_AUTO(TestBadKeywords);
     TESTCASE_AUTO(TestGapTooSmall);
+    TESTCASE_AUTO(TestSort);
     TESTCASE_AUTO_END;
 }
 
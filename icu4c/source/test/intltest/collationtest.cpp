@@ -71,6 +71,7 @@ class CollationTest : public IntlTest {
     void TestImplicits();
     void TestNulTerminated();
     void TestIllegalUTF8();
+    void TestUTF8ASCIIRuns();
     void TestShortFCDData();
     void TestFCD();
     void TestCollationWeights();
@@ -141,6 +142,7 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestImplicits);
     TESTCASE_AUTO(TestNulTerminated);
     TESTCASE_AUTO(TestIllegalUTF8);
+    TESTCASE_AUTO(TestUTF8ASCIIRuns);
     TESTCASE_AUTO(TestShortFCDData);
     TESTCASE_AUTO(TestFCD);
     TESTCASE_AUTO(TestCollationWeights);
@@ -315,6 +317,78 @@ void CollationTest::TestIllegalUTF8() {
     }
 }
 
+void CollationTest::TestUTF8ASCIIRuns() {
+    IcuTestErrorCode errorCode(*this, "TestUTF8ASCIIRuns");
+    const CollationData *data = CollationRoot::getData(errorCode);
+    if(errorCode.errDataIfFailureAndReset("CollationRoot::getData()")) {
+        return;
+    }
+
+    // ASCII runs longer than the UTF-8 iterators' lookahead,
+    // ending with characters that need the normal code path:
+    // digits (numeric), combining marks (FCD, contractions), U+0000, non-ASCII.
+    UnicodeString s(
+        u"The quick brown fox jumps over the lazy dog 0123456789 and 42 cats; "
+        u"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZa\u0301b\u0327\u0308c "
+        u"----------------------------\\u0000--------------------L\u00b7l\u00b7x"
+        u"\u0430\u0436 a\u0f73 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~\u4e00xyz");
+    s = s.unescape();
+    std::string utf8;
+    s.toUTF8String(utf8);
+    const uint8_t *u8 = reinterpret_cast<const uint8_t *>(utf8.c_str());
+    int32_t u8Length = (int32_t)utf8.length();
+    int32_t u8NulIndex = (int32_t)uprv_strlen(utf8.c_str());
+    const UChar *u16 = s.getTerminatedBuffer();
+
+    for(int32_t numeric = 0; numeric <= 1; ++numeric) {
+        UTF16CollationIterator u16ci(data, numeric, u16, u16, u16 + s.length());
+        UTF8CollationIterator u8ci(data, numeric, u8, 0, u8Length);
+        FCDUTF16CollationIterator fcd16ci(data, numeric, u16, u16, u16 + s.length());
+        FCDUTF8CollationIterator fcd8ci(data, numeric, u8, 0, u8Length);
+        for(int32_t i = 0;; ++i) {
+            int64_t ce = u16ci.nextCE(errorCode);
+            int64_t u8ce = u8ci.nextCE(errorCode);
+            int64_t fcd16ce = fcd16ci.nextCE(errorCode);
+            int64_t fcd8ce = fcd8ci.nextCE(errorCode);
+            if(errorCode.errIfFailureAndReset("CollationIterator.nextCE()")) {
+                return;
+            }
+            if(u8ce != ce) {
+                errln("numeric=%d: UTF8CollationIterator.nextCE() != UTF-16 at CE %d",
+                      (int)numeric, (int)i);
+                break;
+            }
+            if(fcd8ce != fcd16ce) {
+                errln("numeric=%d: FCDUTF8CollationIterator.nextCE() != UTF-16 at CE %d",
+                      (int)numeric, (int)i);
+                break;
+            }
+            if(ce == Collation::NO_CE) { break; }
+        }
+
+        // NUL-terminated: Stop at the U+0000 after the run of hyphens.
+        UTF16CollationIterator nul16ci(data, numeric, u16, u16, NULL);
+        UTF8CollationIterator nul8ci(data, numeric, u8, 0, -1);
+        FCDUTF8CollationIterator nulFCD8ci(data, numeric, u8, 0, -1);
+        for(int32_t i = 0;; ++i) {
+            int64_t ce = nul16ci.nextCE(errorCode);
+            int64_t u8ce = nul8ci.nextCE(errorCode);
+            int64_t fcd8ce = nulFCD8ci.nextCE(errorCode);
+            if(errorCode.errIfFailureAndReset("CollationIterator.nextCE()")) {
+                return;
+            }
+            if(u8ce != ce || fcd8ce != ce) {
+                errln("numeric=%d: UTF-8 NUL-terminated nextCE() != UTF-16 at CE %d",
+                      (int)numeric, (int)i);
+                break;
+            }
+            if(ce == Collation::NO_CE) { break; }
+        }
+        assertEquals("UTF8CollationIterator stops at the NUL terminator",
+                     u8NulIndex, nul8ci.getOffset());
+    }
+}
+
 namespace {
 
 void addLeadSurrogatesForSupplementary(const UnicodeSet &src, UnicodeSet &dest) {
@@ -1405,7 +1479,7 @@ UBool CollationTest::getCollationKey(const char *norm, const UnicodeString &line
     for(int32_t psi = 0; psi < UPRV_LENGTHOF(partSizes); ++psi) {
         int32_t partSize = partSizes[psi];
         CharString parts;
-        if(!getSortKeyParts(s, length, parts, 32, errorCode)) {
+        if(!getSortKeyParts(s, length, parts, partSize, errorCode)) {
             infoln(fileTestName);
             errln("Collator(%s).internalNextSortKeyPart(%d) failed: %s",
                   norm, (int)partSize, errorCode.errorName());
@@ -44,6 +44,7 @@ void IntlTestDateTimePatternGeneratorAPI::runIndexedTest( int32_t index, UBool e
         TESTCASE(8, test20640_HourCyclArsEnNH);
         TESTCASE(9, testFallbackWithDefaultRootLocale);
         TESTCASE(10, testGetDefaultHourCycle_OnEmptyInstance);
+        TESTCASE(11, testCachedInstances);
         default: name = ""; break;
     }
 }
@@ -1507,4 +1508,58 @@ void IntlTestDateTimePatternGeneratorAPI::testGetDefaultHourCycle_OnEmptyInstanc
     }
 }
 
+// createInstance() returns copies of a cached generator, and getBestPattern() remembers its results.
+void IntlTestDateTimePatternGeneratorAPI::testCachedInstances() {
+    IcuTestErrorCode status(*this, "testCachedInstances");
+    static const char *const localeIDs[] = { "en", "ja", "de_CH", "ar_EG", "zh@calendar=chinese", "en@hours=h23" };
+    static const char16_t *const skeletons[] = { u"yMMMd", u"jmm", u"Jms", u"Cm", u"yMMMdjmm", u"GyMMMEd" };
+    for (const char *localeID : localeIDs) {
+        status.setScope(localeID);
+        Locale locale(localeID);
+        LocalPointer<DateTimePatternGenerator> loaded(
+            DateTimePatternGenerator::internalMakeInstance(locale, status));
+        LocalPointer<DateTimePatternGenerator> cached(DateTimePatternGenerator::createInstance(locale, status));
+        LocalPointer<DateTimePatternGenerator> cached2(DateTimePatternGenerator::createInstance(locale, status));
+        if (status.errDataIfFailureAndReset("createInstance()")) { continue; }
+        assertTrue("cached == loaded", *cached == *loaded);
+        assertTrue("separate instances", cached.getAlias() != cached2.getAlias());
+        assertEquals("default hour cycle", (int32_t)loaded->getDefaultHourCycle(status),
+                     (int32_t)cached->getDefaultHourCycle(status));
+        for (const char16_t *skeleton : skeletons) {
+            UnicodeString expected = loaded->getBestPattern(skeleton, status);
+            // Twice: The second call returns the remembered pattern.
+            assertEquals(UnicodeString(u"getBestPattern ") + skeleton, expected,
+                         cached->getBestPattern(skeleton, status));
+            assertEquals(UnicodeString(u"getBestPattern again ") + skeleton, expected,
+                         cached->getBestPattern(skeleton, status));
+        }
+    }
+
+    // Setters must not return stale patterns, and must not affect other instances.
+    status.setScope("");
+    LocalPointer<DateTimePatternGenerator> dtpg(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    if (status.errDataIfFailureAndReset("createInstance(en)")) { return; }
+    assertEquals("yMMMd", u"MMM d, y", dtpg->getBestPattern(u"yMMMd", status));
+    assertEquals("yMMMd with hour length", u"MMM d, y",
+                 dtpg->getBestPattern(u"yMMMd", UDATPG_MATCH_HOUR_FIELD_LENGTH, status));
+    UnicodeString conflictingPattern;
+    dtpg->addPattern(u"d. MMM y", TRUE, conflictingPattern, status);
+    assertEquals("after addPattern", u"d. MMM y", dtpg->getBestPattern(u"yMMMd", status));
+    assertEquals("yMMMdHm", u"d. MMM y, HH:mm", dtpg->getBestPattern(u"yMMMdHm", status));
+    dtpg->setDateTimeFormat(u"{1} 'um' {0}");
+    assertEquals("after setDateTimeFormat", u"d. MMM y 'um' HH:mm", dtpg->getBestPattern(u"yMMMdHm", status));
+    assertEquals("MMMdw", u"MMM d ('week': w)", dtpg->getBestPattern(u"MMMdw", status));
+    dtpg->setAppendItemFormat(UDATPG_WEEK_OF_YEAR_FIELD, u"{0} [{2}: {1}]");
+    assertEquals("after setAppendItemFormat", u"MMM d ['week': w]", dtpg->getBestPattern(u"MMMdw", status));
+    dtpg->setAppendItemName(UDATPG_WEEK_OF_YEAR_FIELD, u"Wk");
+    assertEquals("after setAppendItemName", u"MMM d ['Wk': w]", dtpg->getBestPattern(u"MMMdw", status));
+    assertEquals("sSSS", u"s.SSS", dtpg->getBestPattern(u"sSSS", status));
+    dtpg->setDecimal(u",");
+    assertEquals("after setDecimal", u"s,SSS", dtpg->getBestPattern(u"sSSS", status));
+
+    LocalPointer<DateTimePatternGenerator> fresh(DateTimePatternGenerator::createInstance(Locale::getEnglish(), status));
+    assertEquals("fresh instance", u"MMM d, y", fresh->getBestPattern(u"yMMMd", status));
+    assertEquals("fresh instance decimal", u"s.SSS", fresh->getBestPattern(u"sSSS", status));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
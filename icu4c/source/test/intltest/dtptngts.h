@@ -36,6 +36,7 @@ class IntlTestDateTimePatternGeneratorAPI : public IntlTest {
     void test20640_HourCyclArsEnNH();
     void testFallbackWithDefaultRootLocale();
     void testGetDefaultHourCycle_OnEmptyInstance();
+    void testCachedInstances();
 };
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -77,6 +77,7 @@ void IntlTestRBNF::runIndexedTest(int32_t index, UBool exec, const char* &name,
         TESTCASE(25, TestCompactDecimalFormatStyle);
         TESTCASE(26, TestParseFailure);
         TESTCASE(27, TestMinMaxIntegerDigitsIgnored);
+        TESTCASE(28, TestRuleTextOrder);
 #else
         TESTCASE(0, TestRBNFDisabled);
 #endif
@@ -2320,6 +2321,54 @@ void IntlTestRBNF::TestMinMaxIntegerDigitsIgnored() {
     }
 }
 
+void IntlTestRBNF::TestRuleTextOrder() {
+    IcuTestErrorCode status(*this, "TestRuleTextOrder");
+
+    // Rule text before, between and after substitutions, adjacent substitutions,
+    // and plural patterns on either side of a substitution. Fraction digits are
+    // inserted one at a time, and appending to a non-empty string must not
+    // change the result.
+    UnicodeString rules(
+        u"%main:\n"
+        u"-x: minus >>;\n"
+        u"x.x: << point >>;\n"
+        u"0: zero; 1: one; 2: two; 3: three; 4: four; 5: five; 6: six; 7: seven; 8: eight; 9: nine;\n"
+        u"10: <<>>;\n"
+        u"100: <<-$(cardinal,one{hundred}other{hundreds})$[->>];\n"
+        u"1000: $(cardinal,one{thousand}other{thousands})$ of <<[, >>];\n");
+    UParseError perror;
+    RuleBasedNumberFormat rbnf(rules, Locale::getEnglish(), perror, status);
+    if (status.errIfFailureAndReset()) {
+        return;
+    }
+    static const struct {
+        double number;
+        const char16_t *expected;
+    } cases[] = {
+        {7, u"seven"},
+        {23, u"twothree"},
+        {100, u"one-hundred"},
+        {213, u"two-hundreds-onethree"},
+        {1000, u"thousand of one"},
+        {2213, u"thousands of two, two-hundreds-onethree"},
+        {-2005, u"minus thousands of two, five"},
+        {0.25, u"zero point two five"},
+        {12.05, u"onetwo point zero five"},
+        {1234.5, u"thousand of one, two-hundreds-threefour point five"},
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); i++) {
+        UnicodeString result(u"> ");
+        rbnf.format(cases[i].number, result, status);
+        assertEquals(UnicodeString(u"double ") + cases[i].number,
+                     UnicodeString(u"> ") + cases[i].expected, result);
+        if (cases[i].number == uprv_floor(cases[i].number)) {
+            result.remove();
+            rbnf.format(static_cast<int64_t>(cases[i].number), result, status);
+            assertEquals(UnicodeString(u"int64 ") + cases[i].number, cases[i].expected, result);
+        }
+    }
+}
+
 void 
 IntlTestRBNF::doTest(RuleBasedNumberFormat* formatter, const char* const testData[][2], UBool testParsing) 
 {
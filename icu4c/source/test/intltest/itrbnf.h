@@ -149,6 +149,7 @@ class IntlTestRBNF : public IntlTest {
     void TestCompactDecimalFormatStyle();
     void TestParseFailure();
     void TestMinMaxIntegerDigitsIgnored();
+    void TestRuleTextOrder();
 
 protected:
   virtual void doTest(RuleBasedNumberFormat* formatter, const char* const testData[][2], UBool testParsing);
@@ -36,6 +36,7 @@
 
 extern IntlTest *createBytesTrieTest();
 extern IntlTest *createLocaleMatcherTest();
+extern IntlTest *createPackageTest();
 static IntlTest *createLocalPointerTest();
 extern IntlTest *createUCharsTrieTest();
 static IntlTest *createEnumSetTest();
@@ -80,6 +81,7 @@ void IntlTestUtilities::runIndexedTest( int32_t index, UBool exec, const char* &
 #endif
     TESTCASE_AUTO_CLASS(LocaleBuilderTest);
     TESTCASE_AUTO_CREATE_CLASS(LocaleMatcherTest);
+    TESTCASE_AUTO_CREATE_CLASS(PackageTest);
     TESTCASE_AUTO_END;
 }
 
@@ -17,6 +17,7 @@
 */
 
 #include "listformattertest.h"
+#include "unicode/simpleformatter.h"
 #include "unicode/ulistformatter.h"
 #include "cmemory.h"
 #include <string.h>
@@ -47,6 +48,7 @@ void ListFormatterTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestDifferentStyles);
     TESTCASE_AUTO(TestBadStylesFail);
     TESTCASE_AUTO(TestCreateStyled);
+    TESTCASE_AUTO(TestLongLists);
     TESTCASE_AUTO_END;
 }
 
@@ -622,4 +624,106 @@ void ListFormatterTest::TestCreateStyled() {
     }
 }
 
+namespace {
+// Formats the list by applying the patterns pairwise, one item at a time.
+UnicodeString joinPairwise(const ListFormatData &data, const UnicodeString items[], int32_t nItems,
+                           UErrorCode &status) {
+    SimpleFormatter two(data.twoPattern, status);
+    SimpleFormatter start(data.startPattern, status);
+    SimpleFormatter middle(data.middlePattern, status);
+    SimpleFormatter end(data.endPattern, status);
+    UnicodeString result(items[0]);
+    for (int32_t i = 1; i < nItems; ++i) {
+        const SimpleFormatter &pattern =
+            i == 1 ? (nItems == 2 ? two : start) : (i == nItems - 1 ? end : middle);
+        UnicodeString next;
+        pattern.format(result, items[i], next, status);
+        result = next;
+    }
+    return result;
+}
+}  // namespace
+
+void ListFormatterTest::TestLongLists() {
+    IcuTestErrorCode status(*this, "TestLongLists");
+    const int32_t kMaxItems = 60;
+    UnicodeString items[kMaxItems];
+    for (int32_t i = 0; i < kMaxItems; ++i) {
+        items[i] = UnicodeString(u"<") + Int64ToUnicodeString(i) + u">";
+    }
+    const ListFormatData datas[] = {
+        {u"{0} & {1}", u"({0}, {1}", u"{0}; {1}", u"{0} + {1})"},
+        // {1} before {0}, as in some locales.
+        {u"{1} after {0}", u"[{1} after the first {0}", u"{1} after {0}", u"{1} at last after {0}]"},
+        {u"{0} and {1}", u"{1} then {0}", u"{0}, {1}", u"finally {1}, {0}"},
+        // Repeated arguments cannot be preparsed and use the pairwise fallback.
+        {u"{0} and {1}", u"{0}, {1}", u"{0}, {1}", u"{0}, and {1} ({0})"},
+    };
+    for (int32_t d = 0; d < UPRV_LENGTHOF(datas); ++d) {
+        ListFormatter formatter(datas[d], status);
+        if (status.errIfFailureAndReset("data %d", (int)d)) {
+            continue;
+        }
+        for (int32_t n = 2; n <= kMaxItems; ++n) {
+            UnicodeString expected = joinPairwise(datas[d], items, n, status);
+            for (int32_t index = 0; index < n; index += 7) {
+                UnicodeString actual(prefix);
+                int32_t offset = -2;
+                formatter.format(items, n, actual, index, offset, status);
+                if (status.errIfFailureAndReset("data %d n %d", (int)d, (int)n)) {
+                    continue;
+                }
+                assertEquals(UnicodeString(u"format data ") + d + u" n " + n,
+                             prefix + expected, actual);
+                if (d < 3) {
+                    assertEquals(UnicodeString(u"offset data ") + d + u" n " + n + u" index " + index,
+                                 actual.indexOf(items[index]), offset);
+                }
+            }
+
+            if (d == 3) {
+                continue;
+            }
+            FormattedList result = formatter.formatStringsToValue(items, n, status);
+            UnicodeString string = result.toString(status);
+            assertEquals(UnicodeString(u"toString data ") + d + u" n " + n, expected, string);
+            ConstrainedFieldPosition cfpos;
+            cfpos.constrainCategory(UFIELD_CATEGORY_LIST);
+            int32_t elements = 0;
+            int32_t covered = 0;
+            while (result.nextPosition(cfpos, status)) {
+                UnicodeString text = string.tempSubStringBetween(cfpos.getStart(), cfpos.getLimit());
+                if (cfpos.getField() == ULISTFMT_ELEMENT_FIELD) {
+                    ++elements;
+                    assertTrue("element field is an item",
+                               text.charAt(0) == u'<' && text.charAt(text.length() - 1) == u'>');
+                } else {
+                    assertEquals("literal field is not an item", -1, text.indexOf(u'<'));
+                }
+                covered += text.length();
+            }
+            assertEquals(UnicodeString(u"elements data ") + d + u" n " + n, n, elements);
+            assertEquals(UnicodeString(u"fields cover data ") + d + u" n " + n, string.length(), covered);
+        }
+    }
+
+    // Formatting into a string which is also one of the items.
+    ListFormatter formatter(datas[1], status);
+    UnicodeString aliased[3] = {u"x", u"y", u"z"};
+    formatter.format(aliased, 3, aliased[1], status);
+    assertEquals("aliased appendTo", u"yz at last after [y after the first x]", aliased[1]);
+
+    LocalPointer<ListFormatter> en(ListFormatter::createInstance("en", status));
+    if (status.errDataIfFailureAndReset()) {
+        return;
+    }
+    UnicodeString expected;
+    for (int32_t i = 0; i < kMaxItems - 1; ++i) {
+        expected.append(items[i]).append(u", ");
+    }
+    expected.append(u"and ").append(items[kMaxItems - 1]);
+    UnicodeString actual;
+    assertEquals("en long list", expected, en->format(items, kMaxItems, actual, status));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
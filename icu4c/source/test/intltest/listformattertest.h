@@ -54,6 +54,7 @@ class ListFormatterTest : public IntlTestWithFieldPosition {
     void TestDifferentStyles();
     void TestBadStylesFail();
     void TestCreateStyled();
+    void TestLongLists();
 
   private:
     void CheckFormatting(
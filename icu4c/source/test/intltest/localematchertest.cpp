@@ -59,6 +59,7 @@ class LocaleMatcherTest : public IntlTest {
     void testUnsupportedDefault();
     void testDemotion();
     void testDirection();
+    void testCache();
     void testMatch();
     void testResolvedLocale();
     void testDataDriven();
@@ -83,6 +84,7 @@ void LocaleMatcherTest::runIndexedTest(int32_t index, UBool exec, const char *&n
     TESTCASE_AUTO(testUnsupportedDefault);
     TESTCASE_AUTO(testDemotion);
     TESTCASE_AUTO(testDirection);
+    TESTCASE_AUTO(testCache);
     TESTCASE_AUTO(testMatch);
     TESTCASE_AUTO(testResolvedLocale);
     TESTCASE_AUTO(testDataDriven);
@@ -349,6 +351,64 @@ void LocaleMatcherTest::testDirection() {
     }
 }
 
+void LocaleMatcherTest::testCache() {
+    IcuTestErrorCode errorCode(*this, "testCache");
+    LocaleMatcher::Builder builder;
+    builder.setSupportedLocalesFromListString("en, en-GB, fr, de-CH, es-419, pt-PT, zh-Hant, sr-Latn");
+    LocaleMatcher uncached = builder.build(errorCode);
+    if (errorCode.errIfFailureAndReset("LocaleMatcher::Builder::build()")) { return; }
+    static const char *const lists[] = {
+        "en-US,en;q=0.9",
+        "de-AT, de;q=0.8, en;q=0.5",
+        "es-MX,es;q=0.9,en;q=0.5",
+        "zh-HK, zh;q=0.5",
+        "sr-Latn-RS",
+        "pt-BR",
+        "ja, ko;q=0.5",
+        "",
+        "en-US,en;q=0.9",
+        "x-private",
+        "fr-CA, en-GB;q=0.9",
+        "en-XA, en;q=0.1"
+    };
+    // Up to 8 entries are fewer than the inputs, so that some entries are removed
+    // and added again, down to one entry per cache shard or fewer.
+    static const int32_t cacheSizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, INT32_MAX };
+    for (int32_t cacheSize : cacheSizes) {
+        LocaleMatcher cached = builder.setCacheSize(cacheSize).build(errorCode);
+        if (errorCode.errIfFailureAndReset("LocaleMatcher::Builder::build(cacheSize=%d)", (int)cacheSize)) {
+            continue;
+        }
+        for (int32_t round = 0; round < 3; ++round) {
+            for (const char *list : lists) {
+                assertEquals(UnicodeString(u"cached list ") + list + u" cacheSize=" + cacheSize,
+                             locString(uncached.getBestMatchForListString(list, errorCode)),
+                             locString(cached.getBestMatchForListString(list, errorCode)));
+                Locale desired = Locale::forLanguageTag(list, errorCode);
+                if (errorCode.isFailure()) {
+                    errorCode.reset();
+                    continue;
+                }
+                assertEquals(UnicodeString(u"cached locale ") + list + u" cacheSize=" + cacheSize,
+                             locString(uncached.getBestMatch(desired, errorCode)),
+                             locString(cached.getBestMatch(desired, errorCode)));
+            }
+        }
+    }
+    LocaleMatcher maxCached = LocaleMatcher::Builder().setSupportedLocalesFromListString("en, de, fr").
+        setCacheSize(INT32_MAX).build(errorCode);
+    assertEquals("INT32_MAX cache size", "de",
+                 locString(maxCached.getBestMatch(Locale("de-CH"), errorCode)));
+    assertEquals("INT32_MAX cache size again", "de",
+                 locString(maxCached.getBestMatch(Locale("de-CH"), errorCode)));
+
+    // The cache moves with the matcher.
+    LocaleMatcher cached = builder.setCacheSize(3).build(errorCode);
+    LocaleMatcher moved(std::move(cached));
+    assertEquals("moved cached matcher", "es_419",
+                 locString(moved.getBestMatchForListString("es-MX,es;q=0.9,en;q=0.5", errorCode)));
+}
+
 void LocaleMatcherTest::testMatch() {
     IcuTestErrorCode errorCode(*this, "testMatch");
     LocaleMatcher matcher = LocaleMatcher::Builder().build(errorCode);
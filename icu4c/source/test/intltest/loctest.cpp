@@ -32,6 +32,7 @@
 #include "putilimp.h"
 #include "hash.h"
 #include "locmap.h"
+#include "ulocimp.h"
 
 static const char* const rawData[33][8] = {
 
@@ -261,6 +262,7 @@ void LocaleTest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestForLanguageTag);
     TESTCASE_AUTO(TestToLanguageTag);
     TESTCASE_AUTO(TestToLanguageTagOmitTrue);
+    TESTCASE_AUTO(TestSimpleLanguageTags);
     TESTCASE_AUTO(TestMoveAssign);
     TESTCASE_AUTO(TestMoveCtor);
     TESTCASE_AUTO(TestBug20407iVariantPreferredValue);
@@ -3381,6 +3383,78 @@ void LocaleTest::TestToLanguageTag() {
     assertTrue(result_bogus.c_str(), result_bogus.empty());
 }
 
+// The common language[-script][-region] shapes take a fast path
+// which must yield the same results as the full parser.
+void LocaleTest::TestSimpleLanguageTags() {
+    IcuTestErrorCode status(*this, "TestSimpleLanguageTags()");
+
+    static const struct {
+        const char *tag;
+        const char *localeID;
+        int32_t parsedLength;
+    } forTestCases[] = {
+        { "en", "en", 2 },
+        { "EN-latn-us", "en_Latn_US", 10 },
+        { "zh-Hant", "zh_Hant", 7 },
+        { "es-419", "es_419", 6 },
+        { "und", "", 3 },
+        { "und-Cyrl", "_Cyrl", 8 },
+        { "UND-ru", "_RU", 6 },
+        { "abcdefgh-Zzzz-001", "abcdefgh_Zzzz_001", 17 },
+        { "sgn-BR", "bzs", 6 },  // redundant
+        { "zh-yue", "yue", 6 },  // redundant, extlang shape
+        { "en-GB-oed", "en_GB_OXENDICT", 9 },  // grandfathered
+        { "en-", "en", 2 },
+        { "en-Latn-", "en_Latn", 7 },
+        { "en-Latn-Latn", "en_Latn", 7 },
+        { "en-41", "en", 2 },
+        { "en_US", "", 0 },
+        { "e", "", 0 }
+    };
+    for (const auto &cas : forTestCases) {
+        std::string result, full;
+        int32_t parsedLength = -1, fullParsedLength = -1;
+        StringByteSink<std::string> sink(&result), fullSink(&full);
+        ulocimp_forLanguageTag(cas.tag, -1, sink, &parsedLength, status);
+        ulocimp_forLanguageTagFull(cas.tag, -1, fullSink, &fullParsedLength, status);
+        if (status.errIfFailureAndReset("\"%s\"", cas.tag)) {
+            continue;
+        }
+        assertEquals(cas.tag, cas.localeID, result.c_str());
+        assertEquals(cas.tag, cas.localeID, full.c_str());
+        assertEquals(cas.tag, cas.parsedLength, parsedLength);
+        assertEquals(cas.tag, cas.parsedLength, fullParsedLength);
+    }
+
+    static const struct {
+        const char *localeID;
+        const char *tag;
+    } toTestCases[] = {
+        { "en", "en" },
+        { "EN_latn_us", "en-Latn-US" },
+        { "es_419", "es-419" },
+        { "eng_US", "en-US" },  // 3-letter ISO 639 code
+        { "iw_IL", "he-IL" },  // deprecated language
+        { "my_BU", "my-MM" },  // deprecated region
+        { "und_Latn", "und-Latn" },
+        { "zh_GAN", "gan" },  // in the canonicalization map
+        { "en_US_POSIX", "en-US-u-va-posix" }
+    };
+    for (const auto &cas : toTestCases) {
+        for (UBool strict : {FALSE, TRUE}) {
+            std::string result, full;
+            StringByteSink<std::string> sink(&result), fullSink(&full);
+            ulocimp_toLanguageTag(cas.localeID, sink, strict, status);
+            ulocimp_toLanguageTagFull(cas.localeID, fullSink, strict, status);
+            if (status.errIfFailureAndReset("\"%s\"", cas.localeID)) {
+                continue;
+            }
+            assertEquals(cas.localeID, cas.tag, result.c_str());
+            assertEquals(cas.localeID, cas.tag, full.c_str());
+        }
+    }
+}
+
 /* ICU-20310 */
 void LocaleTest::TestToLanguageTagOmitTrue() {
     IcuTestErrorCode status(*this, "TestToLanguageTagOmitTrue()");
@@ -131,6 +131,7 @@ class LocaleTest: public IntlTest {
     void TestForLanguageTag();
     void TestToLanguageTag();
     void TestToLanguageTagOmitTrue();
+    void TestSimpleLanguageTags();
 
     void TestMoveAssign();
     void TestMoveCtor();
@@ -244,6 +244,7 @@ void NumberFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &n
   TESTCASE_AUTO(Test13735_GroupingSizeGetter);
   TESTCASE_AUTO(Test13734_StrictFlexibleWhitespace);
   TESTCASE_AUTO(Test20961_CurrencyPluralPattern);
+  TESTCASE_AUTO(TestFreeze);
   TESTCASE_AUTO_END;
 }
 
@@ -9761,4 +9762,45 @@ void NumberFormatTest::Test20961_CurrencyPluralPattern() {
     }
 }
 
+void NumberFormatTest::TestFreeze() {
+    IcuTestErrorCode status(*this, "TestFreeze");
+    DecimalFormat df(u"#,##0.00", DecimalFormatSymbols(Locale::getEnglish(), status), status);
+    if (status.errDataIfFailureAndReset("DecimalFormat constructor")) { return; }
+    UnicodeString result;
+    assertFalse("not frozen", df.isFrozen());
+    df.freeze(status);
+    assertSuccess("freeze()", status);
+    assertTrue("frozen", df.isFrozen());
+    assertEquals("format", u"1,234.50", df.format(1234.5, result));
+
+    // Setters do nothing, and those with a UErrorCode report it.
+    df.setMaximumFractionDigits(0);
+    df.setGroupingUsed(FALSE);
+    df.setPositivePrefix(u"+");
+    df.setRoundingMode(DecimalFormat::kRoundUp);
+    assertEquals("setters ignored", u"1,234.50", df.format(1234.5, result.remove()));
+    df.applyPattern(u"0.0", status);
+    assertEquals("applyPattern", U_NO_WRITE_PERMISSION, status.reset());
+    df.setCurrency(u"EUR", status);
+    assertEquals("setCurrency", U_NO_WRITE_PERMISSION, status.reset());
+    df.setAttribute(UNUM_MAX_FRACTION_DIGITS, 1, status);
+    assertEquals("setAttribute", U_NO_WRITE_PERMISSION, status.reset());
+    DecimalFormat other(u"0", DecimalFormatSymbols(Locale::getEnglish(), status), status);
+    df = other;
+    UnicodeString pattern;
+    assertEquals("assignment ignored", u"#,##0.00", df.toPattern(pattern));
+
+    // Parsing works too.
+    Formattable parsed;
+    df.parse(u"9,876.5", parsed, status);
+    assertEquals("parse", 9876.5, parsed.getDouble(status));
+
+    // Copies are not frozen.
+    LocalPointer<DecimalFormat> copy(df.clone());
+    assertFalse("clone not frozen", copy->isFrozen());
+    copy->setMaximumFractionDigits(0);
+    assertEquals("clone setter", u"1,234", copy->format(1234.25, result.remove()));
+    assertEquals("frozen original", u"1,234.25", df.format(1234.25, result.remove()));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
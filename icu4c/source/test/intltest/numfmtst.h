@@ -300,6 +300,7 @@ class NumberFormatTest: public CalendarTimeZoneTest {
     void Test13735_GroupingSizeGetter();
     void Test13734_StrictFlexibleWhitespace();
     void Test20961_CurrencyPluralPattern();
+    void TestFreeze();
 
  private:
     UBool testFormattableAsUFormattable(const char *file, int line, Formattable &f);
@@ -0,0 +1,110 @@
+// © 2020 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html#License
+
+// packagetest.cpp
+// Tests for the toolutil Package class that icupkg uses to read and write .dat packages.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "unicode/utypes.h"
+#include "charstr.h"
+#include "intltest.h"
+#include "package.h"
+
+class PackageTest : public IntlTest {
+public:
+    PackageTest() {}
+
+    void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    void TestHotItemsRoundTrip();
+
+private:
+    void checkSameItems(const char *message, const Package &expected, const Package &actual);
+};
+
+extern IntlTest *createPackageTest() {
+    return new PackageTest();
+}
+
+void PackageTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char * /*par*/) {
+    if(exec) {
+        logln("TestSuite PackageTest: ");
+    }
+    TESTCASE_AUTO_BEGIN;
+    TESTCASE_AUTO(TestHotItemsRoundTrip);
+    TESTCASE_AUTO_END;
+}
+
+void PackageTest::checkSameItems(const char *message, const Package &expected, const Package &actual) {
+    if(!assertEquals(UnicodeString(message)+" item count",
+                     expected.getItemCount(), actual.getItemCount())) {
+        return;
+    }
+    for(int32_t i=0; i<expected.getItemCount(); ++i) {
+        const Item *e=expected.getItem(i);
+        const Item *a=actual.getItem(i);
+        if(0!=strcmp(e->name, a->name)) {
+            errln("%s: item %d is %s rather than %s", message, (int)i, a->name, e->name);
+        } else if(e->length!=a->length) {
+            errln("%s: item %s has length %ld rather than %ld",
+                  message, a->name, (long)a->length, (long)e->length);
+        } else if(0!=memcmp(e->data, a->data, e->length)) {
+            errln("%s: item %s has different data", message, a->name);
+        }
+    }
+}
+
+void PackageTest::TestHotItemsRoundTrip() {
+    // The hot items are followed by padding to the next page boundary,
+    // which must not become part of the last hot item
+    // (nor of any other item) when the package is read again.
+    IcuTestErrorCode errorCode(*this, "TestHotItemsRoundTrip");
+    const char *testDataPath=loadTestData(errorCode);
+    if(errorCode.errDataIfFailureAndReset("unable to find the testdata package")) {
+        return;
+    }
+    CharString inFilename(testDataPath, errorCode);
+    inFilename.append(".dat", errorCode);
+    // Package::readPackage() exits the process when it cannot read the file.
+    FILE *f=fopen(inFilename.data(), "rb");
+    if(f==NULL) {
+        dataerrln("unable to open %s", inFilename.data());
+        return;
+    }
+    fclose(f);
+
+    Package original;
+    original.readPackage(inFilename.data());
+    int32_t count=original.getItemCount();
+    if(count<3) {
+        errln("too few items in %s", inFilename.data());
+        return;
+    }
+
+    static const char *hotFilename="pkgtesthot.dat";
+    static const char *plainFilename="pkgtestplain.dat";
+    char type=original.getInType();
+    {
+        Package pkg;
+        pkg.readPackage(inFilename.data());
+        pkg.addHotItem(original.getItem(count/2)->name);
+        pkg.addHotItem(original.getItem(1)->name);
+        pkg.writePackage(hotFilename, type, NULL);
+    }
+    {
+        Package hotPkg;
+        hotPkg.readPackage(hotFilename);
+        checkSameItems("hot items layout", original, hotPkg);
+        // Rewrite without hot items, like icupkg without --hot_items.
+        hotPkg.writePackage(plainFilename, type, NULL);
+    }
+    {
+        Package plainPkg;
+        plainPkg.readPackage(plainFilename);
+        checkSameItems("rewritten without hot items", original, plainPkg);
+    }
+    remove(hotFilename);
+    remove(plainFilename);
+}
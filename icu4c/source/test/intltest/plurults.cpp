@@ -56,6 +56,7 @@ void PluralRulesTest::runIndexedTest( int32_t index, UBool exec, const char* &na
     TESTCASE_AUTO(testFixedDecimal);
     TESTCASE_AUTO(testSelectTrailingZeros);
     TESTCASE_AUTO(testLocaleExtension);
+    TESTCASE_AUTO(testCompiledRules);
     TESTCASE_AUTO_END;
 }
 
@@ -1067,4 +1068,97 @@ void PluralRulesTest::testLocaleExtension() {
     compareLocaleResults("fr", "fr_CH", "fr@ms=uksystem");
 }
 
+void PluralRulesTest::testCompiledRules() {
+    IcuTestErrorCode errorCode(*this, "testCompiledRules");
+    // select() evaluates the compiled program; select(int32_t) and select(double)
+    // of integers take its integer path, with a lookup table for 0..999.
+    // Each result is checked against the interpretive RuleChain,
+    // and the samples against their keywords.
+    static const int32_t integers[] = {
+        1000, 1001, 1011, 1100, 1101, 10000, 10001, 10011, 100000, 1000000, 1000001,
+        2147483646, 2147483647
+    };
+    LocalPointer<StringEnumeration> locales(PluralRules::getAvailableLocales(errorCode));
+    if (errorCode.errDataIfFailureAndReset("PluralRules::getAvailableLocales()")) { return; }
+    const char *localeID;
+    while ((localeID = locales->next(nullptr, errorCode)) != nullptr) {
+        for (int32_t type = UPLURAL_TYPE_CARDINAL; type < UPLURAL_TYPE_COUNT; ++type) {
+            LocalPointer<PluralRules> rules(
+                PluralRules::forLocale(localeID, (UPluralType)type, errorCode));
+            if (errorCode.errIfFailureAndReset("PluralRules::forLocale(%s)", localeID)) { continue; }
+            if (rules->mProgram == nullptr || rules->mRules == nullptr) {
+                errln("PluralRules for %s were not compiled", localeID);
+                continue;
+            }
+            const RuleChain &chain = *rules->mRules;
+            for (int32_t i = 0; i < 1200 + UPRV_LENGTHOF(integers); ++i) {
+                int32_t n = i < 1200 ? i : integers[i - 1200];
+                FixedDecimal fd(n, 0, 0);
+                UnicodeString expected = chain.select(fd);
+                if (rules->select(fd) != expected || rules->select(n) != expected ||
+                        rules->select(-n) != expected || rules->select((double)n) != expected) {
+                    errln(UnicodeString(u"select(") + n + u") for " + localeID + u" is not " + expected);
+                }
+            }
+            for (int32_t i = 0; i < 2000; ++i) {
+                for (int32_t v = 1; v <= 3; ++v) {
+                    FixedDecimal fd(i / 100.0, v);
+                    UnicodeString expected = chain.select(fd);
+                    if (rules->select(fd) != expected) {
+                        errln(UnicodeString(u"select(") + DoubleToUnicodeString(i / 100.0) + u" v=" + v +
+                              u") for " + localeID + u" is not " + expected);
+                    }
+                }
+            }
+            StringEnumeration *keywords = rules->getKeywords(errorCode);
+            LocalPointer<StringEnumeration> keywordsOwner(keywords);
+            const UnicodeString *keyword;
+            while (keywords != nullptr && (keyword = keywords->snext(errorCode)) != nullptr) {
+                double samples[50];
+                int32_t count = rules->getSamples(*keyword, samples, UPRV_LENGTHOF(samples), errorCode);
+                for (int32_t j = 0; j < count; ++j) {
+                    if (rules->select(samples[j]) != *keyword) {
+                        errln(UnicodeString(u"select(") + DoubleToUnicodeString(samples[j]) +
+                              u") for " + localeID + u" is not " + *keyword);
+                    }
+                }
+            }
+            errorCode.errIfFailureAndReset("keywords and samples for %s", localeID);
+        }
+    }
+
+    // Constraints that do not occur in CLDR data.
+    LocalPointer<PluralRules> rules(PluralRules::createRules(
+        u"a: n mod 0 is 0; b: n mod 7 is 2 and n mod 7 not in 0..1,3..6; "
+        u"c: i within 5..6 or v is 1 and f is 5; d: @integer 0, 10; e: n in 11..20", errorCode));
+    if (errorCode.errIfFailureAndReset("PluralRules::createRules()")) { return; }
+    static const struct {
+        double number;
+        int32_t v;
+        const char16_t *expected;
+    } cases[] = {
+        {0, 0, u"d"},
+        {2, 0, u"b"},
+        {9, 0, u"b"},
+        {5, 0, u"c"},
+        {6.5, 1, u"c"},
+        {7.5, 1, u"c"},
+        {7.5, 2, u"d"},
+        {10, 0, u"d"},
+        {15, 0, u"d"}
+    };
+    for (const auto &cas : cases) {
+        UnicodeString message(DoubleToUnicodeString(cas.number) + u" v=" + cas.v);
+        FixedDecimal fd(cas.number, cas.v);
+        assertEquals(message, cas.expected, rules->select(fd));
+        if (cas.v == 0) {
+            assertEquals(message + u" int", cas.expected, rules->select((int32_t)cas.number));
+            assertEquals(message + u" double", cas.expected, rules->select(cas.number));
+        }
+    }
+    LocalPointer<PluralRules> copy(rules->clone());
+    assertEquals("clone select(2)", u"b", copy->select(2));
+    assertEquals("clone select(2.25)", u"d", copy->select(2.25));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -64,6 +64,7 @@ class StringCaseTest: public IntlTest {
     void TestCaseMapUTF8WithEdits();
     void TestCaseMapToString();
     void TestCaseMapUTF8ToString();
+    void TestCaseMapUTF8ASCIIRuns();
     void TestLongUnicodeString();
     void TestBug13127();
     void TestInPlaceTitle();
@@ -108,6 +109,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestCaseMapUTF8WithEdits);
     TESTCASE_AUTO(TestCaseMapToString);
     TESTCASE_AUTO(TestCaseMapUTF8ToString);
+    TESTCASE_AUTO(TestCaseMapUTF8ASCIIRuns);
     TESTCASE_AUTO(TestLongUnicodeString);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestBug13127);
@@ -1496,6 +1498,82 @@ void StringCaseTest::TestCaseMapUTF8ToString() {
                  UnicodeString::fromUTF8(dest));
 }
 
+void StringCaseTest::TestCaseMapUTF8ASCIIRuns() {
+    // ASCII runs are case-mapped several bytes at a time.
+    // Check all run lengths around the word size, with and without surrounding non-ASCII text,
+    // and check that the Edits still record one 1:1 change per changed letter.
+    IcuTestErrorCode errorCode(*this, "TestCaseMapUTF8ASCIIRuns");
+    static const char ascii[] = "Hello, World! @AZ[`az{ 0123 iIjJ xyzXYZ_MIXED case TEXT";
+    static const char *const affixes[] = { "", "\xe4\xb8\xad" };  // U+4E2D has no case mappings
+    char dest[200];
+    for (int32_t which = 0; which < 3; ++which) {
+        for (int32_t length = 0; length <= 40; ++length) {
+            for (int32_t a = 0; a < UPRV_LENGTHOF(affixes); ++a) {
+                std::string src(affixes[a]);
+                std::string expected(affixes[a]);
+                int32_t numChanges = 0;
+                for (int32_t i = 0; i < length; ++i) {
+                    char c = ascii[(i * 7 + length) % (UPRV_LENGTHOF(ascii) - 1)];
+                    src.push_back(c);
+                    char m = c;
+                    if (which != 1 && 'A' <= c && c <= 'Z') {
+                        m = (char)(c + 0x20);
+                    } else if (which == 1 && 'a' <= c && c <= 'z') {
+                        m = (char)(c - 0x20);
+                    }
+                    expected.push_back(m);
+                    if (m != c) { ++numChanges; }
+                }
+                src.append(affixes[a]);
+                expected.append(affixes[a]);
+                Edits edits;
+                int32_t srcLength = (int32_t)src.length();
+                int32_t destLength;
+                if (which == 0) {
+                    destLength = CaseMap::utf8ToLower("", 0, src.data(), srcLength,
+                                                      dest, UPRV_LENGTHOF(dest), &edits, errorCode);
+                } else if (which == 1) {
+                    destLength = CaseMap::utf8ToUpper("", 0, src.data(), srcLength,
+                                                      dest, UPRV_LENGTHOF(dest), &edits, errorCode);
+                } else {
+                    destLength = CaseMap::utf8Fold(0, src.data(), srcLength,
+                                                   dest, UPRV_LENGTHOF(dest), &edits, errorCode);
+                }
+                if (errorCode.errIfFailureAndReset("case mapping %d of length %d", (int)which, (int)length)) {
+                    continue;
+                }
+                if (std::string(dest, destLength) != expected) {
+                    errln("case mapping %d of \"%s\" -> \"%s\" but expected \"%s\"",
+                          (int)which, src.c_str(), std::string(dest, destLength).c_str(), expected.c_str());
+                    continue;
+                }
+                assertEquals("numberOfChanges", numChanges, edits.numberOfChanges());
+                assertEquals("lengthDelta", 0, edits.lengthDelta());
+                Edits::Iterator ei = edits.getFineChangesIterator();
+                while (ei.next(errorCode)) {
+                    int32_t i = ei.sourceIndex();
+                    if (ei.oldLength() != 1 || ei.newLength() != 1 || src[i] == dest[i]) {
+                        errln("case mapping %d of \"%s\": unexpected change at %d",
+                              (int)which, src.c_str(), (int)i);
+                        break;
+                    }
+                }
+
+                // Preflighting: The mapping is written in bulk into scratch buffers.
+                destLength = which == 0 ?
+                    CaseMap::utf8ToLower("", 0, src.data(), srcLength, dest, 5, nullptr, errorCode) :
+                    CaseMap::utf8ToUpper("", 0, src.data(), srcLength, dest, 5, nullptr, errorCode);
+                if (srcLength > 5) {
+                    assertEquals("preflighting error", (int32_t)U_BUFFER_OVERFLOW_ERROR, (int32_t)errorCode.reset());
+                } else {
+                    errorCode.errIfFailureAndReset();
+                }
+                assertEquals("preflighting length", srcLength, destLength);
+            }
+        }
+    }
+}
+
 void StringCaseTest::TestLongUnicodeString() {
     // Code coverage for UnicodeString case mapping code handling
     // long strings or many changes in a string.
@@ -75,6 +75,8 @@ TestMessageFormat::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestMessageFormatNumberSkeleton);
     TESTCASE_AUTO(TestMessageFormatDateSkeleton);
     TESTCASE_AUTO(TestMessageFormatTimeSkeleton);
+    TESTCASE_AUTO(TestFormatPlan);
+    TESTCASE_AUTO(TestFreeze);
     TESTCASE_AUTO_END;
 }
 
@@ -2073,4 +2075,100 @@ void TestMessageFormat::TestMessageFormatTimeSkeleton() {
     doTheRealDateTimeSkeletonTesting(date, u"{0,time,'::'yMMMMd}", "en", u"::2021November23", status);
 }
 
+void TestMessageFormat::TestFormatPlan() {
+    IcuTestErrorCode errorCode(*this, "TestFormatPlan");
+    // format() runs the compiled format plan: The first call builds it, later calls reuse it,
+    // and it must be rebuilt after the pattern or the formatters change.
+    // Each result is also checked against walking the pattern without the plan.
+    FieldPosition ignore;
+    UnicodeString result;
+    auto check = [&](const char *message, const char16_t *expected, const MessageFormat &mf,
+                     const UnicodeString *argNames, const Formattable *args, int32_t count) {
+        for (int32_t i = 0; i < 2; ++i) {
+            result.remove();
+            if (argNames == nullptr) {
+                mf.format(args, count, result, ignore, errorCode);
+            } else {
+                mf.format(argNames, args, count, result, errorCode);
+            }
+            assertEquals(UnicodeString(message) + u" #" + (i + 1), expected, result);
+        }
+        assertEquals(UnicodeString(message) + u" without plan", expected,
+                     mf.formatWithoutPlan(args, argNames, count, result.remove(), errorCode));
+    };
+    Formattable args[3];
+
+    MessageFormat mf(u"{0} has {1,number,integer} item(s) in {2}.", Locale::getEnglish(), errorCode);
+    args[0].setString("Alice");
+    args[1].setDouble(1234.5);
+    args[2].setString("her cart");
+    check("simple", u"Alice has 1,234 item(s) in her cart.", mf, nullptr, args, 3);
+    // Missing arguments are printed as {n}.
+    check("missing arg", u"Alice has 1,234 item(s) in {2}.", mf, nullptr, args, 2);
+    mf.adoptFormat(1, NumberFormat::createPercentInstance(Locale::getEnglish(), errorCode));
+    check("adoptFormat", u"Alice has 123,450% item(s) in her cart.", mf, nullptr, args, 3);
+    mf.applyPattern(u"{2}: {0}", errorCode);
+    check("applyPattern", u"her cart: Alice", mf, nullptr, args, 3);
+
+    MessageFormat mf2(
+        u"{name} {n,plural,offset:1 =0{no one} one{# other} other{{n,number,00} or # others}}"
+        u" {g,select,female{her} male{his} other{their}} {c,choice,0#none|1#one|1<{c,number} items}.",
+        Locale::getEnglish(), errorCode);
+    UnicodeString argNames[4] = { u"name", u"n", u"g", u"c" };
+    Formattable namedArgs[4];
+    namedArgs[0].setString("Bob");
+    namedArgs[1].setLong(0);
+    namedArgs[2].setString("female");
+    namedArgs[3].setLong(1);
+    check("named =0", u"Bob no one her one.", mf2, argNames, namedArgs, 4);
+    namedArgs[1].setLong(2);
+    namedArgs[2].setString("unknown");
+    namedArgs[3].setLong(3);
+    check("named one", u"Bob 1 other their 3 items.", mf2, argNames, namedArgs, 4);
+    namedArgs[1].setLong(5);
+    namedArgs[2].setString("male");
+    check("named other", u"Bob 05 or 4 others his 3 items.", mf2, argNames, namedArgs, 4);
+
+    // A copy must not share the plan of the original.
+    MessageFormat *copy = mf2.clone();
+    mf2.applyPattern(u"{name}!", errorCode);
+    check("clone", u"Bob 05 or 4 others his 3 items.", *copy, argNames, namedArgs, 4);
+    check("original", u"Bob!", mf2, argNames, namedArgs, 4);
+    delete copy;
+}
+
+void TestMessageFormat::TestFreeze() {
+    IcuTestErrorCode errorCode(*this, "TestFreeze");
+    MessageFormat mf(u"{0,plural,one{# file} other{# files}} on {1,selectordinal,one{#st} other{#th}} disk, {2}",
+                     Locale::getEnglish(), errorCode);
+    FieldPosition ignore;
+    UnicodeString result;
+    Formattable args[] = { (int32_t)3, (int32_t)21, 1234.5 };
+    assertFalse("not frozen", mf.isFrozen());
+    mf.freeze(errorCode);
+    assertTrue("frozen", mf.isFrozen());
+    assertEquals("format", u"3 files on 21st disk, 1,234.5",
+                 mf.format(args, 3, result, ignore, errorCode));
+
+    // Setters do nothing, and those with a UErrorCode report it.
+    mf.setLocale(Locale::getGerman());
+    mf.adoptFormat(2, NumberFormat::createPercentInstance(Locale::getEnglish(), errorCode));
+    mf.setFormat(0, ChoiceFormat(u"0#none|1#some", errorCode));
+    MessageFormat other(u"{0}", Locale::getEnglish(), errorCode);
+    mf = other;
+    assertEquals("setters ignored", u"3 files on 21st disk, 1,234.5",
+                 mf.format(args, 3, result.remove(), ignore, errorCode));
+    mf.applyPattern(u"{0}", errorCode);
+    assertEquals("applyPattern", U_NO_WRITE_PERMISSION, errorCode.reset());
+    mf.setFormat(u"2", ChoiceFormat(u"0#none|1#some", errorCode), errorCode);
+    assertEquals("setFormat(name)", U_NO_WRITE_PERMISSION, errorCode.reset());
+
+    // Copies are not frozen.
+    LocalPointer<MessageFormat> copy(mf.clone());
+    assertFalse("clone not frozen", copy->isFrozen());
+    copy->applyPattern(u"{2,number,integer}", errorCode);
+    assertEquals("clone applyPattern", u"1,234",
+                 copy->format(args, 3, result.remove(), ignore, errorCode));
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
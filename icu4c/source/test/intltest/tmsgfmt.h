@@ -124,6 +124,8 @@ class TestMessageFormat: public IntlTest {
     void TestMessageFormatNumberSkeleton();
     void TestMessageFormatDateSkeleton();
     void TestMessageFormatTimeSkeleton();
+    void TestFormatPlan();
+    void TestFreeze();
 
 private:
     UnicodeString GetPatternAndSkipSyntax(const MessagePattern& pattern);
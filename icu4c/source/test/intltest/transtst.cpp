@@ -197,6 +197,8 @@ TransliteratorTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(83,TestThai);
         TESTCASE(84,TestAny);
         TESTCASE(85,TestBasicTransliteratorEvenWithoutData);
+        TESTCASE(86,TestRuleDispatch);
+        TESTCASE(87,TestTransliterateBuffer);
         default: name = ""; break;
     }
 }
@@ -1509,6 +1511,79 @@ void TransliteratorTest::TestNormalizationTransliterator() {
     delete t;
 }
 
+/**
+ * Rules are dispatched on the first code unit of the text within the bins
+ * for the low byte of the first character.  Rules that share a bin but not
+ * their first character, and sets with and without strings, must still be
+ * tried in rule order.
+ */
+void TransliteratorTest::TestRuleDispatch() {
+    UnicodeString rules(
+        "[\\u0141 \\u1E41] } x > S;"
+        "\\u0141 > L;"
+        "A > a;"
+        "\\u0241 > B;"
+        "[{\\u0341\\u0342}] > T;"
+        "\\U00010041 > U;"
+        "[\\U00010141] > V;"
+        "[^\\u0000-\\u00FF] { z > Z;", "");
+    expect(rules,
+           CharsToUnicodeString("\\u0141x \\u0141 A \\u0241 \\u1E41x \\u1E41 "
+                                "\\u0341\\u0342 \\u0341 \\U00010041 \\U00010141 \\u0242z Az"),
+           CharsToUnicodeString("Sx L a B Sx \\u1E41 "
+                                "T \\u0341 U V \\u0242Z az"));
+}
+
+/**
+ * Transliterating from a buffer into another one must have the same result
+ * as transliterating a UnicodeString in place, also for long texts where
+ * many replacements change the length, and through compound transliterators.
+ */
+void TransliteratorTest::TestTransliterateBuffer() {
+    static const char *const IDS[] = {
+        "Any-Hex", "Latin-ASCII", "NFD; Lower; Any-Hex/Java; Hex-Any", "Null"
+    };
+    UnicodeString unit = CharsToUnicodeString(
+        "Cr\\u00E8me br\\u00FBl\\u00E9e \\u00C6r\\u00F8 \\U0001D400\\u0141\\u00F3d\\u017A. ");
+    UnicodeString text;
+    for (int32_t i = 0; i < 500; ++i) {
+        text.append(unit);
+    }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(IDS); ++i) {
+        IcuTestErrorCode errorCode(*this, IDS[i]);
+        LocalPointer<Transliterator> t(
+            Transliterator::createInstance(IDS[i], UTRANS_FORWARD, errorCode));
+        if (errorCode.errDataIfFailureAndReset("createInstance(%s)", IDS[i])) {
+            continue;
+        }
+        UnicodeString expected(text);
+        t->transliterate(expected);
+
+        int32_t length = t->transliterate(text.getBuffer(), text.length(), nullptr, 0, errorCode);
+        assertEquals(UnicodeString("preflighting error ") + IDS[i],
+                     u_errorName(U_BUFFER_OVERFLOW_ERROR), errorCode.errorName());
+        errorCode.reset();
+        assertEquals(UnicodeString("preflighting length ") + IDS[i], expected.length(), length);
+
+        UnicodeString result;
+        char16_t *dest = result.getBuffer(length + 1);
+        length = t->transliterate(text.getBuffer(), text.length(), dest, length + 1, errorCode);
+        result.releaseBuffer(length);
+        errorCode.errIfFailureAndReset("transliterate(buffer) %s", IDS[i]);
+        if (result != expected) {
+            errln(UnicodeString("FAIL: transliterate(buffer) ") + IDS[i] +
+                  " differs from transliterate(UnicodeString)");
+        }
+
+        // The buffers must not overlap.
+        char16_t buffer[20] = { 0x61, 0x62, 0x63 };
+        t->transliterate(buffer, 3, buffer + 2, 10, errorCode);
+        assertEquals(UnicodeString("overlap ") + IDS[i],
+                     u_errorName(U_ILLEGAL_ARGUMENT_ERROR), errorCode.errorName());
+        errorCode.reset();
+    }
+}
+
 /**
  * Test we can create basic transliterator even without data.
  */
@@ -370,6 +370,16 @@ class TransliteratorTest : public IntlTest {
     void TestRegisterAlias(void);
 
     void TestBasicTransliteratorEvenWithoutData(void);
+
+    /**
+     * Tests the order of rules that share their dispatch bin
+     */
+    void TestRuleDispatch(void);
+
+    /**
+     * Tests transliterating from a source buffer into a destination buffer
+     */
+    void TestTransliterateBuffer(void);
     //======================================================================
     // Support methods
     //======================================================================
@@ -20,6 +20,7 @@
 #include "unicode/udata.h"
 #include "unicode/uloc.h"
 #include "unicode/locid.h"
+#include "unicode/localematcher.h"
 #include "putilimp.h"
 #include "intltest.h"
 #include "tsmthred.h"
@@ -47,11 +48,13 @@ MultithreadTest::~MultithreadTest()
 
 // for mthreadtest
 #include "unicode/numfmt.h"
+#include "unicode/decimfmt.h"
 #include "unicode/choicfmt.h"
 #include "unicode/msgfmt.h"
 #include "unicode/locid.h"
 #include "unicode/coll.h"
 #include "unicode/calendar.h"
+#include "unicode/brkiter.h"
 #include "ucaconf.h"
 
 
@@ -79,6 +82,13 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+    TESTCASE_AUTO(TestLocaleMatcherCache);
+#if !UCONFIG_NO_FORMATTING
+    TESTCASE_AUTO(TestFrozenFormats);
+#endif /* #if !UCONFIG_NO_FORMATTING */
+#if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_SERVICE
+    TESTCASE_AUTO(TestServiceLookups);
+#endif
     TESTCASE_AUTO_END;
 }
 
@@ -1366,3 +1376,206 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+//-------------------------------------------------------------------------------------------
+//
+// TestLocaleMatcherCache.  Threads share one LocaleMatcher with a small cache,
+//                          so that entries are added, used and removed concurrently.
+//
+//-------------------------------------------------------------------------------------------
+
+static const char *const gMatcherCacheLists[] = {
+    "en-US,en;q=0.9", "de-AT, de;q=0.8, en;q=0.5", "es-MX,es;q=0.9,en;q=0.5",
+    "zh-HK, zh;q=0.5", "sr-Latn-RS", "pt-BR", "ja, ko;q=0.5", "fr-CA, en-GB;q=0.9",
+    "nb-DK", "arz-EG, ar;q=0.5", "en-AU", "de-CH", "zh-TW", "es-AR, pt;q=0.5", "it-CH, fr;q=0.9"
+};
+
+static const Locale *gMatcherCacheExpected[UPRV_LENGTHOF(gMatcherCacheLists)];
+
+class LocaleMatcherCacheThread : public SimpleThread {
+public:
+    LocaleMatcherCacheThread(const LocaleMatcher &matcher, int32_t start) :
+            fMatcher(matcher), fStart(start), fErrors(0) {}
+    virtual void run();
+
+    const LocaleMatcher &fMatcher;
+    int32_t fStart;
+    int32_t fErrors;
+};
+
+void LocaleMatcherCacheThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    for (int32_t i = 0; i < 2000; ++i) {
+        int32_t index = (fStart + i * 7) % UPRV_LENGTHOF(gMatcherCacheLists);
+        const Locale *best = fMatcher.getBestMatchForListString(gMatcherCacheLists[index], status);
+        if (U_FAILURE(status) || best == nullptr || *best != *gMatcherCacheExpected[index]) {
+            ++fErrors;
+        }
+    }
+}
+
+void MultithreadTest::TestLocaleMatcherCache() {
+    IcuTestErrorCode status(*this, "TestLocaleMatcherCache");
+    LocaleMatcher::Builder builder;
+    builder.setSupportedLocalesFromListString("en, en-GB, fr, de-CH, es-419, pt-PT, zh-Hant, ar, nn");
+    LocaleMatcher uncached = builder.build(status);
+    LocaleMatcher matcher = builder.setCacheSize(5).build(status);
+    if (status.errIfFailureAndReset("LocaleMatcher::Builder::build()")) { return; }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(gMatcherCacheLists); ++i) {
+        gMatcherCacheExpected[i] = uncached.getBestMatchForListString(gMatcherCacheLists[i], status);
+    }
+    if (status.errIfFailureAndReset("uncached getBestMatchForListString()")) { return; }
+
+    static constexpr int NUM_THREADS = 8;
+    LocalPointer<LocaleMatcherCacheThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new LocaleMatcherCacheThread(matcher, i));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        assertEquals(WHERE, 0, threads[i]->fErrors);
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+// TestFrozenFormats.  Threads share one frozen DecimalFormat and one frozen MessageFormat
+//                     instead of cloning them.
+//
+//-------------------------------------------------------------------------------------------
+
+#if !UCONFIG_NO_FORMATTING
+
+static const double gFrozenNumbers[] = { 0, 1, 2, 5, 21, 1234.5, -0.25, 1e9 };
+static UnicodeString gFrozenNumberResults[UPRV_LENGTHOF(gFrozenNumbers)];
+static UnicodeString gFrozenMessageResults[UPRV_LENGTHOF(gFrozenNumbers)];
+
+class FrozenFormatThread : public SimpleThread {
+public:
+    FrozenFormatThread(const DecimalFormat &df, const MessageFormat &mf) :
+            fNumberFormat(df), fMessageFormat(mf), fErrors(0) {}
+    virtual void run();
+
+    const DecimalFormat &fNumberFormat;
+    const MessageFormat &fMessageFormat;
+    int32_t fErrors;
+};
+
+void FrozenFormatThread::run() {
+    UErrorCode status = U_ZERO_ERROR;
+    FieldPosition ignore(FieldPosition::DONT_CARE);
+    UnicodeString result;
+    for (int32_t i = 0; i < 2000; ++i) {
+        int32_t index = i % UPRV_LENGTHOF(gFrozenNumbers);
+        fNumberFormat.format(gFrozenNumbers[index], result.remove(), ignore, status);
+        if (result != gFrozenNumberResults[index]) {
+            ++fErrors;
+        }
+        Formattable args[] = { gFrozenNumbers[index], UnicodeString(u"shared") };
+        fMessageFormat.format(args, 2, result.remove(), ignore, status);
+        if (result != gFrozenMessageResults[index]) {
+            ++fErrors;
+        }
+    }
+    if (U_FAILURE(status)) {
+        ++fErrors;
+    }
+}
+
+void MultithreadTest::TestFrozenFormats() {
+    IcuTestErrorCode status(*this, "TestFrozenFormats");
+    LocalPointer<DecimalFormat> df(dynamic_cast<DecimalFormat *>(
+        NumberFormat::createInstance(Locale::getGerman(), status)));
+    MessageFormat mf(
+        u"{1}: {0,plural,one{# Datei} other{{0,number,#,##0.0} Dateien}} ({0,number,percent})",
+        Locale::getGerman(), status);
+    if (status.errIfFailureAndReset("creating the formats") || df.isNull()) { return; }
+    FieldPosition ignore(FieldPosition::DONT_CARE);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(gFrozenNumbers); ++i) {
+        df->format(gFrozenNumbers[i], gFrozenNumberResults[i].remove(), ignore, status);
+        Formattable args[] = { gFrozenNumbers[i], UnicodeString(u"shared") };
+        mf.format(args, 2, gFrozenMessageResults[i].remove(), ignore, status);
+    }
+    df->freeze(status);
+    mf.freeze(status);
+    if (status.errIfFailureAndReset("freeze()")) { return; }
+
+    static constexpr int NUM_THREADS = 8;
+    LocalPointer<FrozenFormatThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new FrozenFormatThread(*df, mf));
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        assertEquals(WHERE, 0, threads[i]->fErrors);
+    }
+}
+
+#endif /* #if !UCONFIG_NO_FORMATTING */
+
+
+//-------------------------------------------------------------------------------------------
+//
+// TestServiceLookups.  Threads create break iterators through the service while
+//                      another thread registers and unregisters a factory, so that
+//                      cached lookups race with cache flushes.
+//
+//-------------------------------------------------------------------------------------------
+
+#if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_SERVICE
+
+class ServiceLookupThread : public SimpleThread {
+public:
+    ServiceLookupThread() : fErrors(0) {}
+    virtual void run();
+
+    int32_t fErrors;
+};
+
+void ServiceLookupThread::run() {
+    static const char *const locales[] = { "en", "de", "fr_CA", "xx" };
+    UnicodeString text(u"ab cd");
+    for (int32_t i = 0; i < 2000; ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        const char *locale = locales[i % UPRV_LENGTHOF(locales)];
+        LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale(locale), status));
+        if (U_FAILURE(status) || bi.isNull()) {
+            ++fErrors;
+            continue;
+        }
+        bi->setText(text);
+        int32_t boundary = bi->next();
+        // "xx" gets either the registered character instance or the root word instance.
+        if (!(boundary == 2 || (boundary == 1 && uprv_strcmp(locale, "xx") == 0))) {
+            ++fErrors;
+        }
+    }
+}
+
+void MultithreadTest::TestServiceLookups() {
+    IcuTestErrorCode status(*this, "TestServiceLookups");
+    static constexpr int NUM_THREADS = 8;
+    LocalPointer<ServiceLookupThread> threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i].adoptInstead(new ServiceLookupThread());
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < 50; ++i) {
+        URegistryKey key = BreakIterator::registerInstance(
+            BreakIterator::createCharacterInstance(Locale::getRoot(), status),
+            Locale("xx"), UBRK_WORD, status);
+        if (status.errIfFailureAndReset("registerInstance()")) { break; }
+        BreakIterator::unregister(key, status);
+        if (status.errIfFailureAndReset("unregister()")) { break; }
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        assertEquals(WHERE, 0, threads[i]->fErrors);
+    }
+}
+
+#endif /* #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_SERVICE */
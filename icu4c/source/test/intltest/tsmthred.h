@@ -49,6 +49,9 @@ class MultithreadTest : public IntlTest
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestLocaleMatcherCache();
+    void TestFrozenFormats();
+    void TestServiceLookups();
 };
 
 #endif
@@ -68,6 +68,7 @@ void UnicodeStringTest::runIndexedTest( int32_t index, UBool exec, const char* &
     TESTCASE_AUTO(TestNullPointers);
     TESTCASE_AUTO(TestUnicodeStringInsertAppendToSelf);
     TESTCASE_AUTO(TestLargeAppend);
+    TESTCASE_AUTO(TestArena);
     TESTCASE_AUTO_END;
 }
 
@@ -2372,3 +2373,51 @@ void UnicodeStringTest::TestLargeAppend() {
         }
     }
 }
+
+void UnicodeStringTest::TestArena() {
+    UnicodeString longText(u"a string that is too long for the stack buffer of a UnicodeString");
+    int32_t length = longText.length();
+    UnicodeString escaped, grownOut;
+    {
+        char buffer[200];
+        UnicodeStringArena arena(buffer, sizeof(buffer));
+        UnicodeString s(arena, 2 * length);
+        assertTrue("allocated from the arena", arena.getAllocatedBytes() > 2 * length * 2);
+        int64_t allocated = arena.getAllocatedBytes();
+        s.append(longText).append(longText);
+        assertEquals("appended in place", 2 * length, s.length());
+        assertEquals("terminated", 2 * length, u_strlen(s.getTerminatedBuffer()));
+        // Other strings do not use the arena, even while it exists.
+        UnicodeString heap(longText);
+        heap.append(longText);
+        assertEquals("not from the arena", allocated, arena.getAllocatedBytes());
+        // Grow beyond the caller's buffer into an arena heap block.
+        UnicodeString t(arena, 3 * length);
+        t.append(s).append(longText);
+        assertTrue("grown arena", arena.getAllocatedBytes() > allocated);
+        UnicodeString u(t);
+        u.setCharAt(0, u'A');
+        assertEquals("copy is independent", u'a', t.charAt(0));
+        assertEquals("copy modified", u'A', u.charAt(0));
+        // Strings escape the arena scope by copying.
+        escaped = s;
+        grownOut = UnicodeString(arena, 10);
+        grownOut.append(longText);  // needs more capacity, moves to the heap
+        UnicodeString small(arena, 5);
+        small.append(u"short");
+        assertEquals("stack buffer", u"short", small);
+    }
+    // Use the strings after the arena is gone.
+    assertEquals("escaped copy", longText + longText, escaped);
+    escaped.append(u'!');
+    assertEquals("escaped copy modified", 2 * length + 1, escaped.length());
+    assertEquals("grown out of the arena", longText, grownOut);
+    {
+        UnicodeStringArena heapArena(0);
+        UnicodeString v(heapArena, 10000);
+        assertTrue("large arena string", !v.isBogus() && v.getCapacity() >= 10000);
+        assertTrue("allocated from a heap block", heapArena.getAllocatedBytes() >= 20000);
+        UnicodeString bogus(heapArena, INT32_MAX);
+        assertTrue("too large", bogus.isBogus());
+    }
+}
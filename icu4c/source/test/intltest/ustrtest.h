@@ -98,6 +98,7 @@ class UnicodeStringTest: public IntlTest {
     void TestNullPointers();
     void TestUnicodeStringInsertAppendToSelf();
     void TestLargeAppend();
+    void TestArena();
 };
 
 #endif
@@ -592,6 +592,16 @@ static const TestCase testCases[]={
     // Label with 13 UChars, for 32-bit-machine testing:
     { "xn--aaaaaaaaaaaa-nlb.de", "B", "aaaaaaaaaaa\\u00FCa.de", 0 },
     { "xn--schluprfung-z6a39a.de", "B", "schlu\\u00DFpr\\u00FCfung.de", 0 },
+    // All-ASCII names that the UTF-8 fastpath processes eight bytes at a time.
+    { "WWW.Example-Domain.ORG", "B", "www.example-domain.org", 0 },
+    { "abcdefgh-ABCDEFGH.ijklmnopqrst", "B", "abcdefgh-abcdefgh.ijklmnopqrst", 0 },
+    { "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123.com", "B",
+      "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123.com",
+      UIDNA_ERROR_LABEL_TOO_LONG },
+    { "ABCDEFGHIJ-.com", "B", "abcdefghij-.com", UIDNA_ERROR_TRAILING_HYPHEN },
+    { "abcdefghij.AB--cdefghijk.com", "B", "abcdefghij.ab--cdefghijk.com", UIDNA_ERROR_HYPHEN_3_4 },
+    { "ABCDEFGHIJKLMN\\u00DCopqrstuvwxyz.de", "B", "abcdefghijklmn\\u00FCopqrstuvwxyz.de", 0 },
+    { "abcdefghij_klmnop.com", "B", "abcdefghij\\uFFFDklmnop.com", UIDNA_ERROR_DISALLOWED },
     // { "", "B",
     //   "", 0 },
 };
@@ -65,6 +65,7 @@ UTextTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(Ticket10983);
     TESTCASE_AUTO(Ticket12130);
     TESTCASE_AUTO(Ticket13344);
+    TESTCASE_AUTO(UTF8SegmentsTest);
     TESTCASE_AUTO_END;
 }
 
@@ -282,7 +283,40 @@ void UTextTest::TestString(const UnicodeString &s) {
     TestAccess(sa, ut, cpCount, u8Map);
     utext_close(ut);
 
+    // UTF-8 with known length
+    status = U_ZERO_ERROR;
+    ut = utext_openUTF8(NULL, u8String, u8Len, &status);
+    TEST_SUCCESS(status);
+    TestAccess(sa, ut, cpCount, u8Map);
+    utext_close(ut);
 
+    //
+    // Segmented UTF-8, with segments of fixed and of random sizes.
+    //   Segment boundaries fall inside of multi-byte characters,
+    //   and the random segmentation includes empty segments.
+    //
+    const char **segments = new const char *[2 * u8Len + 1];
+    int32_t *lengths = new int32_t[2 * u8Len + 1];
+    static const int32_t segmentSizes[] = { 1, 2, 3, 7, 0 /* random */ };
+    for (int32_t segmentSize : segmentSizes) {
+        int32_t count = 0;
+        for (i = 0; i < u8Len;) {
+            int32_t length = segmentSize > 0 ? segmentSize : m_rand() % 5;
+            if (length > u8Len - i) {
+                length = u8Len - i;
+            }
+            segments[count] = length > 0 ? u8String + i : NULL;
+            lengths[count++] = length;
+            i += length;
+        }
+        status = U_ZERO_ERROR;
+        ut = utext_openUTF8Segments(NULL, segments, lengths, count, &status);
+        TEST_SUCCESS(status);
+        TestAccess(sa, ut, cpCount, u8Map);
+        utext_close(ut);
+    }
+    delete []segments;
+    delete []lengths;
 
     delete []cpMap;
     delete []u8Map;
@@ -1609,3 +1643,82 @@ void UTextTest::Ticket13344() {
     assertEquals("UTextTest::Ticket13344-bmp-2", (int64_t)5, utext_getNativeIndex(ut.getAlias()));
 }
 
+
+// Segmented UTF-8 must behave like the same text in one piece,
+//   including for ill-formed sequences that are split across segments.
+void UTextTest::UTF8SegmentsTest() {
+    UErrorCode status = U_ZERO_ERROR;
+    utext_openUTF8Segments(NULL, NULL, NULL, -1, &status);
+    assertEquals("negative count", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    int32_t length = 1;
+    utext_openUTF8Segments(NULL, NULL, &length, 1, &status);
+    assertEquals("NULL segments", U_ILLEGAL_ARGUMENT_ERROR, status);
+    status = U_ZERO_ERROR;
+    const char *segment = "a";
+    length = -1;
+    utext_openUTF8Segments(NULL, &segment, &length, 1, &status);
+    assertEquals("negative length", U_ILLEGAL_ARGUMENT_ERROR, status);
+
+    status = U_ZERO_ERROR;
+    LocalUTextPointer empty(utext_openUTF8Segments(NULL, NULL, NULL, 0, &status));
+    assertSuccess("no segments", status);
+    assertEquals("no segments length", (int64_t)0, utext_nativeLength(empty.getAlias()));
+    assertEquals("no segments next32", U_SENTINEL, utext_next32From(empty.getAlias(), 0));
+    assertEquals("no segments previous32", U_SENTINEL, utext_previous32From(empty.getAlias(), 0));
+
+    static const char *const strings[] = {
+        "\x41\x81\x42\xf0\x81\x81\x43",
+        "\xc8\x81\xe1\x82\x83\xf1\x84\x85\x86",
+        "a\xe0\x80\x80" "b\xed\xa0\x80" "c\xf4\x90\x80\x80" "d\xe1\x80",
+        "\xf0\x90\x80\xe2\x82\xc2\xf0\x9f\x98\x80\xc0\xaf" "x\xf1"
+    };
+    for (const char *s : strings) {
+        int32_t sLength = (int32_t)strlen(s);
+        LocalUTextPointer expected(utext_openUTF8(NULL, s, -1, &status));
+        assertSuccess("utext_openUTF8", status);
+        UnicodeString expectedChars;
+        for (UChar32 c = utext_next32From(expected.getAlias(), 0); c >= 0; c = UTEXT_NEXT32(expected.getAlias())) {
+            expectedChars.append(c);
+        }
+        for (int32_t segmentSize = 1; segmentSize <= sLength; ++segmentSize) {
+            const char *segments[40];
+            int32_t lengths[40];
+            int32_t count = 0;
+            for (int32_t i = 0; i < sLength; i += segmentSize) {
+                segments[count] = s + i;
+                lengths[count++] = segmentSize < sLength - i ? segmentSize : sLength - i;
+            }
+            LocalUTextPointer ut(utext_openUTF8Segments(NULL, segments, lengths, count, &status));
+            if (!assertSuccess("utext_openUTF8Segments", status)) {
+                return;
+            }
+            char message[40];
+            sprintf(message, "segment size %d", (int)segmentSize);
+            for (int32_t i = 0; i <= sLength; ++i) {
+                assertEquals(message, utext_char32At(expected.getAlias(), i), utext_char32At(ut.getAlias(), i));
+                assertEquals(message, utext_next32From(expected.getAlias(), i), utext_next32From(ut.getAlias(), i));
+                assertEquals(message, utext_getNativeIndex(expected.getAlias()), utext_getNativeIndex(ut.getAlias()));
+                assertEquals(message, utext_previous32From(expected.getAlias(), i),
+                             utext_previous32From(ut.getAlias(), i));
+                assertEquals(message, utext_getNativeIndex(expected.getAlias()), utext_getNativeIndex(ut.getAlias()));
+            }
+            UChar chars[40];
+            int32_t charsLength = utext_extract(ut.getAlias(), 0, sLength, chars, 40, &status);
+            assertSuccess(message, status);
+            assertEquals(message, expectedChars, UnicodeString(chars, charsLength));
+            // Preflighting
+            charsLength = utext_extract(ut.getAlias(), 0, sLength, NULL, 0, &status);
+            assertEquals(message, U_BUFFER_OVERFLOW_ERROR, status);
+            assertEquals(message, expectedChars.length(), charsLength);
+            status = U_ZERO_ERROR;
+        }
+    }
+
+    // utext_equals() compares the text pointer.
+    const char *abc = "abc";
+    LocalUTextPointer ut1(utext_openUTF8(NULL, abc, 3, &status));
+    LocalUTextPointer ut2(utext_openUTF8(NULL, abc, 3, &status));
+    assertSuccess("utext_openUTF8", status);
+    assertTrue("equal UTexts", utext_equals(ut1.getAlias(), ut2.getAlias()));
+}
@@ -60,6 +60,10 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25,SharedFmt100);
+        TESTCASE(26,SharedFmt10000);
+        TESTCASE(27,ClonedFmt100);
+        TESTCASE(28,ClonedFmt10000);
 
 
         default: 
@@ -184,6 +188,22 @@ UPerfFunction* DateFormatPerfTest::DateFmtCreate10000(){
     return new DateFmtCreateFunction(10000, locale);
 }
 
+UPerfFunction* DateFormatPerfTest::SharedFmt100(){
+    return new SharedFmtFunction(100, 8, true, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::SharedFmt10000(){
+    return new SharedFmtFunction(10000, 8, true, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::ClonedFmt100(){
+    return new SharedFmtFunction(100, 8, false, locale);
+}
+
+UPerfFunction* DateFormatPerfTest::ClonedFmt10000(){
+    return new SharedFmtFunction(10000, 8, false, locale);
+}
+
 
 int main(int argc, const char* argv[]){
 
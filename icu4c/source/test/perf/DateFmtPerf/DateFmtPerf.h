@@ -25,6 +25,8 @@
 #include "unicode/uclean.h"
 #include "unicode/brkiter.h"
 #include "unicode/numfmt.h"
+#include "unicode/decimfmt.h"
+#include "unicode/msgfmt.h"
 #include "unicode/coll.h"
 #include "util.h"
 
@@ -38,6 +40,8 @@
 #include <fstream>
 
 #include <iostream>
+#include <thread>
+#include <vector>
 using namespace std;
 
 //  Stubs for Windows API functions when building on UNIXes.
@@ -809,6 +813,83 @@ class CollationFunction : public UPerfFunction
 	}
 };
 
+// Formats numbers and messages on several threads, either all with one frozen
+// DecimalFormat and MessageFormat, or with clones of them made by each thread.
+class SharedFmtFunction : public UPerfFunction
+{
+private:
+    int num;
+    int threadCount;
+    bool shared;
+    LocalPointer<DecimalFormat> numFmt;
+    LocalPointer<MessageFormat> msgFmt;
+
+    static void formatLoop(const DecimalFormat *nf, const MessageFormat *mf, int count) {
+        UErrorCode status = U_ZERO_ERROR;
+        FieldPosition pos(FieldPosition::DONT_CARE);
+        UnicodeString str;
+        Formattable args[2];
+        args[0].setString(UNICODE_STRING_SIMPLE("Alice"));
+        for (int i = 0; i < count; i++) {
+            str.remove();
+            nf->format(9876543210.123 + i, str, pos, status);
+            args[1].setLong(i);
+            str.remove();
+            mf->format(args, 2, str, pos, status);
+        }
+    }
+
+    static void cloneAndFormat(const DecimalFormat *nf, const MessageFormat *mf, int count) {
+        LocalPointer<DecimalFormat> nfClone(nf->clone());
+        LocalPointer<MessageFormat> mfClone(mf->clone());
+        formatLoop(nfClone.getAlias(), mfClone.getAlias(), count);
+    }
+
+public:
+    SharedFmtFunction(int a, int threads, bool isShared, const char* loc) {
+        num = a;
+        threadCount = threads;
+        shared = isShared;
+        Locale locale(loc);
+        UErrorCode status = U_ZERO_ERROR;
+        numFmt.adoptInsteadAndCheckErrorCode(
+            dynamic_cast<DecimalFormat *>(NumberFormat::createInstance(locale, status)), status);
+        msgFmt.adoptInsteadAndCheckErrorCode(new MessageFormat(
+            UNICODE_STRING_SIMPLE("{0} has {1,plural,one{# new message} other{# new messages}}."),
+            locale, status), status);
+        if (U_SUCCESS(status) && shared) {
+            numFmt->freeze(status);
+            msgFmt->freeze(status);
+        }
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "SharedFmtFunction setup failed: %s\n", u_errorName(status));
+            numFmt.adoptInstead(NULL);
+            msgFmt.adoptInstead(NULL);
+        }
+    }
+
+    virtual void call(UErrorCode* status)
+    {
+        if (numFmt.isNull() || msgFmt.isNull()) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        vector<thread> threads;
+        for (int i = 0; i < threadCount; i++) {
+            threads.push_back(thread(shared ? formatLoop : cloneAndFormat,
+                                     numFmt.getAlias(), msgFmt.getAlias(), num));
+        }
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+
+    virtual long getOperationsPerIteration()
+    {
+        return (long)num * threadCount;
+    }
+};
+
 class DateFormatPerfTest : public UPerfTest
 {
 private:
@@ -844,6 +925,10 @@ class DateFormatPerfTest : public UPerfTest
     UPerfFunction* DTPatternGeneratorCopy10000();
     UPerfFunction* DTPatternGeneratorBestValue250();
     UPerfFunction* DTPatternGeneratorBestValue10000();
+    UPerfFunction* SharedFmt100();
+    UPerfFunction* SharedFmt10000();
+    UPerfFunction* ClonedFmt100();
+    UPerfFunction* ClonedFmt10000();
 };
 
 #endif // DateFmtPerf
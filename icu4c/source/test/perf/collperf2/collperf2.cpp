@@ -1065,6 +1065,8 @@ class CollPerf2Test : public UPerfTest
     CA_uchar* randomData16;
     CA_char* randomData8;
 
+    CA_uchar* longData16;
+
     const CA_uchar* getData16(UErrorCode &status);
     const CA_char* getData8(UErrorCode &status);
 
@@ -1077,6 +1079,8 @@ class CollPerf2Test : public UPerfTest
     const CA_uchar* getRandomData16(UErrorCode &status);
     const CA_char* getRandomData8(UErrorCode &status);
 
+    const CA_uchar* getLongData16(UErrorCode &status);
+
     static CA_uchar* sortData16(
             const CA_uchar* d16,
             UComparator *cmp, const void *context,
@@ -1101,6 +1105,9 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestNextSortKeyPart_32All();
     UPerfFunction* TestNextSortKeyPart_32x2();
 
+    UPerfFunction* TestNextSortKeyPartLong_4All();
+    UPerfFunction* TestNextSortKeyPartLong_32All();
+
     UPerfFunction* TestNextSortKeyPartUTF8_4All();
     UPerfFunction* TestNextSortKeyPartUTF8_4x2();
     UPerfFunction* TestNextSortKeyPartUTF8_4x4();
@@ -1140,7 +1147,8 @@ CollPerf2Test::CollPerf2Test(int32_t argc, const char *argv[], UErrorCode &statu
     sortedData16(NULL),
     sortedData8(NULL),
     randomData16(NULL),
-    randomData8(NULL)
+    randomData8(NULL),
+    longData16(NULL)
 {
     if (U_FAILURE(status)) {
         return;
@@ -1169,6 +1177,7 @@ CollPerf2Test::~CollPerf2Test()
     delete sortedData8;
     delete randomData16;
     delete randomData8;
+    delete longData16;
 }
 
 #define MAX_NUM_DATA 10000
@@ -1324,6 +1333,38 @@ const CA_char* CollPerf2Test::getRandomData8(UErrorCode &status) {
     return randomData8 = getData8FromData16(getRandomData16(status), status);
 }
 
+// Number of test data lines joined into each long string.
+#define LONG_DATA_LINES 200
+
+const CA_uchar* CollPerf2Test::getLongData16(UErrorCode &status) {
+    if (U_FAILURE(status)) return NULL;
+    if (longData16) return longData16;
+
+    const CA_uchar* d16 = getData16(status);
+    if (U_FAILURE(status)) return NULL;
+
+    // Join groups of lines with spaces into long strings,
+    // for which sort key parts run through many iterations.
+    CA_uchar* ld16 = new CA_uchar();
+    for (int32_t i = 0; i < d16->count; i += LONG_DATA_LINES) {
+        int32_t limit = i + LONG_DATA_LINES < d16->count ? i + LONG_DATA_LINES : d16->count;
+        int32_t len = 0;
+        for (int32_t j = i; j < limit; j++) {
+            len += d16->lengthOf(j) + 1;  // including the space or NUL terminator
+        }
+        ld16->append_one(len);
+        UChar *p = ld16->last();
+        for (int32_t j = i; j < limit; j++) {
+            u_memcpy(p, d16->dataOf(j), d16->lengthOf(j));
+            p += d16->lengthOf(j);
+            *p++ = 0x20;
+        }
+        p[-1] = 0;  // NUL-terminate
+    }
+
+    return longData16 = ld16;
+}
+
 CA_uchar* CollPerf2Test::sortData16(const CA_uchar* d16,
                                     UComparator *cmp, const void *context,
                                     UErrorCode &status) {
@@ -1409,6 +1450,9 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestNextSortKeyPart_32All);
     TESTCASE_AUTO(TestNextSortKeyPart_32x2);
 
+    TESTCASE_AUTO(TestNextSortKeyPartLong_4All);
+    TESTCASE_AUTO(TestNextSortKeyPartLong_32All);
+
     TESTCASE_AUTO(TestNextSortKeyPartUTF8_4All);
     TESTCASE_AUTO(TestNextSortKeyPartUTF8_4x4);
     TESTCASE_AUTO(TestNextSortKeyPartUTF8_4x8);
@@ -1583,6 +1627,28 @@ UPerfFunction* CollPerf2Test::TestNextSortKeyPart_32x2()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestNextSortKeyPartLong_4All()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    NextSortKeyPart *testCase = new NextSortKeyPart(coll, getLongData16(status), 4 /* bufSize */);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestNextSortKeyPartLong_32All()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    NextSortKeyPart *testCase = new NextSortKeyPart(coll, getLongData16(status), 32 /* bufSize */);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPartUTF8_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -53,6 +53,8 @@
     "String Scanning(char)",                  ["$p,TestStdLibScan"         , "$p,TestScan"         ],
     "String Scanning(string)",                ["$p,TestStdLibScan1"        , "$p,TestScan1"        ],
     "String Scanning(char set)",              ["$p,TestStdLibScan2"        , "$p,TestScan2"        ],
+    "Object Construction(long string)",       ["$p,TestStdLibCtorLong"     , "$p,TestCtorLong"     ],
+    "Object Construction(long, arena)",       ["$p,TestStdLibCtorLong"     , "$p,TestCtorLongArena"],
 };
 
 my $dataFiles = {
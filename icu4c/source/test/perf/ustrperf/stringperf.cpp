@@ -153,6 +153,10 @@ UPerfFunction* StringPerformanceTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(22, TestStdLibScan1);
         TESTCASE(23, TestStdLibScan2);
 
+        TESTCASE(24, TestCtorLong);
+        TESTCASE(25, TestCtorLongArena);
+        TESTCASE(26, TestStdLibCtorLong);
+
         default: 
             name = ""; 
             return NULL;
@@ -270,6 +274,24 @@ UPerfFunction* StringPerformanceTest::TestScan2()
     }
 }
 
+UPerfFunction* StringPerformanceTest::TestCtorLong()
+{
+    if (line_mode) {
+        return new StringPerfFunction(ctorLong, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(ctorLong, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
+UPerfFunction* StringPerformanceTest::TestCtorLongArena()
+{
+    if (line_mode) {
+        return new StringPerfFunction(ctorLongArena, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(ctorLongArena, StrBuffer, StrBufferLen, uselen);
+    }
+}
+
 UPerfFunction* StringPerformanceTest::TestStdLibCtor()
 {
     if (line_mode) {
@@ -379,4 +401,12 @@ UPerfFunction* StringPerformanceTest::TestStdLibScan2()
     }
 }
 
+UPerfFunction* StringPerformanceTest::TestStdLibCtorLong()
+{
+    if (line_mode) {
+        return new StringPerfFunction(StdLibCtorLong, filelines_, numLines, uselen);
+    } else {
+        return new StringPerfFunction(StdLibCtorLong, StrBuffer, StrBufferLen, uselen);
+    }
+}
 
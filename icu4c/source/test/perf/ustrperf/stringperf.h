@@ -47,6 +47,10 @@ const stlstring sScan_STRING=stlstring(L"Dot. 123. Some more data.");
 /* global variables or constants for concatenation operation */
 U_STRING_DECL(uCatenate_STR, "!!", 2);
 const stlstring sCatenate_STR=stlstring(L"!!");
+
+/* Appended to make strings longer than the UnicodeString stack buffer */
+U_STRING_DECL(uLong_STR, "0123456789012345678901234567890123456789", 40);
+const stlstring sLong_STR=stlstring(L"0123456789012345678901234567890123456789");
 static UnicodeString* catICU;
 static stlstring* catStd;
 UBool bCatenatePrealloc;
@@ -365,6 +369,8 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestScan();
     UPerfFunction* TestScan1();
     UPerfFunction* TestScan2();
+    UPerfFunction* TestCtorLong();
+    UPerfFunction* TestCtorLongArena();
 
     UPerfFunction* TestStdLibCtor();
     UPerfFunction* TestStdLibCtor1();
@@ -378,6 +384,7 @@ class StringPerformanceTest : public UPerfTest
     UPerfFunction* TestStdLibScan();
     UPerfFunction* TestStdLibScan1();
     UPerfFunction* TestStdLibScan2();
+    UPerfFunction* TestStdLibCtorLong();
 
 private:
     long COUNT_;
@@ -449,6 +456,29 @@ inline void catenate(const UChar* src,int32_t srcLen, UnicodeString s0)
     *catICU += uCatenate_STR;
 }
 
+// Several heap-allocated temporary strings, with and without a UnicodeStringArena
+inline void ctorLong(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    UnicodeString e(src,srcLen);
+    e.append(uLong_STR, 40);
+    UnicodeString f(e);
+    f.append(s0);
+    UnicodeString g(f);
+    g.append(e);
+}
+
+inline void ctorLongArena(const UChar* src,int32_t srcLen, UnicodeString s0)
+{
+    char buffer[4096];
+    UnicodeStringArena arena(buffer, sizeof(buffer));
+    UnicodeString e(arena, srcLen + 40);
+    e.append(src, srcLen).append(uLong_STR, 40);
+    UnicodeString f(arena, e.length() + s0.length());
+    f.append(e).append(s0);
+    UnicodeString g(arena, f.length() + e.length());
+    g.append(f).append(e);
+}
+
 volatile int scan_idx;
 U_STRING_DECL(SCAN1, "123", 3);
 
@@ -496,6 +526,16 @@ inline void StdLibCtor3(const wchar_t* src,int32_t srcLen, stlstring s0)
     }
 }
 
+inline void StdLibCtorLong(const wchar_t* src,int32_t srcLen, stlstring s0)
+{
+    stlstring e = srcLen==-1 ? stlstring(src) : stlstring(src, srcLen);
+    e += sLong_STR;
+    stlstring f(e);
+    f += s0;
+    stlstring g(f);
+    g += e;
+}
+
 inline stlstring stl_assign_helper(const wchar_t* src,int32_t srcLen)
 {
     if (srcLen==-1) { return src;}
@@ -22,6 +22,13 @@
 #include "cstring.h"
 #include "errmsg.h"
 
+static GENRB_THREAD_LOCAL const char *gCurrentFileName = NULL;
+
+U_CFUNC void setCurrentFileName(const char *filename)
+{
+    gCurrentFileName = filename;
+}
+
 U_CFUNC void error(uint32_t linenumber, const char *msg, ...)
 {
     va_list va;
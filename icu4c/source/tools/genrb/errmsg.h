@@ -22,9 +22,22 @@
 
 #include "unicode/utypes.h"
 
+/*
+ * Per-file state, for processing several files in parallel
+ * (genrb --jobs).
+ */
+#if defined(_MSC_VER)
+#   define GENRB_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus)
+#   define GENRB_THREAD_LOCAL thread_local
+#else
+#   define GENRB_THREAD_LOCAL _Thread_local
+#endif
+
 U_CDECL_BEGIN
 
-extern const char *gCurrentFileName;
+/* The name of the file being processed on this thread, for error messages. */
+U_CFUNC void setCurrentFileName(const char *filename);
 
 U_CFUNC void error(uint32_t linenumber, const char *msg, ...);
 U_CFUNC void warning(uint32_t linenumber, const char *msg, ...);
@@ -18,10 +18,15 @@
 *******************************************************************************
 */
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <assert.h>
 #include "genrb.h"
@@ -36,11 +41,22 @@
 
 U_NAMESPACE_USE
 
+/* What processFile() wrote, for the --cache option. */
+struct FileOutput {
+    FileOutput() : readsOtherFiles(FALSE) {}
+
+    /* The .res file, empty if none was written. */
+    CharString fileName;
+    /* Set if the bundle imports or includes other files. */
+    UBool readsOtherFiles;
+};
+
 /* Protos */
 void  processFile(const char *filename, const char* cp,
                   const char *inputDir, const char *outputDir, const char *filterDir,
                   const char *packageName,
-                  SRBRoot *newPoolBundle, UBool omitBinaryCollation, UErrorCode &status);
+                  SRBRoot *newPoolBundle, const ResFile *usePoolBundle,
+                  UBool omitBinaryCollation, FileOutput &output, UErrorCode &status);
 static char *make_res_filename(const char *filename, const char *outputDir,
                                const char *packageName, UErrorCode &status);
 
@@ -48,7 +64,6 @@ static char *make_res_filename(const char *filename, const char *outputDir,
 #define RES_SUFFIX ".res"
 #define COL_SUFFIX ".col"
 
-const char *gCurrentFileName = NULL;
 #ifdef XP_MAC_CONSOLE
 #include <console.h>
 #endif
@@ -84,7 +99,9 @@ enum
     WRITE_POOL_BUNDLE,
     USE_POOL_BUNDLE,
     INCLUDE_UNIHAN_COLL,
-    FILTERDIR
+    FILTERDIR,
+    JOBS,
+    CACHE
 };
 
 UOption options[]={
@@ -111,6 +128,8 @@ UOption options[]={
                       UOPTION_DEF("usePoolBundle", '\x01', UOPT_OPTIONAL_ARG),/* 20 */
                       UOPTION_DEF("includeUnihanColl", '\x01', UOPT_NO_ARG),/* 21 */ /* temporary, don't display in usage info */
                       UOPTION_DEF("filterDir", '\x01', UOPT_OPTIONAL_ARG), /* 22 */
+                      UOPTION_DEF("jobs", '\x01', UOPT_REQUIRES_ARG), /* 23 */
+                      UOPTION_DEF("cache", '\x01', UOPT_REQUIRES_ARG), /* 24 */
                   };
 
 static     UBool       write_java = FALSE;
@@ -122,12 +141,115 @@ static ResFile poolBundle;
 /*added by Jing*/
 static     const char* language = NULL;
 static     const char* xliffOutputFileName = NULL;
+
+static int32_t readPoolBundleStrings(ResFile &pool, const char *poolFileName);
+
+namespace {
+
+/* FNV-1a, for detecting changed input files. */
+uint64_t hashBytes(uint64_t hash, const void *bytes, size_t length) {
+    const uint8_t *p = static_cast<const uint8_t *>(bytes);
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ p[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t hashString(uint64_t hash, const char *s) {
+    // Include the NUL so that adjacent strings do not run together.
+    return hashBytes(hash, s, uprv_strlen(s) + 1);
+}
+
+UBool hashFile(uint64_t &hash, const char *fileName) {
+    std::ifstream f(fileName, std::ios::binary);
+    if (f.fail()) {
+        return FALSE;
+    }
+    char buffer[16384];
+    do {
+        f.read(buffer, sizeof(buffer));
+        hash = hashBytes(hash, buffer, (size_t)f.gcount());
+    } while (f.good());
+    return !f.bad();
+}
+
+/*
+ * The --cache file records, for each input file that was compiled,
+ * a hash of its contents and of the options, and the .res file written.
+ * One line per file: <hash> TAB <output file> TAB <input file>
+ * An input file is skipped if its hash is unchanged and the output file exists.
+ */
+class BuildCache {
+public:
+    void load(const char *fileName) {
+        std::ifstream f(fileName);
+        std::string line;
+        while (std::getline(f, line)) {
+            size_t tab1 = line.find('\t');
+            size_t tab2 = tab1 == std::string::npos ? tab1 : line.find('\t', tab1 + 1);
+            if (tab2 == std::string::npos) {
+                continue;
+            }
+            Entry &entry = entries[line.substr(tab2 + 1)];
+            entry.hash = line.substr(0, tab1);
+            entry.outputFileName = line.substr(tab1 + 1, tab2 - tab1 - 1);
+        }
+    }
+
+    UBool save(const char *fileName) const {
+        std::ofstream f(fileName);
+        for (const auto &pair : entries) {
+            f << pair.second.hash << '\t' << pair.second.outputFileName << '\t' << pair.first << '\n';
+        }
+        f.close();
+        return !f.fail();
+    }
+
+    UBool isUpToDate(const char *inputFileName, const std::string &hash) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(inputFileName);
+        return it != entries.end() && it->second.hash == hash &&
+            T_FileStream_file_exists(it->second.outputFileName.c_str());
+    }
+
+    void put(const char *inputFileName, const std::string &hash, const char *outputFileName) {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry &entry = entries[inputFileName];
+        entry.hash = hash;
+        entry.outputFileName = outputFileName;
+    }
+
+    void remove(const char *inputFileName) {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.erase(inputFileName);
+    }
+
+private:
+    struct Entry {
+        std::string hash;
+        std::string outputFileName;
+    };
+    std::map<std::string, Entry> entries;
+    std::mutex mutex;
+};
+
+struct FileJob {
+    FileJob() : status(U_ZERO_ERROR) {}
+
+    /* The input file name as on the command line. */
+    CharString name;
+    /* With the input directory, for messages and for the cache. */
+    CharString path;
+    UErrorCode status;
+};
+
+}  // namespace
+
 int
 main(int argc,
      char* argv[])
 {
     UErrorCode  status    = U_ZERO_ERROR;
-    const char *arg       = NULL;
     const char *outputDir = NULL; /* NULL = no output directory, use current */
     const char *inputDir  = NULL;
     const char *filterDir = NULL;
@@ -167,6 +289,26 @@ main(int argc,
         }
     }
 
+    int32_t jobCount = 1;
+    if(options[JOBS].doesOccur) {
+        char *end;
+        long n = strtol(options[JOBS].value, &end, 10);
+        if(*end != 0 || n < 1 || n > 256) {
+            fprintf(stderr, "%s: invalid --jobs %s\n", argv[0], options[JOBS].value);
+            illegalArg = TRUE;
+        } else {
+            jobCount = (int32_t)n;
+        }
+    }
+    if((jobCount > 1 || options[CACHE].doesOccur) &&
+            (options[WRITE_POOL_BUNDLE].doesOccur || options[WRITE_JAVA].doesOccur ||
+             options[WRITE_XLIFF].doesOccur)) {
+        fprintf(stderr,
+                "%s: cannot combine --jobs or --cache with --writePoolBundle, --write-java or --write-xliff\n",
+                argv[0]);
+        illegalArg = TRUE;
+    }
+
     if((options[JAVA_PACKAGE].doesOccur || options[BUNDLE_NAME].doesOccur) &&
             !options[WRITE_JAVA].doesOccur) {
         fprintf(stderr,
@@ -241,6 +383,13 @@ main(int argc,
         fprintf(stderr,
                 "\t      --filterDir          Input directory where filter files are available.\n"
                 "\t                           For more on filter files, see ICU Data Build Tool.\n");
+        fprintf(stderr,
+                "\t      --jobs n             compile the input files on n threads\n"
+                "\t      --cache file         skip input files which are unchanged since the last run\n"
+                "\t                           with the same cache file and options; files which import\n"
+                "\t                           or include other files are always compiled\n"
+                "\t                           (--jobs and --cache only write .res files\n"
+                "\t                           and cannot be combined with --writePoolBundle)\n");
 
         return illegalArg ? U_ILLEGAL_ARGUMENT_ERROR : U_ZERO_ERROR;
     }
@@ -328,10 +477,11 @@ main(int argc,
         }
     }
 
+    CharString poolFileName;
+    int32_t poolFileSize = 0;
     if(options[USE_POOL_BUNDLE].doesOccur) {
         const char *poolResName = "pool.res";
         FileStream *poolFile;
-        int32_t poolFileSize;
         int32_t indexLength;
         /*
          * TODO: Consolidate inputDir/filename handling from main() and processFile()
@@ -341,7 +491,6 @@ main(int argc,
          * Share code with icupkg?
          * Also, make_res_filename() seems to be unused. Review and remove.
          */
-        CharString poolFileName;
         if (options[USE_POOL_BUNDLE].value!=NULL) {
             poolFileName.append(options[USE_POOL_BUNDLE].value, status);
         } else if (inputDir) {
@@ -418,79 +567,9 @@ main(int argc,
             }
         }
 
-        // 16BitUnits[] begins with strings-v2.
-        // The strings-v2 may optionally be terminated by what looks like
-        // an explicit string length that exceeds the number of remaining 16-bit units.
-        int32_t stringUnitsLength = (poolBundle.fIndexes[URES_INDEX_16BIT_TOP] - keysTop) * 2;
-        if (stringUnitsLength >= 2 && getFormatVersion() >= 3) {
-            poolBundle.fStrings = new PseudoListResource(NULL, status);
-            if (poolBundle.fStrings == NULL) {
-                fprintf(stderr, "unable to allocate memory for the pool bundle strings %s\n",
-                        poolFileName.data());
-                return U_MEMORY_ALLOCATION_ERROR;
-            }
-            // The PseudoListResource constructor call did not allocate further memory.
-            assert(U_SUCCESS(status));
-            const UChar *p = (const UChar *)(pRoot + keysTop);
-            int32_t remaining = stringUnitsLength;
-            do {
-                int32_t first = *p;
-                int8_t numCharsForLength;
-                int32_t length;
-                if (!U16_IS_TRAIL(first)) {
-                    // NUL-terminated
-                    numCharsForLength = 0;
-                    for (length = 0;
-                         length < remaining && p[length] != 0;
-                         ++length) {}
-                } else if (first < 0xdfef) {
-                    numCharsForLength = 1;
-                    length = first & 0x3ff;
-                } else if (first < 0xdfff && remaining >= 2) {
-                    numCharsForLength = 2;
-                    length = ((first - 0xdfef) << 16) | p[1];
-                } else if (first == 0xdfff && remaining >= 3) {
-                    numCharsForLength = 3;
-                    length = ((int32_t)p[1] << 16) | p[2];
-                } else {
-                    break;  // overrun
-                }
-                // Check for overrun before changing remaining,
-                // so that it is always accurate after the loop body.
-                if ((numCharsForLength + length) >= remaining ||
-                        p[numCharsForLength + length] != 0) {
-                    break;  // overrun or explicitly terminated
-                }
-                int32_t poolStringIndex = stringUnitsLength - remaining;
-                // Maximum pool string index when suffix-sharing the last character.
-                int32_t maxStringIndex = poolStringIndex + numCharsForLength + length - 1;
-                if (maxStringIndex >= RES_MAX_OFFSET) {
-                    // pool string index overrun
-                    break;
-                }
-                p += numCharsForLength;
-                remaining -= numCharsForLength;
-                if (length != 0) {
-                    StringResource *sr =
-                            new StringResource(poolStringIndex, numCharsForLength,
-                                               p, length, status);
-                    if (sr == NULL) {
-                        fprintf(stderr, "unable to allocate memory for a pool bundle string %s\n",
-                                poolFileName.data());
-                        return U_MEMORY_ALLOCATION_ERROR;
-                    }
-                    poolBundle.fStrings->add(sr);
-                    poolBundle.fStringIndexLimit = maxStringIndex + 1;
-                    // The StringResource constructor did not allocate further memory.
-                    assert(U_SUCCESS(status));
-                }
-                p += length + 1;
-                remaining -= length + 1;
-            } while (remaining > 0);
-            if (poolBundle.fStrings->fCount == 0) {
-                delete poolBundle.fStrings;
-                poolBundle.fStrings = NULL;
-            }
+        int32_t errorCode = readPoolBundleStrings(poolBundle, poolFileName.data());
+        if (errorCode != 0) {
+            return errorCode;
         }
 
         T_FileStream_close(poolFile);
@@ -523,27 +602,143 @@ main(int argc,
     if((argc-1)!=1) {
         printf("genrb number of files: %d\n", argc - 1);
     }
-    /* generate the binary files */
-    for(i = 1; i < argc; ++i) {
-        status = U_ZERO_ERROR;
-        arg    = getLongPathname(argv[i]);
+    BuildCache cache;
+    uint64_t optionsHash = 0xcbf29ce484222325ULL;
+    if(options[CACHE].doesOccur) {
+        cache.load(options[CACHE].value);
+        // The output also depends on the genrb version, the options and the pool bundle.
+        optionsHash = hashString(optionsHash, GENRB_VERSION);
+        optionsHash = hashString(optionsHash, U_ICU_VERSION);
+        for(i = 0; i < UPRV_LENGTHOF(options); ++i) {
+            if(options[i].doesOccur && i != VERBOSE && i != QUIET && i != JOBS && i != CACHE) {
+                optionsHash = hashBytes(optionsHash, &i, sizeof(i));
+                if(options[i].value != NULL) {
+                    optionsHash = hashString(optionsHash, options[i].value);
+                }
+            }
+        }
+        int32_t formatVersion = getFormatVersion();
+        optionsHash = hashBytes(optionsHash, &formatVersion, sizeof(formatVersion));
+        if(poolBundle.fBytes != NULL) {
+            optionsHash = hashBytes(optionsHash, poolBundle.fBytes, poolFileSize);
+        }
+    }
 
-        CharString theCurrentFileName;
+    int32_t fileCount = argc - 1;
+    LocalArray<FileJob> fileJobs(new FileJob[fileCount > 0 ? fileCount : 1]);
+    if(fileJobs.isNull()) {
+        fprintf(stderr, "out of memory error\n");
+        return U_MEMORY_ALLOCATION_ERROR;
+    }
+    for(i = 0; i < fileCount; ++i) {
+        FileJob &job = fileJobs[i];
+        job.name.append(getLongPathname(argv[i + 1]), status);
         if (inputDir) {
-            theCurrentFileName.append(inputDir, status);
+            job.path.append(inputDir, status);
         }
-        theCurrentFileName.appendPathPart(arg, status);
+        job.path.appendPathPart(job.name.toStringPiece(), status);
         if (U_FAILURE(status)) {
-            break;
+            return status;
         }
+    }
 
-        gCurrentFileName = theCurrentFileName.data();
-        if (isVerbose()) {
-            printf("Processing file \"%s\"\n", theCurrentFileName.data());
+    /* generate the binary files */
+    std::atomic<int32_t> nextFile(0);
+    auto processFiles = [&](const ResFile *usePoolBundle) {
+        int32_t k;
+        while((k = nextFile++) < fileCount) {
+            FileJob &job = fileJobs[k];
+            setCurrentFileName(job.path.data());
+
+            std::string hash;
+            if(options[CACHE].doesOccur) {
+                uint64_t h = optionsHash;
+                UBool hashed = hashFile(h, job.path.data());
+                if(hashed && filterDir != NULL) {
+                    CharString filterFileName(filterDir, job.status);
+                    filterFileName.appendPathPart(job.name.toStringPiece(), job.status);
+                    hashed = U_SUCCESS(job.status) && hashFile(h, filterFileName.data());
+                }
+                if(hashed) {
+                    char hex[20];
+                    sprintf(hex, "%016llx", (unsigned long long)h);
+                    hash = hex;
+                    if(cache.isUpToDate(job.path.data(), hash)) {
+                        if (isVerbose()) {
+                            printf("Skipping unchanged file \"%s\"\n", job.path.data());
+                        }
+                        continue;
+                    }
+                }
+            }
+
+            if (isVerbose()) {
+                printf("Processing file \"%s\"\n", job.path.data());
+            }
+            FileOutput output;
+            processFile(job.name.data(), encoding, inputDir, outputDir, filterDir, NULL,
+                        newPoolBundle.getAlias(), usePoolBundle,
+                        options[NO_BINARY_COLLATION].doesOccur, output, job.status);
+
+            if(options[CACHE].doesOccur) {
+                if(U_SUCCESS(job.status) && !hash.empty() && !output.fileName.isEmpty() &&
+                        !output.readsOtherFiles) {
+                    cache.put(job.path.data(), hash, output.fileName.data());
+                } else {
+                    cache.remove(job.path.data());
+                }
+            }
         }
-        processFile(arg, encoding, inputDir, outputDir, filterDir, NULL,
-                    newPoolBundle.getAlias(),
-                    options[NO_BINARY_COLLATION].doesOccur, status);
+    };
+
+    const ResFile *usePoolBundle = options[USE_POOL_BUNDLE].doesOccur ? &poolBundle : NULL;
+    if(jobCount > fileCount) {
+        jobCount = fileCount;
+    }
+    if(jobCount <= 1) {
+        processFiles(usePoolBundle);
+    } else {
+        // Writing a bundle modifies the pool bundle strings: Give each thread its own.
+        LocalArray<ResFile> threadPoolBundles;
+        if(usePoolBundle != NULL && poolBundle.fStrings != NULL) {
+            threadPoolBundles.adoptInstead(new ResFile[jobCount - 1]);
+            if(threadPoolBundles.isNull()) {
+                fprintf(stderr, "out of memory error\n");
+                return U_MEMORY_ALLOCATION_ERROR;
+            }
+            for(i = 0; i < jobCount - 1; ++i) {
+                ResFile &pool = threadPoolBundles[i];
+                pool.fIndexes = poolBundle.fIndexes;
+                pool.fKeys = poolBundle.fKeys;
+                pool.fKeysLength = poolBundle.fKeysLength;
+                pool.fKeysCount = poolBundle.fKeysCount;
+                pool.fChecksum = poolBundle.fChecksum;
+                int32_t errorCode = readPoolBundleStrings(pool, poolFileName.data());
+                if(errorCode != 0) {
+                    return errorCode;
+                }
+            }
+        }
+        std::vector<std::thread> threads;
+        for(i = 0; i < jobCount - 1; ++i) {
+            threads.emplace_back(processFiles,
+                                 threadPoolBundles.isValid() ? &threadPoolBundles[i] : usePoolBundle);
+        }
+        processFiles(usePoolBundle);
+        for(std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+    status = U_ZERO_ERROR;
+    for(i = 0; i < fileCount; ++i) {
+        if(U_FAILURE(fileJobs[i].status)) {
+            status = fileJobs[i].status;
+            break;
+        }
+    }
+    if(options[CACHE].doesOccur && !cache.save(options[CACHE].value)) {
+        fprintf(stderr, "unable to write the cache file %s\n", options[CACHE].value);
     }
 
     poolBundle.close();
@@ -572,13 +767,101 @@ main(int argc,
     return status;
 }
 
+/*
+ * Reads the strings of a pool bundle whose other fields are set,
+ * into new StringResource objects.
+ * Each thread needs its own, because writing a bundle modifies them.
+ * Returns 0 or an error code.
+ */
+static int32_t
+readPoolBundleStrings(ResFile &pool, const char *poolFileName) {
+    UErrorCode status = U_ZERO_ERROR;
+    const int32_t *pRoot = pool.fIndexes - 1;
+    int32_t keysTop = pool.fIndexes[URES_INDEX_KEYS_TOP];
+    // 16BitUnits[] begins with strings-v2.
+    // The strings-v2 may optionally be terminated by what looks like
+    // an explicit string length that exceeds the number of remaining 16-bit units.
+    int32_t stringUnitsLength = (pool.fIndexes[URES_INDEX_16BIT_TOP] - keysTop) * 2;
+    if (stringUnitsLength >= 2 && getFormatVersion() >= 3) {
+        pool.fStrings = new PseudoListResource(NULL, status);
+        if (pool.fStrings == NULL) {
+            fprintf(stderr, "unable to allocate memory for the pool bundle strings %s\n",
+                    poolFileName);
+            return U_MEMORY_ALLOCATION_ERROR;
+        }
+        // The PseudoListResource constructor call did not allocate further memory.
+        assert(U_SUCCESS(status));
+        const UChar *p = (const UChar *)(pRoot + keysTop);
+        int32_t remaining = stringUnitsLength;
+        do {
+            int32_t first = *p;
+            int8_t numCharsForLength;
+            int32_t length;
+            if (!U16_IS_TRAIL(first)) {
+                // NUL-terminated
+                numCharsForLength = 0;
+                for (length = 0;
+                     length < remaining && p[length] != 0;
+                     ++length) {}
+            } else if (first < 0xdfef) {
+                numCharsForLength = 1;
+                length = first & 0x3ff;
+            } else if (first < 0xdfff && remaining >= 2) {
+                numCharsForLength = 2;
+                length = ((first - 0xdfef) << 16) | p[1];
+            } else if (first == 0xdfff && remaining >= 3) {
+                numCharsForLength = 3;
+                length = ((int32_t)p[1] << 16) | p[2];
+            } else {
+                break;  // overrun
+            }
+            // Check for overrun before changing remaining,
+            // so that it is always accurate after the loop body.
+            if ((numCharsForLength + length) >= remaining ||
+                    p[numCharsForLength + length] != 0) {
+                break;  // overrun or explicitly terminated
+            }
+            int32_t poolStringIndex = stringUnitsLength - remaining;
+            // Maximum pool string index when suffix-sharing the last character.
+            int32_t maxStringIndex = poolStringIndex + numCharsForLength + length - 1;
+            if (maxStringIndex >= RES_MAX_OFFSET) {
+                // pool string index overrun
+                break;
+            }
+            p += numCharsForLength;
+            remaining -= numCharsForLength;
+            if (length != 0) {
+                StringResource *sr =
+                        new StringResource(poolStringIndex, numCharsForLength,
+                                           p, length, status);
+                if (sr == NULL) {
+                    fprintf(stderr, "unable to allocate memory for a pool bundle string %s\n",
+                            poolFileName);
+                    return U_MEMORY_ALLOCATION_ERROR;
+                }
+                pool.fStrings->add(sr);
+                pool.fStringIndexLimit = maxStringIndex + 1;
+                // The StringResource constructor did not allocate further memory.
+                assert(U_SUCCESS(status));
+            }
+            p += length + 1;
+            remaining -= length + 1;
+        } while (remaining > 0);
+        if (pool.fStrings->fCount == 0) {
+            delete pool.fStrings;
+            pool.fStrings = NULL;
+        }
+    }
+    return 0;
+}
+
 /* Process a file */
 void
 processFile(const char *filename, const char *cp,
             const char *inputDir, const char *outputDir, const char *filterDir,
             const char *packageName,
-            SRBRoot *newPoolBundle,
-            UBool omitBinaryCollation, UErrorCode &status) {
+            SRBRoot *newPoolBundle, const ResFile *usePoolBundle,
+            UBool omitBinaryCollation, FileOutput &output, UErrorCode &status) {
     LocalPointer<SRBRoot> data;
     LocalUCHARBUFPointer ucbuf;
     CharString openFileName;
@@ -719,8 +1002,8 @@ processFile(const char *filename, const char *cp,
         }
     }
 
-    if(options[USE_POOL_BUNDLE].doesOccur) {
-        data->fUsePoolBundle = &poolBundle;
+    if(usePoolBundle != NULL) {
+        data->fUsePoolBundle = usePoolBundle;
     }
 
     /* Determine the target rb filename */
@@ -741,7 +1024,19 @@ processFile(const char *filename, const char *cp,
     }else{
         /* Write the data to the file */
         data->write(outputDir, packageName, outputFileName, sizeof(outputFileName), status);
+        if (U_SUCCESS(status)) {
+            if (outputDir != NULL) {
+                output.fileName.append(outputDir, status);
+            }
+            CharString resName;
+            if (packageName != NULL) {
+                resName.append(packageName, status).append('_', status);
+            }
+            resName.append(data->fLocale, status).append(RES_SUFFIX, status);
+            output.fileName.appendPathPart(resName.toStringPiece(), status);
+        }
     }
+    output.readsOtherFiles = data->fReadsOtherFiles;
     if (U_FAILURE(status)) {
         fprintf(stderr, "couldn't write bundle %s. Error:%s\n", outputFileName, u_errorName(status));
     }
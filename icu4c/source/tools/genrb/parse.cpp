@@ -119,6 +119,7 @@ typedef struct {
     const char     *filename;
     UBool           makeBinaryCollation;
     UBool           omitCollationRules;
+    ArrayResource  *dependencyArray;
 } ParseState;
 
 typedef struct SResource *
@@ -142,14 +143,8 @@ static struct SResource *parseResource(ParseState* state, char *tag, const struc
 static void
 initLookahead(ParseState* state, UCHARBUF *buf, UErrorCode *status)
 {
-    static uint32_t initTypeStrings = 0;
     uint32_t i;
 
-    if (!initTypeStrings)
-    {
-        initTypeStrings = 1;
-    }
-
     state->lookaheadPosition   = 0;
     state->buffer              = buf;
 
@@ -359,6 +354,7 @@ parseUCARules(ParseState* state, char *tag, uint32_t startline, const struct USt
         return res_none();
     }
 
+    state->bundle->fReadsOtherFiles = TRUE;
     ucbuf = ucbuf_open(filename, &cp, getShowWarning(),FALSE, status);
 
     if (U_FAILURE(*status)) {
@@ -497,6 +493,7 @@ parseTransliterator(ParseState* state, char *tag, uint32_t startline, const stru
     uprv_strcat(filename, cs);
 
 
+    state->bundle->fReadsOtherFiles = TRUE;
     ucbuf = ucbuf_open(filename, &cp, getShowWarning(),FALSE, status);
 
     if (U_FAILURE(*status)) {
@@ -526,8 +523,6 @@ parseTransliterator(ParseState* state, char *tag, uint32_t startline, const stru
 
     return result;
 }
-static ArrayResource* dependencyArray = NULL;
-
 static struct SResource *
 parseDependency(ParseState* state, char *tag, uint32_t startline, const struct UString* comment, UErrorCode *status)
 {
@@ -573,15 +568,15 @@ parseDependency(ParseState* state, char *tag, uint32_t startline, const struct U
             warning(line, "The dependency file %s does not exist. Please make sure it exists.\n",filename);
         }
     }
-    if(dependencyArray==NULL){
-        dependencyArray = array_open(state->bundle, "%%DEPENDENCY", NULL, status);
+    if(state->dependencyArray==NULL){
+        state->dependencyArray = array_open(state->bundle, "%%DEPENDENCY", NULL, status);
     }
     if(tag!=NULL){
         result = string_open(state->bundle, tag, tokenValue->fChars, tokenValue->fLength, comment, status);
     }
     elem = string_open(state->bundle, NULL, tokenValue->fChars, tokenValue->fLength, comment, status);
 
-    dependencyArray->add(elem);
+    state->dependencyArray->add(elem);
 
     if (U_FAILURE(*status))
     {
@@ -678,7 +673,8 @@ static struct SResource* resLookup(struct SResource* res, const char* key){
 
 class GenrbImporter : public icu::CollationRuleParser::Importer {
 public:
-    GenrbImporter(const char *in, const char *out) : inputDir(in), outputDir(out) {}
+    GenrbImporter(const char *in, const char *out, SRBRoot *b)
+            : inputDir(in), outputDir(out), bundle(b) {}
     virtual ~GenrbImporter();
     virtual void getRules(
             const char *localeID, const char *collationType,
@@ -688,6 +684,7 @@ class GenrbImporter : public icu::CollationRuleParser::Importer {
 private:
     const char *inputDir;
     const char *outputDir;
+    SRBRoot *bundle;
 };
 
 GenrbImporter::~GenrbImporter() {}
@@ -697,6 +694,7 @@ GenrbImporter::getRules(
         const char *localeID, const char *collationType,
         UnicodeString &rules,
         const char *& /*errorReason*/, UErrorCode &errorCode) {
+    bundle->fReadsOtherFiles = TRUE;
     CharString filename(localeID, errorCode);
     for(int32_t i = 0; i < filename.length(); i++){
         if(filename[i] == '-'){
@@ -945,7 +943,7 @@ addCollation(ParseState* state, TableResource  *result, const char *collationTyp
     UErrorCode intStatus = U_ZERO_ERROR;
     UParseError parseError;
     uprv_memset(&parseError, 0, sizeof(parseError));
-    GenrbImporter importer(state->inputdir, state->outputdir);
+    GenrbImporter importer(state->inputdir, state->outputdir, state->bundle);
     const icu::CollationTailoring *base = icu::CollationRoot::getRoot(intStatus);
     if(U_FAILURE(intStatus)) {
         error(line, "failed to load root collator (ucadata.icu) - %s", u_errorName(intStatus));
@@ -1595,6 +1593,7 @@ parseImport(ParseState* state, char *tag, uint32_t startline, const struct UStri
         return NULL;
     }
 
+    state->bundle->fReadsOtherFiles = TRUE;
     FileStream *file = T_FileStream_open(fullname.data(), "rb");
     if (file == NULL)
     {
@@ -1681,6 +1680,7 @@ parseInclude(ParseState* state, char *tag, uint32_t startline, const struct UStr
         uprv_strcpy(fullname,filename);
     }
 
+    state->bundle->fReadsOtherFiles = TRUE;
     ucbuf = ucbuf_open(fullname, &cp,getShowWarning(),FALSE,status);
 
     if (U_FAILURE(*status)) {
@@ -1992,6 +1992,7 @@ parse(UCHARBUF *buf, const char *inputDir, const char *outputDir, const char *fi
     state.filename = filename;
     state.makeBinaryCollation = makeBinaryCollation;
     state.omitCollationRules = omitCollationRules;
+    state.dependencyArray = NULL;
 
     ustr_init(&comment);
     expect(&state, TOK_STRING, &tokenValue, &comment, NULL, status);
@@ -2060,14 +2061,14 @@ parse(UCHARBUF *buf, const char *inputDir, const char *outputDir, const char *fi
     assert(state.bundle->fRoot->fType == URES_TABLE);
     TableResource *rootTable = static_cast<TableResource *>(state.bundle->fRoot);
     realParseTable(&state, rootTable, NULL, line, status);
-    if(dependencyArray!=NULL){
-        rootTable->add(dependencyArray, 0, *status);
-        dependencyArray = NULL;
+    if(state.dependencyArray!=NULL){
+        rootTable->add(state.dependencyArray, 0, *status);
+        state.dependencyArray = NULL;
     }
    if (U_FAILURE(*status))
     {
         delete state.bundle;
-        res_close(dependencyArray);
+        res_close(state.dependencyArray);
         return NULL;
     }
 
@@ -36,7 +36,7 @@
 #define CR           0x000D
 #define LF           0x000A
                
-static int32_t lineCount;
+static GENRB_THREAD_LOCAL int32_t lineCount;
 
 /* Protos */
 static enum ETokenType getStringToken(UCHARBUF *buf,
@@ -92,7 +92,7 @@ static const ResFile kNoPoolBundle;
  */
 static SResource kNoResource;  // TODO: const
 
-static UDataInfo dataInfo= {
+static const UDataInfo dataInfo= {
     sizeof(UDataInfo),
     0,
 
@@ -988,10 +988,12 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
         uprv_strcpy(dataName, fLocale);
     }
 
-    uprv_memcpy(dataInfo.formatVersion, gFormatVersions + formatVersion, sizeof(UVersionInfo));
+    // Bundles may be written concurrently (genrb --jobs): Do not modify the shared dataInfo.
+    UDataInfo info = dataInfo;
+    uprv_memcpy(info.formatVersion, gFormatVersions + formatVersion, sizeof(UVersionInfo));
 
     mem = udata_create(outputDir, "res", dataName,
-                       &dataInfo, (gIncludeCopyright==TRUE)? U_COPYRIGHT_STRING:NULL, &errorCode);
+                       &info, (gIncludeCopyright==TRUE)? U_COPYRIGHT_STRING:NULL, &errorCode);
     if(U_FAILURE(errorCode)){
         return;
     }
@@ -1136,7 +1138,7 @@ SRBRoot::SRBRoot(const UString *comment, UBool isPoolBundle, UErrorCode &errorCo
           f16BitUnits(), f16BitStringsLength(0),
           fUsePoolBundle(&kNoPoolBundle),
           fPoolStringIndexLimit(0), fPoolStringIndex16Limit(0), fLocalStringIndexLimit(0),
-          fWritePoolBundle(NULL) {
+          fWritePoolBundle(NULL), fReadsOtherFiles(FALSE) {
     if (U_FAILURE(errorCode)) {
         return;
     }
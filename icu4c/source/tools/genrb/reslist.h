@@ -120,6 +120,8 @@ struct SRBRoot {
   int32_t fPoolStringIndex16Limit;
   int32_t fLocalStringIndexLimit;
   SRBRoot *fWritePoolBundle;
+  /* Set when parsing reads files other than the bundle source, see genrb --cache. */
+  UBool fReadsOtherFiles;
 };
 
 /* write a java resource file */
@@ -60,6 +60,7 @@ printUsage(const char *pname, UBool isHelp) {
             "\t[-a list] [-r list] [-x list] [-l [-o outputListFileName]]\n"
             "\t[-s path] [-d path] [-w] [-m mode]\n"
             "\t[--auto_toc_prefix] [--auto_toc_prefix_with_type] [--toc_prefix]\n"
+            "\t[--hot_items list [--page_size size]] [--toc_index]\n"
             "\tinfilename [outfilename]\n",
             isHelp ? 'U' : 'u', pname);
     if(isHelp) {
@@ -144,6 +145,22 @@ printUsage(const char *pname, UBool isHelp) {
             "\t                             Overrides the package basename\n"
             "\t                             and --auto_toc_prefix.\n"
             "\t                             Cannot be combined with --auto_toc_prefix_with_type.\n");
+        fprintf(where,
+            "\n"
+            "\t--hot_items list             store the listed items' data first\n"
+            "\t                             The list is a .txt file with item names\n"
+            "\t                             in the order in which they are typically\n"
+            "\t                             loaded, for example from a trace of\n"
+            "\t                             udata_openChoice() calls. Their data is\n"
+            "\t                             stored in this order starting at a page\n"
+            "\t                             boundary, and the other items start at\n"
+            "\t                             the next page boundary. The ToC remains\n"
+            "\t                             sorted. Implies --writepkg.\n"
+            "\t--page_size size             page size for --hot_items (default 4096)\n"
+            "\t--toc_index                  add a hash index for faster item lookups\n"
+            "\t                             An index in the input package is always\n"
+            "\t                             regenerated for the output package.\n"
+            "\t                             Implies --writepkg.\n");
         /*
          * Usage text columns, starting after the initial TAB.
          *      1         2         3         4         5         6         7         8
@@ -207,7 +224,11 @@ static UOption options[]={
 
     UOPTION_DEF("auto_toc_prefix", '\1', UOPT_NO_ARG),
     UOPTION_DEF("auto_toc_prefix_with_type", '\1', UOPT_NO_ARG),
-    UOPTION_DEF("toc_prefix", '\1', UOPT_REQUIRES_ARG)
+    UOPTION_DEF("toc_prefix", '\1', UOPT_REQUIRES_ARG),
+
+    UOPTION_DEF("hot_items", '\1', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("page_size", '\1', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("toc_index", '\1', UOPT_NO_ARG)
 };
 
 enum {
@@ -236,6 +257,10 @@ enum {
     OPT_AUTO_TOC_PREFIX_WITH_TYPE,
     OPT_TOC_PREFIX,
 
+    OPT_HOT_ITEMS,
+    OPT_PAGE_SIZE,
+    OPT_TOC_INDEX,
+
     OPT_COUNT
 };
 
@@ -376,7 +401,10 @@ main(int argc, char *argv[]) {
         outType=0; /* tells extractItem() to not swap */
     }
 
-    if(options[OPT_WRITEPKG].doesOccur) {
+    if( options[OPT_WRITEPKG].doesOccur ||
+        options[OPT_HOT_ITEMS].doesOccur ||
+        options[OPT_TOC_INDEX].doesOccur
+    ) {
         isModified=TRUE;
     }
 
@@ -391,7 +419,10 @@ main(int argc, char *argv[]) {
             options[OPT_REMOVE_LIST].doesOccur ||
             options[OPT_ADD_LIST].doesOccur ||
             options[OPT_EXTRACT_LIST].doesOccur ||
-            options[OPT_LIST_ITEMS].doesOccur
+            options[OPT_LIST_ITEMS].doesOccur ||
+            options[OPT_HOT_ITEMS].doesOccur ||
+            options[OPT_PAGE_SIZE].doesOccur ||
+            options[OPT_TOC_INDEX].doesOccur
         ) {
             printUsage(pname, FALSE);
             return U_ILLEGAL_ARGUMENT_ERROR;
@@ -414,6 +445,19 @@ main(int argc, char *argv[]) {
         outComment=NULL;
     }
 
+    if(options[OPT_PAGE_SIZE].doesOccur) {
+        char *end;
+        long pageSize=strtol(options[OPT_PAGE_SIZE].value, &end, 10);
+        // a power of 2 from 16 to 1M
+        if( !options[OPT_HOT_ITEMS].doesOccur || *end!=0 ||
+            pageSize<16 || pageSize>0x100000 || (pageSize&(pageSize-1))!=0
+        ) {
+            printUsage(pname, FALSE);
+            return U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        pkg->setPageSize((int32_t)pageSize);
+    }
+
     if(options[OPT_MATCHMODE].doesOccur) {
         if(0==strcmp(options[OPT_MATCHMODE].value, "noslash")) {
             pkg->setMatchMode(Package::MATCH_NOSLASH);
@@ -536,6 +580,12 @@ main(int argc, char *argv[]) {
         if(options[OPT_TOC_PREFIX].doesOccur) {
             pkg->setPrefix(options[OPT_TOC_PREFIX].value);
         }
+        if(options[OPT_HOT_ITEMS].doesOccur) {
+            readHotItems(options[OPT_HOT_ITEMS].value, pkg);
+        }
+        if(options[OPT_TOC_INDEX].doesOccur) {
+            pkg->setTOCIndex();
+        }
         result = writePackageDatFile(outFilename, outComment, NULL, NULL, pkg, outType);
     }
 
@@ -126,7 +126,9 @@ enum {
     PDS_BUILD,
     WIN_UWP_BUILD,
     WIN_DLL_ARCH,
-    WIN_DYNAMICBASE
+    WIN_DYNAMICBASE,
+    HOT_ITEMS,
+    TOC_INDEX
 };
 
 /* This sets the modes that are available */
@@ -172,6 +174,8 @@ static UOption options[]={
     /*22*/    UOPTION_DEF("windows-uwp-build", 'u', UOPT_NO_ARG),
     /*23*/    UOPTION_DEF("windows-DLL-arch", 'a', UOPT_REQUIRES_ARG),
     /*24*/    UOPTION_DEF("windows-dynamicbase", 'b', UOPT_NO_ARG),
+    /*25*/    UOPTION_DEF("hot-items", 'H', UOPT_REQUIRES_ARG),
+    /*26*/    UOPTION_DEF("toc-index", 'x', UOPT_NO_ARG),
 };
 
 /* This enum and the following char array should be kept in sync. */
@@ -264,6 +268,8 @@ const char options_help[][320]={
     "Build for Universal Windows Platform (Windows build only)",
     "Specify the DLL machine architecture for LINK.exe (Windows build only)",
     "Ignored. Enable DYNAMICBASE on the DLL. This is now the default. (Windows build only)",
+    "Store the data of the items listed in this file first, in the listed order, page-aligned",
+    "Add a hash index for faster item lookups to the common data file",
 };
 
 const char  *progname = "PKGDATA";
@@ -463,6 +469,11 @@ main(int argc, char* argv[]) {
         o.entryName = o.cShortName;
     }
 
+    if (options[HOT_ITEMS].doesOccur) {
+        o.hotItems = options[HOT_ITEMS].value;
+    }
+    o.tocIndex = options[TOC_INDEX].doesOccur;
+
     o.withoutAssembly = FALSE;
     if (options[WITHOUT_ASSEMBLY].doesOccur) {
 #ifndef BUILD_DATA_WITHOUT_ASSEMBLY
@@ -611,7 +622,7 @@ static int32_t pkg_executeOptions(UPKGOptions *o) {
         if(o->verbose) {
           fprintf(stdout, "# Writing package file %s ..\n", datFileNamePath);
         }
-        result = writePackageDatFile(datFileNamePath, o->comment, o->srcDir, o->fileListFiles->str, NULL, U_CHARSET_FAMILY ? 'e' :  U_IS_BIG_ENDIAN ? 'b' : 'l');
+        result = writePackageDatFile(datFileNamePath, o->comment, o->srcDir, o->fileListFiles->str, NULL, U_CHARSET_FAMILY ? 'e' :  U_IS_BIG_ENDIAN ? 'b' : 'l', o->hotItems, o->tocIndex);
         if (result != 0) {
             fprintf(stderr,"Error writing package dat file.\n");
             return result;
@@ -124,11 +124,13 @@ typedef struct UPKGOptions_
   const char *install;     /* Where to install to (NULL = don't install) */
   const char *icuroot;     /* where does ICU lives */
   const char *libName;     /* name for library (default: shortName) */
+  const char *hotItems;    /* list file of items to store first (NULL = ToC order) */
   UBool      rebuild;
   UBool      verbose;
   UBool      quiet;
   UBool      withoutAssembly;
   UBool      pdsbuild;     /* for building PDS in z/OS */
+  UBool      tocIndex;     /* add a ToC hash index to the common data file */
 } UPKGOptions;
 
 char * convertToNativePathSeparators(char *path);
@@ -59,6 +59,24 @@ static const UDataInfo dataInfo={
     {3, 0, 0, 0}                  /* dataVersion */
 };
 
+/* UDataInfo for the ToC hash index item, see ucmndata.h */
+static const UDataInfo tocIndexDataInfo={
+    (uint16_t)sizeof(UDataInfo),
+    0,
+
+    U_IS_BIG_ENDIAN,
+    U_CHARSET_FAMILY,
+    (uint8_t)sizeof(UChar),
+    0,
+
+    {0x54, 0x6f, 0x43, 0x49},     /* dataFormat="ToCI" */
+    {1, 0, 0, 0},                 /* formatVersion */
+    {0, 0, 0, 0}                  /* dataVersion */
+};
+
+/* length of the ToC hash index item's DataHeader, padded to a multiple of 16 */
+static const int32_t kTOCIndexHeaderLength=32;
+
 U_CDECL_BEGIN
 static void U_CALLCONV
 printPackageError(void *context, const char *fmt, va_list args) {
@@ -377,12 +395,44 @@ compareItems(const void * /*context*/, const void *left, const void *right) {
     return (int32_t)strcmp(((Item *)left)->name, ((Item *)right)->name);
 }
 
+/* compares the data pointers of the items[] (context) at the left and right indexes */
+static int32_t U_CALLCONV
+compareItemData(const void *context, const void *left, const void *right) {
+    U_NAMESPACE_USE
+
+    const Item *items=(const Item *)context;
+    const uint8_t *leftData=items[*(const int32_t *)left].data;
+    const uint8_t *rightData=items[*(const int32_t *)right].data;
+    return leftData<rightData ? -1 : leftData==rightData ? 0 : 1;
+}
+
 U_CDECL_END
 
+/*
+ * Returns the length of an item's data rounded up to 16 like in a package,
+ * but at most maxLength, the distance to the next item's data.
+ * This excludes padding between items, like the page padding after the hot items,
+ * which must not become part of the item.
+ * Returns maxLength for data formats that udata_swap() does not know.
+ */
+static int32_t
+getItemDataLength(UDataSwapper *ds, const uint8_t *data, int32_t maxLength) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UDataPrintError *printError=ds->printError;
+    ds->printError=NULL;
+    int32_t length=udata_swap(ds, data, -1, NULL, &errorCode);
+    ds->printError=printError;
+    if(U_FAILURE(errorCode) || length<=0) {
+        return maxLength;
+    }
+    length=(length+15)&~15;
+    return length<maxLength ? length : maxLength;
+}
+
 U_NAMESPACE_BEGIN
 
 Package::Package()
-        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE) {
+        : doAutoPrefix(FALSE), prefixEndsWithType(FALSE), doTOCIndex(FALSE) {
     inPkgName[0]=0;
     pkgPrefix[0]=0;
     inData=NULL;
@@ -401,6 +451,10 @@ Package::Package()
     findPrefixLength=findSuffixLength=0;
     findNextIndex=-1;
 
+    hotNames=NULL;
+    hotNamesLength=hotNamesCapacity=0;
+    pageSize=4096;
+
     // create a header for an empty package
     DataHeader *pHeader;
     pHeader=(DataHeader *)header;
@@ -429,6 +483,24 @@ Package::~Package() {
     }
 
     uprv_free((void*)items);
+    uprv_free(hotNames);
+}
+
+void
+Package::addHotItem(const char *name) {
+    int32_t length=(int32_t)strlen(name)+1;
+    if((hotNamesLength+length)>hotNamesCapacity) {
+        int32_t newCapacity=2*hotNamesCapacity+length+1000;
+        char *newNames=(char *)uprv_realloc(hotNames, newCapacity);
+        if(newNames==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        hotNames=newNames;
+        hotNamesCapacity=newCapacity;
+    }
+    memcpy(hotNames+hotNamesLength, name, length);
+    hotNamesLength+=length;
 }
 
 void
@@ -450,6 +522,7 @@ Package::readPackage(const char *filename) {
 
     int32_t length, offset, i;
     int32_t itemLength, typeEnum;
+    uint32_t dataOffset, minDataOffset=0, maxDataOffset;
     char type;
 
     const UDataOffsetTOCEntry *inEntries;
@@ -520,8 +593,22 @@ Package::readPackage(const char *filename) {
             /* ToC table does not fit */
             offset=0x7fffffff;
         } else {
-            /* offset of the last item plus at least 20 bytes for its header */
-            offset=20+(int32_t)ds->readUInt32(inEntries[itemCount-1].dataOffset);
+            /*
+             * offset of the last item plus at least 20 bytes for its header;
+             * the items need not be stored in ToC order (see addHotItem())
+             */
+            minDataOffset=0xffffffff;
+            maxDataOffset=0;
+            for(i=0; i<itemCount; ++i) {
+                dataOffset=ds->readUInt32(inEntries[i].dataOffset);
+                if(dataOffset<minDataOffset) {
+                    minDataOffset=dataOffset;
+                }
+                if(dataOffset>maxDataOffset) {
+                    maxDataOffset=dataOffset;
+                }
+            }
+            offset=20+(int32_t)maxDataOffset;
         }
     }
     if(length<offset) {
@@ -547,7 +634,7 @@ Package::readPackage(const char *filename) {
 
         /* swap the item name strings */
         int32_t stringsOffset=4+8*itemCount;
-        itemLength=(int32_t)(ds->readUInt32(inEntries[0].dataOffset))-stringsOffset;
+        itemLength=(int32_t)minDataOffset-stringsOffset;
 
         // don't include padding bytes at the end of the item names
         while(itemLength>0 && inBytes[stringsOffset+itemLength-1]!=0) {
@@ -644,34 +731,52 @@ Package::readPackage(const char *filename) {
 
             // set the item's data
             items[i].data=(uint8_t *)inBytes+ds->readUInt32(inEntries[i].dataOffset);
-            if(i>0) {
-                items[i-1].length=(int32_t)(items[i].data-items[i-1].data);
-
-                // set the previous item's platform type
-                typeEnum=getTypeEnumForInputData(items[i-1].data, items[i-1].length, &errorCode);
-                if(typeEnum<0 || U_FAILURE(errorCode)) {
-                    fprintf(stderr, "icupkg: not an ICU data file: item \"%s\" in \"%s\"\n", items[i-1].name, filename);
-                    exit(U_INVALID_FORMAT_ERROR);
-                }
-                items[i-1].type=makeTypeLetter(typeEnum);
-            }
             items[i].isDataOwned=FALSE;
         }
-        // set the last item's length
-        items[itemCount-1].length=length-ds->readUInt32(inEntries[itemCount-1].dataOffset);
 
-        // set the last item's platform type
-        typeEnum=getTypeEnumForInputData(items[itemCount-1].data, items[itemCount-1].length, &errorCode);
-        if(typeEnum<0 || U_FAILURE(errorCode)) {
-            fprintf(stderr, "icupkg: not an ICU data file: item \"%s\" in \"%s\"\n", items[itemCount-1].name, filename);
-            exit(U_INVALID_FORMAT_ERROR);
+        // set each item's length to the distance to the next item in the data,
+        // or for the last one to the end of the package,
+        // without padding after the item's actual data
+        LocalMemory<int32_t> byData;
+        if(byData.allocateInsteadAndReset(itemCount)==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        for(i=0; i<itemCount; ++i) {
+            byData[i]=i;
+        }
+        uprv_sortArray(byData.getAlias(), itemCount, (int32_t)sizeof(int32_t),
+                       compareItemData, items, TRUE, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            fprintf(stderr, "icupkg: sorting item offsets failed - %s\n", u_errorName(errorCode));
+            exit(errorCode);
+        }
+        for(i=0; i<itemCount; ++i) {
+            Item &item=items[byData[i]];
+            const uint8_t *limit= (i+1)<itemCount ? items[byData[i+1]].data : inBytes+length;
+            item.length=(int32_t)(limit-item.data);
+
+            // set the item's platform type
+            typeEnum=getTypeEnumForInputData(item.data, item.length, &errorCode);
+            if(typeEnum<0 || U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: not an ICU data file: item \"%s\" in \"%s\"\n", item.name, filename);
+                exit(U_INVALID_FORMAT_ERROR);
+            }
+            item.type=makeTypeLetter(typeEnum);
+            item.length=getItemDataLength(ds, item.data, item.length);
         }
-        items[itemCount-1].type=makeTypeLetter(typeEnum);
 
         if(type!=U_ICUDATA_TYPE_LETTER[0]) {
             // sort the item names for the local charset
             sortItems();
         }
+
+        // a ToC hash index only fits the input ToC: writePackage() regenerates it
+        int32_t tocIndexItem=findItem(UDATA_TOC_INDEX_NAME);
+        if(tocIndexItem>=0) {
+            removeItem(tocIndexItem);
+            doTOCIndex=TRUE;
+        }
     }
 
     udata_closeSwapper(ds);
@@ -682,6 +787,88 @@ Package::getInType() {
     return makeTypeLetter(inCharset, inIsBigEndian);
 }
 
+/*
+ * Build the buckets and slots of a ToC hash index (see ucmndata.h)
+ * for the item names with the given hash seed.
+ * The buckets are processed from the largest to the smallest,
+ * and each one gets the first seed that puts all of its names into free slots.
+ * Returns FALSE if that fails for some bucket.
+ */
+static UBool
+buildTOCIndex(const Item *items, int32_t itemCount, uint32_t hashSeed,
+              int32_t bucketCount, uint16_t *seeds, int32_t slotCount, uint16_t *slots) {
+    LocalMemory<uint32_t> hashes;
+    LocalMemory<int32_t> bucketStarts, bucketItems;
+    if( hashes.allocateInsteadAndReset(itemCount)==NULL ||
+        bucketStarts.allocateInsteadAndReset(bucketCount+1)==NULL ||
+        bucketItems.allocateInsteadAndReset(itemCount)==NULL
+    ) {
+        fprintf(stderr, "icupkg: not enough memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+
+    // group the items by bucket: bucket b has items bucketItems[bucketStarts[b]..bucketStarts[b+1]-1]
+    int32_t i, b, maxBucketLength=0;
+    for(i=0; i<itemCount; ++i) {
+        hashes[i]=udata_hashTOCName(items[i].name, hashSeed);
+        ++bucketStarts[udata_getTOCIndexSlot(hashes[i], 0, bucketCount)+1];
+    }
+    for(b=0; b<bucketCount; ++b) {
+        if(bucketStarts[b+1]>maxBucketLength) {
+            maxBucketLength=bucketStarts[b+1];
+        }
+        bucketStarts[b+1]+=bucketStarts[b];
+    }
+    {
+        LocalMemory<int32_t> bucketLimits;
+        if(bucketLimits.allocateInsteadAndReset(bucketCount)==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        uprv_memcpy(bucketLimits.getAlias(), bucketStarts.getAlias(), (size_t)bucketCount*4);
+        for(i=0; i<itemCount; ++i) {
+            bucketItems[bucketLimits[udata_getTOCIndexSlot(hashes[i], 0, bucketCount)]++]=i;
+        }
+    }
+
+    for(i=0; i<slotCount; ++i) {
+        slots[i]=0xffff;
+    }
+    for(int32_t length=maxBucketLength; length>0; --length) {
+        for(b=0; b<bucketCount; ++b) {
+            int32_t start=bucketStarts[b];
+            if((bucketStarts[b+1]-start)!=length) {
+                continue;
+            }
+            uint32_t seed;
+            for(seed=1; seed<=0xffff; ++seed) {
+                // try to put all of the bucket's names into free slots
+                int32_t j;
+                for(j=0; j<length; ++j) {
+                    int32_t slot=udata_getTOCIndexSlot(hashes[bucketItems[start+j]], seed, slotCount);
+                    if(slots[slot]!=0xffff) {
+                        break;
+                    }
+                    slots[slot]=(uint16_t)bucketItems[start+j];
+                }
+                if(j==length) {
+                    break;
+                }
+                // undo
+                while(j>0) {
+                    --j;
+                    slots[udata_getTOCIndexSlot(hashes[bucketItems[start+j]], seed, slotCount)]=0xffff;
+                }
+            }
+            if(seed>0xffff) {
+                return FALSE;
+            }
+            seeds[b]=(uint16_t)seed;
+        }
+    }
+    return TRUE;
+}
+
 void
 Package::writePackage(const char *filename, char outType, const char *comment) {
     char prefix[MAX_PKG_NAME_LENGTH+4];
@@ -692,11 +879,37 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
     char *name;
     UErrorCode errorCode;
     int32_t i, length, prefixLength, maxItemLength, basenameOffset, offset, outInt32;
+    int32_t hotItemCount, alignment, hotPadding;
+    int32_t tocIndexItem, tocIndexLength, bucketCount, slotCount;
+    uint8_t *tocIndexData;
     uint8_t outCharset;
     UBool outIsBigEndian;
 
     extractPackageName(filename, prefix, MAX_PKG_NAME_LENGTH);
 
+    // add the ToC hash index item, to be filled in once the ToC is known
+    tocIndexData=NULL;
+    bucketCount=slotCount=0;
+    if(doTOCIndex) {
+        removeItem(findItem(UDATA_TOC_INDEX_NAME));
+        // item indexes must fit into uint16_t, with 0xffff for unused slots
+        if((itemCount+1)>=0xffff) {
+            fprintf(stderr, "icupkg: too many items for a ToC hash index\n");
+            exit(U_BUFFER_OVERFLOW_ERROR);
+        }
+        bucketCount=(itemCount+1+3)/4;
+        slotCount=itemCount+1+(itemCount+1)/4;
+        tocIndexLength=kTOCIndexHeaderLength+4*UDATA_TOC_INDEX_IX_COUNT+2*(bucketCount+slotCount);
+        tocIndexLength=(tocIndexLength+15)&~15;
+        tocIndexData=(uint8_t *)uprv_malloc(tocIndexLength);
+        if(tocIndexData==NULL) {
+            fprintf(stderr, "icupkg: not enough memory\n");
+            exit(U_MEMORY_ALLOCATION_ERROR);
+        }
+        memset(tocIndexData, 0, tocIndexLength);
+        addItem(UDATA_TOC_INDEX_NAME, tocIndexData, tocIndexLength, TRUE, outType);
+    }
+
     // if there is an explicit comment, then use it, else use what's in the current header
     if(comment!=NULL) {
         /* get the header size minus the current comment */
@@ -792,9 +1005,34 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
             fprintf(stderr, "icupkg: swapInvChars(item names) failed - %s\n", u_errorName(errorCode));
             exit(errorCode);
         }
+        if(hotNamesLength>0) {
+            dsLocalToOut->swapInvChars(dsLocalToOut, hotNames, hotNamesLength, hotNames, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: swapInvChars(hot item names) failed - %s\n", u_errorName(errorCode));
+                exit(errorCode);
+            }
+        }
         sortItems();
     }
 
+    // determine the order of the items' data, the ToC hash index first,
+    // and the ToC entries below
+    LocalMemory<int32_t> layout;
+    LocalMemory<UDataOffsetTOCEntry> entries;
+    if( layout.allocateInsteadAndReset(itemCount+1)==NULL ||
+        entries.allocateInsteadAndReset(itemCount+1)==NULL
+    ) {
+        fprintf(stderr, "icupkg: not enough memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    tocIndexItem=-1;
+    for(i=0; i<itemCount; ++i) {
+        if(tocIndexData!=NULL && items[i].data==tocIndexData) {
+            tocIndexItem=i;
+        }
+    }
+    hotItemCount=getItemLayout(tocIndexItem, layout.getAlias());
+
     // create the output item names in sorted order, with the package name prepended to each
     for(i=0; i<itemCount; ++i) {
         length=(int32_t)strlen(items[i].name);
@@ -804,15 +1042,80 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         items[i].name=name;
     }
 
+    // build the ToC hash index for the output item names, see ucmndata.h
+    int32_t *tocIndexes=NULL;
+    if(tocIndexData!=NULL) {
+        tocIndexes=(int32_t *)(tocIndexData+kTOCIndexHeaderLength);
+        uint16_t *seeds=(uint16_t *)(tocIndexes+UDATA_TOC_INDEX_IX_COUNT);
+        uint32_t hashSeed;
+        // If two names have the same 32-bit hash value, then try another hash function.
+        for(hashSeed=0;; ++hashSeed) {
+            if(hashSeed==16) {
+                fprintf(stderr, "icupkg: unable to build the ToC hash index\n");
+                exit(U_INTERNAL_PROGRAM_ERROR);
+            }
+            if(buildTOCIndex(items, itemCount, hashSeed, bucketCount, seeds, slotCount, seeds+bucketCount)) {
+                break;
+            }
+        }
+        tocIndexes[UDATA_TOC_INDEX_IX_INDEXES_LENGTH]=UDATA_TOC_INDEX_IX_COUNT;
+        tocIndexes[UDATA_TOC_INDEX_IX_ITEM_COUNT]=itemCount;
+        tocIndexes[UDATA_TOC_INDEX_IX_BUCKET_COUNT]=bucketCount;
+        tocIndexes[UDATA_TOC_INDEX_IX_SLOT_COUNT]=slotCount;
+        tocIndexes[UDATA_TOC_INDEX_IX_HASH_SEED]=(int32_t)hashSeed;
+    }
+
     // calculate offsets for item names and items, pad to 16-align items
     // align only the first item; each item's length is a multiple of 16
+    // (the header length is a multiple of 16 as well);
+    // page-align the first hot item and the first item after the hot ones
     basenameOffset=4+8*itemCount;
     offset=basenameOffset+outStringTop;
-    if((length=(offset&15))!=0) {
-        length=16-length;
+    alignment= hotItemCount>0 ? pageSize : 16;
+    if((length=((headerLength+offset)&(alignment-1)))!=0) {
+        length=alignment-length;
         memset(allocString(FALSE, length-1), 0xaa, length);
         offset+=length;
     }
+    maxItemLength=0;
+    hotPadding=0;
+    for(i=0; i<itemCount; ++i) {
+        if(i==hotItemCount && i>0 && (length=((headerLength+offset)&(pageSize-1)))!=0) {
+            hotPadding=pageSize-length;
+            offset+=hotPadding;
+        }
+        pItem=items+layout[i];
+        entries[layout[i]].dataOffset=(uint32_t)offset;
+        length=pItem->length;
+        if(length>maxItemLength) {
+            maxItemLength=length;
+        }
+        offset+=length;
+    }
+    for(i=0; i<itemCount; ++i) {
+        entries[i].nameOffset=(uint32_t)(basenameOffset+(items[i].name-outStrings));
+    }
+
+    // finish the ToC hash index and swap it to the output platform properties
+    if(tocIndexData!=NULL) {
+        tocIndexes[UDATA_TOC_INDEX_IX_CHECKSUM]=(int32_t)udata_checksumTOC(entries.getAlias(), itemCount);
+
+        DataHeader *pHeader=(DataHeader *)tocIndexData;
+        pHeader->dataHeader.headerSize=(uint16_t)kTOCIndexHeaderLength;
+        pHeader->dataHeader.magic1=0xda;
+        pHeader->dataHeader.magic2=0x27;
+        memcpy(&pHeader->info, &tocIndexDataInfo, sizeof(tocIndexDataInfo));
+        if(dsLocalToOut!=NULL) {
+            udata_swapDataHeader(dsLocalToOut, tocIndexData, kTOCIndexHeaderLength, tocIndexData, &errorCode);
+            dsLocalToOut->swapArray32(dsLocalToOut, tocIndexes, 4*UDATA_TOC_INDEX_IX_COUNT, tocIndexes, &errorCode);
+            dsLocalToOut->swapArray16(dsLocalToOut, tocIndexes+UDATA_TOC_INDEX_IX_COUNT,
+                                      2*(bucketCount+slotCount), tocIndexes+UDATA_TOC_INDEX_IX_COUNT, &errorCode);
+            if(U_FAILURE(errorCode)) {
+                fprintf(stderr, "icupkg: swapping the ToC hash index failed - %s\n", u_errorName(errorCode));
+                exit(errorCode);
+            }
+        }
+    }
 
     // write the table of contents
     // first the itemCount
@@ -830,11 +1133,9 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
         exit(U_FILE_ACCESS_ERROR);
     }
 
-    // then write the item entries (and collect the maxItemLength)
-    maxItemLength=0;
+    // then write the item entries
     for(i=0; i<itemCount; ++i) {
-        entry.nameOffset=(uint32_t)(basenameOffset+(items[i].name-outStrings));
-        entry.dataOffset=(uint32_t)offset;
+        entry=entries[i];
         if(dsLocalToOut!=NULL) {
             dsLocalToOut->swapArray32(dsLocalToOut, &entry, 8, &entry, &errorCode);
             if(U_FAILURE(errorCode)) {
@@ -847,12 +1148,6 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
             fprintf(stderr, "icupkg: unable to write complete item entry %ld to file \"%s\"\n", (long)i, filename);
             exit(U_FILE_ACCESS_ERROR);
         }
-
-        length=items[i].length;
-        if(length>maxItemLength) {
-            maxItemLength=length;
-        }
-        offset+=length;
     }
 
     // write the item names
@@ -863,7 +1158,23 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
     }
 
     // write the items
-    for(pItem=items, i=0; i<itemCount; ++pItem, ++i) {
+    for(i=0; i<itemCount; ++i) {
+        if(i==hotItemCount && hotPadding>0) {
+            // pad the hot items to a page boundary
+            uint8_t padding[256];
+            memset(padding, 0xaa, sizeof(padding));
+            for(offset=0; offset<hotPadding; offset+=length) {
+                length=hotPadding-offset;
+                if(length>(int32_t)sizeof(padding)) {
+                    length=(int32_t)sizeof(padding);
+                }
+                if((int32_t)fwrite(padding, 1, length, file)!=length) {
+                    fprintf(stderr, "icupkg: unable to write complete padding to file \"%s\"\n", filename);
+                    exit(U_FILE_ACCESS_ERROR);
+                }
+            }
+        }
+        pItem=items+layout[i];
         int32_t type=makeTypeEnum(pItem->type);
         if(ds[type]!=NULL) {
             // swap each item from its platform properties to the desired ones
@@ -872,13 +1183,13 @@ Package::writePackage(const char *filename, char outType, const char *comment) {
                 pItem->data, pItem->length, pItem->data,
                 &errorCode);
             if(U_FAILURE(errorCode)) {
-                fprintf(stderr, "icupkg: udata_swap(item %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+                fprintf(stderr, "icupkg: udata_swap(item %ld) failed - %s\n", (long)layout[i], u_errorName(errorCode));
                 exit(errorCode);
             }
         }
         length=(int32_t)fwrite(pItem->data, 1, pItem->length, file);
         if(length!=pItem->length) {
-            fprintf(stderr, "icupkg: unable to write complete item %ld to file \"%s\"\n", (long)i, filename);
+            fprintf(stderr, "icupkg: unable to write complete item %ld to file \"%s\"\n", (long)layout[i], filename);
             exit(U_FILE_ACCESS_ERROR);
         }
     }
@@ -1281,6 +1592,40 @@ Package::sortItems() {
     }
 }
 
+int32_t
+Package::getItemLayout(int32_t firstItem, int32_t *layout) {
+    LocalMemory<UBool> isHot;
+    const char *name, *namesLimit;
+    int32_t i, idx, hotItemCount, layoutLength;
+
+    if(isHot.allocateInsteadAndReset(itemCount+1)==NULL) {
+        fprintf(stderr, "icupkg: not enough memory\n");
+        exit(U_MEMORY_ALLOCATION_ERROR);
+    }
+    // firstItem, the hot items in the order in which they were added,
+    // then the others in ToC order
+    layoutLength=0;
+    if(firstItem>=0) {
+        isHot[firstItem]=TRUE;
+        layout[layoutLength++]=firstItem;
+    }
+    namesLimit=hotNames+hotNamesLength;
+    for(name=hotNames; name<namesLimit; name=strchr(name, 0)+1) {
+        idx=findItem(name);
+        if(idx>=0 && !isHot[idx]) {
+            isHot[idx]=TRUE;
+            layout[layoutLength++]=idx;
+        }
+    }
+    hotItemCount= layoutLength>1 || firstItem<0 ? layoutLength : 0;
+    for(i=0; i<itemCount; ++i) {
+        if(!isHot[i]) {
+            layout[layoutLength++]=i;
+        }
+    }
+    return hotItemCount;
+}
+
 void Package::setItemCapacity(int32_t max)
 {
   if(max<=itemMax) {
@@ -67,6 +67,32 @@ class U_TOOLUTIL_API Package {
     }
     void setPrefix(const char *p);
 
+    /**
+     * writePackage() will add a hash index for the ToC as the item
+     * UDATA_TOC_INDEX_NAME (see ucmndata.h), for faster item lookups at runtime.
+     * readPackage() removes such an item from the input package
+     * and turns this on, so that the index is regenerated for the new ToC.
+     */
+    void setTOCIndex() { doTOCIndex=TRUE; }
+
+    /**
+     * Appends the name of an item that is loaded frequently or early,
+     * for example from a trace of udata_openChoice() calls.
+     * writePackage() writes the data of such "hot" items first, in the order
+     * in which they were added, starting at a page boundary,
+     * followed by the other items starting at the next page boundary,
+     * so that the commonly used items share few pages.
+     * The ToC remains sorted by item names.
+     * Names that were added before or that do not name an item of this package
+     * are ignored.
+     */
+    void addHotItem(const char *name);
+    /**
+     * Sets the page size for the hot items layout, a power of 2 >=16.
+     * The default is 4096.
+     */
+    void setPageSize(int32_t size) { pageSize=size; }
+
     /*
      * Read an existing .dat package file.
      * The header and item name strings are swapped into this object,
@@ -155,6 +181,15 @@ class U_TOOLUTIL_API Package {
 
     void sortItems();
 
+    /*
+     * Set the item indexes in the order in which writePackage() writes their data,
+     * firstItem (if >=0), then the hot items, then the others.
+     * Returns the number of items before the others, or 0 if there are no hot items.
+     * Call after the item names and the hot names have been swapped to the output
+     * charset and the items sorted, and before the package name is prepended to them.
+     */
+    int32_t getItemLayout(int32_t firstItem, int32_t *layout);
+
     // data fields
     char inPkgName[MAX_PKG_NAME_LENGTH];
     char pkgPrefix[MAX_PKG_NAME_LENGTH];
@@ -166,6 +201,7 @@ class U_TOOLUTIL_API Package {
     UBool inIsBigEndian;
     UBool doAutoPrefix;
     UBool prefixEndsWithType;
+    UBool doTOCIndex;
 
     int32_t itemCount;
     int32_t itemMax;
@@ -185,6 +221,11 @@ class U_TOOLUTIL_API Package {
     // state for checkDependencies()
     UBool isMissingItems;
 
+    // names for addHotItem(), each NUL-terminated
+    char *hotNames;
+    int32_t hotNamesLength, hotNamesCapacity;
+    int32_t pageSize;
+
     /**
      * Grow itemMax to new value
      */
@@ -48,6 +48,94 @@ isListTextFile(const char *listname) {
     return FALSE;
 }
 
+/*
+ * Read a .txt list file (in the system/ invariant charset)
+ * and call handleItem() for each item name.
+ * Returns FALSE if the file cannot be opened.
+ */
+static UBool
+readListTextFile(const char *listname,
+                 void (*handleItem)(void *context, const char *name), void *context) {
+    FILE *file;
+    char line[1024];
+    char *end;
+    const char *start;
+
+    file=fopen(listname, "r");
+    if(file==NULL) {
+        fprintf(stderr, "icupkg: unable to open list file \"%s\"\n", listname);
+        return FALSE;
+    }
+
+    while(fgets(line, sizeof(line), file)) {
+        // remove comments
+        end=strchr(line, '#');
+        if(end!=NULL) {
+            *end=0;
+        } else {
+            // remove trailing CR LF
+            end=strchr(line, 0);
+            while(line<end && (*(end-1)=='\r' || *(end-1)=='\n')) {
+                *--end=0;
+            }
+        }
+
+        // check first non-whitespace character and
+        // skip empty lines and
+        // skip lines starting with reserved characters
+        start=u_skipWhitespace(line);
+        if(*start==0 || NULL!=strchr(U_PKG_RESERVED_CHARS, *start)) {
+            continue;
+        }
+
+        // take whitespace-separated items from the line
+        for(;;) {
+            // find whitespace after the item or the end of the line
+            for(end=(char *)start; *end!=0 && *end!=' ' && *end!='\t'; ++end) {}
+            if(*end==0) {
+                // this item is the last one on the line
+                end=NULL;
+            } else {
+                // the item is terminated by whitespace, terminate it with NUL
+                *end=0;
+            }
+            handleItem(context, start);
+
+            // find the start of the next item or exit the loop
+            if(end==NULL || *(start=u_skipWhitespace(end+1))==0) {
+                break;
+            }
+        }
+    }
+    fclose(file);
+    return TRUE;
+}
+
+namespace {
+
+struct ListContext {
+    Package *listPkg;
+    const char *filesPath;
+    UBool readContents;
+};
+
+void
+addListItem(void *context, const char *name) {
+    ListContext *listContext=(ListContext *)context;
+    if(listContext->readContents) {
+        listContext->listPkg->addFile(listContext->filesPath, name);
+    } else {
+        listContext->listPkg->addItem(name);
+    }
+}
+
+void
+addHotItem(void *context, const char *name) {
+    ((Package *)context)->addHotItem(name);
+}
+
+}  // namespace
+
 /*
  * Read a file list.
  * If the listname ends with ".txt", then read the list file
@@ -58,7 +146,6 @@ isListTextFile(const char *listname) {
 U_CAPI Package * U_EXPORT2
 readList(const char *filesPath, const char *listname, UBool readContents, Package *listPkgIn) {
     Package *listPkg = listPkgIn;
-    FILE *file;
     const char *listNameEnd;
 
     if(listname==NULL || listname[0]==0) {
@@ -77,62 +164,11 @@ readList(const char *filesPath, const char *listname, UBool readContents, Packag
     listNameEnd=strchr(listname, 0);
     if(isListTextFile(listname)) {
         // read the list file
-        char line[1024];
-        char *end;
-        const char *start;
-
-        file=fopen(listname, "r");
-        if(file==NULL) {
-            fprintf(stderr, "icupkg: unable to open list file \"%s\"\n", listname);
+        ListContext context={ listPkg, filesPath, readContents };
+        if(!readListTextFile(listname, addListItem, &context)) {
             delete listPkg;
             exit(U_FILE_ACCESS_ERROR);
         }
-
-        while(fgets(line, sizeof(line), file)) {
-            // remove comments
-            end=strchr(line, '#');
-            if(end!=NULL) {
-                *end=0;
-            } else {
-                // remove trailing CR LF
-                end=strchr(line, 0);
-                while(line<end && (*(end-1)=='\r' || *(end-1)=='\n')) {
-                    *--end=0;
-                }
-            }
-
-            // check first non-whitespace character and
-            // skip empty lines and
-            // skip lines starting with reserved characters
-            start=u_skipWhitespace(line);
-            if(*start==0 || NULL!=strchr(U_PKG_RESERVED_CHARS, *start)) {
-                continue;
-            }
-
-            // take whitespace-separated items from the line
-            for(;;) {
-                // find whitespace after the item or the end of the line
-                for(end=(char *)start; *end!=0 && *end!=' ' && *end!='\t'; ++end) {}
-                if(*end==0) {
-                    // this item is the last one on the line
-                    end=NULL;
-                } else {
-                    // the item is terminated by whitespace, terminate it with NUL
-                    *end=0;
-                }
-                if(readContents) {
-                    listPkg->addFile(filesPath, start);
-                } else {
-                    listPkg->addItem(start);
-                }
-
-                // find the start of the next item or exit the loop
-                if(end==NULL || *(start=u_skipWhitespace(end+1))==0) {
-                    break;
-                }
-            }
-        }
-        fclose(file);
     } else if((listNameEnd-listname)>4 && 0==memcmp(listNameEnd-4, ".dat", 4)) {
         // read the ICU .dat package
         // Accept a .dat file whose name differs from the ToC prefixes.
@@ -150,8 +186,21 @@ readList(const char *filesPath, const char *listname, UBool readContents, Packag
     return listPkg;
 }
 
+/*
+ * Read the names of the hot items from a list file,
+ * with the same syntax as a .txt file for readList(),
+ * in the order in which they are to be stored.
+ */
+U_CAPI void U_EXPORT2
+readHotItems(const char *listname, Package *pkg) {
+    if(!readListTextFile(listname, addHotItem, pkg)) {
+        exit(U_FILE_ACCESS_ERROR);
+    }
+}
+
 U_CAPI int U_EXPORT2
-writePackageDatFile(const char *outFilename, const char *outComment, const char *sourcePath, const char *addList, Package *pkg, char outType) {
+writePackageDatFile(const char *outFilename, const char *outComment, const char *sourcePath, const char *addList, Package *pkg, char outType,
+                    const char *hotItemsList, UBool tocIndex) {
     LocalPointer<Package> ownedPkg;
     LocalPointer<Package> addListPkg;
 
@@ -171,6 +220,12 @@ writePackageDatFile(const char *outFilename, const char *outComment, const char
         }
     }
 
+    if(hotItemsList!=NULL) {
+        readHotItems(hotItemsList, pkg);
+    }
+    if(tocIndex) {
+        pkg->setTOCIndex();
+    }
     pkg->writePackage(outFilename, outType, outComment);
     return 0;
 }
@@ -17,9 +17,12 @@
 U_CAPI int U_EXPORT2
 writePackageDatFile(const char *outFilename, const char *outComment,
                     const char *sourcePath, const char *addList, icu::Package *pkg,
-                    char outType);
+                    char outType, const char *hotItemsList=NULL, UBool tocIndex=FALSE);
 
 U_CAPI icu::Package * U_EXPORT2
 readList(const char *filesPath, const char *listname, UBool readContents, icu::Package *listPkgIn);
 
+U_CAPI void U_EXPORT2
+readHotItems(const char *listname, icu::Package *pkg);
+
 #endif